@@ -8,12 +8,18 @@ import 'package:flutter_qnn_lib/platform_utils.dart';
 import 'dart:convert';
 import 'package:path_provider/path_provider.dart';
 import 'dart:async';
+import 'dart:typed_data' show Float32List, Uint8List;
 
 // 注意：这个文件依赖生成的 FFI 绑定文件，请确保 qnn_wrapper_bindings_generated.dart 可用。
 import 'qnn_wrapper_bindings_generated.dart';
 export 'qnn_types.dart';
 export 'qnn_wrapper_bindings_generated.dart'
-    show QnnStatus, QnnOutputDataType, QnnInputDataType;
+    show
+        QnnStatus,
+        QnnOutputDataType,
+        QnnInputDataType,
+        QnnTensorDataType,
+        QnnWarmupInput;
 
 // 存储创建完成后的Completer引用，用于静态回调
 
@@ -75,6 +81,38 @@ void _destroyCallback(int status, ffi.Pointer<ffi.Void> userData) {
   }
 }
 
+/// 张量缓冲区视图，借用 QnnSampleApp 内部持久化张量的内存，调用者不能释放。
+/// 在切换图或销毁实例之前一直有效。
+class QnnTensorBuffer {
+  final String name;
+  final ffi.Pointer<ffi.Void> data;
+
+  /// 缓冲区字节数
+  final int dataSize;
+  final QnnTensorDataType dataType;
+  final List<int> dims;
+
+  /// 量化参数，仅对 FIXED_POINT 类型有意义，反量化公式为 (q + offset) * scale
+  final double scale;
+  final int offset;
+
+  QnnTensorBuffer._fromView(QnnTensorView view)
+    : name = view.name.cast<Utf8>().toDartString(),
+      data = view.data,
+      dataSize = view.dataSize,
+      dataType = QnnTensorDataType.fromValue(view.dataType),
+      dims = List<int>.generate(view.rank, (i) => view.dims[i]),
+      scale = view.scale,
+      offset = view.offset;
+
+  /// 按字节访问缓冲区
+  Uint8List asBytes() => data.cast<ffi.Uint8>().asTypedList(dataSize);
+
+  /// 按 float32 访问缓冲区，仅对 QNN_TENSOR_DATA_TYPE_FLOAT_32 有意义
+  Float32List asFloat32List() =>
+      data.cast<ffi.Float>().asTypedList(dataSize ~/ ffi.sizeOf<ffi.Float>());
+}
+
 /// 用于包装 QNN API 的 Dart 接口，内部调用 FFI 生成的绑定函数。
 class Qnn {
   final QnnWrapperBindings _bindings;
@@ -429,6 +467,15 @@ class Qnn {
 
   QnnStatus freeGraphs() => _bindings.qnn_sample_app_free_graphs(_app);
 
+  /// 热切换到 [modelPath]（.bin）中的模型，保留 backend 和 device；
+  /// 失败时保留原模型。之前取得的张量视图在切换后失效
+  QnnStatus swapModel(String modelPath) {
+    final modelPathPtr = modelPath.toNativeUtf8().cast<ffi.Char>();
+    final res = _bindings.qnn_sample_app_swap_model(_app, modelPathPtr);
+    malloc.free(modelPathPtr);
+    return res;
+  }
+
   /// 获取后端生成的版本号字符串
   String getBackendBuildId() {
     final idPtr = _bindings.qnn_sample_app_get_backend_build_id(_app);
@@ -610,6 +657,109 @@ class Qnn {
     return results;
   }
 
+  /// 获取指定图的输入张量个数，失败时返回 -1
+  int getInputCount(int graphIdx) {
+    final Pointer<ffi.Size> countPtr = malloc.allocate<ffi.Size>(
+      ffi.sizeOf<ffi.Size>(),
+    );
+    final status = _bindings.qnn_sample_app_get_input_count(
+      _app,
+      graphIdx,
+      countPtr,
+    );
+    final count = status == QnnStatus.QNN_STATUS_SUCCESS ? countPtr.value : -1;
+    malloc.free(countPtr);
+    return count;
+  }
+
+  /// 零拷贝输入：获取第 [inputIdx] 个输入张量的缓冲区视图。
+  /// 按 dataType 与量化参数直接写入缓冲区后调用 [executeGraphs] 即可，无需再调用 [loadFloatInputs]。
+  /// 失败时返回 null。
+  QnnTensorBuffer? getInputTensorView(int graphIdx, int inputIdx) {
+    final Pointer<QnnTensorView> viewPtr = malloc.allocate<QnnTensorView>(
+      ffi.sizeOf<QnnTensorView>(),
+    );
+    final status = _bindings.qnn_sample_app_get_input_tensor_view(
+      _app,
+      graphIdx,
+      inputIdx,
+      viewPtr,
+    );
+    final buffer =
+        status == QnnStatus.QNN_STATUS_SUCCESS
+            ? QnnTensorBuffer._fromView(viewPtr.ref)
+            : null;
+    malloc.free(viewPtr);
+    return buffer;
+  }
+
+  /// 按输出张量的 dims 计算各输出的元素个数，失败时返回 null
+  List<int>? _outputElementCounts(int graphIdx) {
+    final Pointer<ffi.Size> countPtr = malloc.allocate<ffi.Size>(
+      ffi.sizeOf<ffi.Size>(),
+    );
+    final Pointer<QnnTensorView> viewPtr = malloc.allocate<QnnTensorView>(
+      ffi.sizeOf<QnnTensorView>(),
+    );
+    List<int>? counts;
+    final status = _bindings.qnn_sample_app_get_output_count(
+      _app,
+      graphIdx,
+      countPtr,
+    );
+    if (status == QnnStatus.QNN_STATUS_SUCCESS) {
+      counts = [];
+      for (int i = 0; i < countPtr.value; i++) {
+        final viewStatus = _bindings.qnn_sample_app_get_output_tensor_view(
+          _app,
+          graphIdx,
+          i,
+          viewPtr,
+        );
+        if (viewStatus != QnnStatus.QNN_STATUS_SUCCESS) {
+          counts = null;
+          break;
+        }
+        int elements = 1;
+        for (int d = 0; d < viewPtr.ref.rank; d++) {
+          elements *= viewPtr.ref.dims[d];
+        }
+        counts.add(elements);
+      }
+    }
+    malloc.free(countPtr);
+    malloc.free(viewPtr);
+    return counts;
+  }
+
+  /// 开始记录进程级时间线，包含 FFI 入口、工作线程排队、量化/反量化与 graphExecute
+  /// [capacity] 为事件缓冲上限，0 使用默认值；会清空之前的事件
+  void startTrace([int capacity = 0]) => _bindings.qnn_trace_start(capacity);
+
+  void stopTrace() => _bindings.qnn_trace_stop();
+
+  void clearTrace() => _bindings.qnn_trace_clear();
+
+  /// 将时间线写入 [path]（Trace Event Format JSON），可用 Perfetto 打开
+  QnnStatus writeTrace(String path) {
+    final pathPtr = path.toNativeUtf8().cast<ffi.Char>();
+    final res = _bindings.qnn_trace_write(pathPtr);
+    malloc.free(pathPtr);
+    return res;
+  }
+
+  /// 以 JSON 字符串返回时间线，失败时返回空字符串
+  String getTraceJson() {
+    final jsonPtr = _bindings.qnn_trace_get_json();
+    if (jsonPtr == ffi.nullptr) {
+      return '';
+    }
+    final str = jsonPtr.cast<Utf8>().toDartString();
+    // 返回的字符串由底层分配，需要释放
+    malloc.free(jsonPtr);
+    return str;
+  }
+
   /// 销毁 QnnSampleApp 对象，释放资源
   void destroy() {
     _bindings.qnn_sample_app_destroy(_app);
@@ -900,4 +1050,175 @@ extension QnnAsync on Qnn {
 
     return completer.future;
   }
+
+  // 热切换模型的异步版本，排在该实例此前提交的异步调用之后执行
+  Future<QnnStatus> swapModelAsync(String modelPath) {
+    final completer = Completer<QnnStatus>();
+
+    // 使用NativeCallable.listener创建跨线程安全的回调
+    late final NativeCallable<QnnAsyncCallbackFunction> callback;
+
+    void onModelSwapped(int status, ffi.Pointer<ffi.Void> userData) {
+      print('切换模型完成回调被调用，状态: $status');
+      completer.complete(QnnStatus.fromValue(status));
+      // 关闭NativeCallable以避免内存泄漏
+      callback.close();
+    }
+
+    callback = NativeCallable.listener(onModelSwapped);
+
+    // 底层在提交前复制路径字符串，这里可以立即释放
+    final modelPathPtr = modelPath.toNativeUtf8().cast<ffi.Char>();
+    _bindings.qnn_sample_app_swap_model_async(
+      _app,
+      modelPathPtr,
+      callback.nativeFunction,
+      ffi.nullptr,
+    );
+    malloc.free(modelPathPtr);
+
+    return completer.future;
+  }
+
+  // 预热的异步版本：用全零或随机数据填充该图的默认输入并执行 runs 次，
+  // 代替在 Dart 侧发起的空跑请求；会覆盖该图默认张量中已有的输入/输出数据
+  Future<QnnStatus> warmupAsync(
+    int runs,
+    int graphIdx, {
+    QnnWarmupInput input = QnnWarmupInput.QNN_WARMUP_INPUT_ZEROS,
+  }) {
+    final completer = Completer<QnnStatus>();
+
+    // 使用NativeCallable.listener创建跨线程安全的回调
+    late final NativeCallable<QnnAsyncCallbackFunction> callback;
+
+    void onWarmedUp(int status, ffi.Pointer<ffi.Void> userData) {
+      print('预热完成回调被调用，状态: $status');
+      completer.complete(QnnStatus.fromValue(status));
+      // 关闭NativeCallable以避免内存泄漏
+      callback.close();
+    }
+
+    callback = NativeCallable.listener(onWarmedUp);
+
+    _bindings.qnn_sample_app_warmup_async(
+      _app,
+      runs,
+      graphIdx,
+      input,
+      callback.nativeFunction,
+      ffi.nullptr,
+    );
+
+    return completer.future;
+  }
+
+  // 单次调用完成推理的异步版本：加载浮点输入、执行图、反量化输出只需一次 FFI 调用
+  Future<List<List<double>>> inferAsync(
+    List<List<double>> inputs,
+    int graphIdx,
+  ) {
+    final completer = Completer<List<List<double>>>();
+
+    // 输出缓冲区按输出张量的元素个数预先分配
+    final outputSizes = _outputElementCounts(graphIdx);
+    if (outputSizes == null) {
+      completer.complete(<List<double>>[]);
+      return completer.future;
+    }
+
+    // 使用NativeCallable.listener创建跨线程安全的回调
+    late final NativeCallable<QnnAsyncCallbackFunction> callback;
+
+    // 分配存放各输入数组指针的内存
+    final numInputs = inputs.length;
+    final Pointer<ffi.Pointer<ffi.Float>> inputsPtr = malloc
+        .allocate<ffi.Pointer<ffi.Float>>(
+          numInputs * ffi.sizeOf<ffi.Pointer<ffi.Float>>(),
+        );
+    // 分配存放每个输入大小的内存
+    final Pointer<ffi.Size> sizesPtr = malloc.allocate<ffi.Size>(
+      numInputs * ffi.sizeOf<ffi.Size>(),
+    );
+
+    // 存储临时分配的每个输入/输出数组，用于最后释放
+    final List<ffi.Pointer<ffi.Float>> allocatedArrays = [];
+
+    for (int i = 0; i < numInputs; i++) {
+      final currentList = inputs[i];
+      final length = currentList.length;
+      final Pointer<ffi.Float> arrPtr = malloc.allocate<ffi.Float>(
+        length * ffi.sizeOf<ffi.Float>(),
+      );
+      for (int j = 0; j < length; j++) {
+        arrPtr[j] = currentList[j];
+      }
+      allocatedArrays.add(arrPtr);
+      inputsPtr.elementAt(i).value = arrPtr;
+      sizesPtr.elementAt(i).value = length;
+    }
+
+    // 分配输出缓冲区及其容量数组
+    final numOutputs = outputSizes.length;
+    final Pointer<ffi.Pointer<ffi.Float>> outputsPtr = malloc
+        .allocate<ffi.Pointer<ffi.Float>>(
+          numOutputs * ffi.sizeOf<ffi.Pointer<ffi.Float>>(),
+        );
+    final Pointer<ffi.Size> capacitiesPtr = malloc.allocate<ffi.Size>(
+      numOutputs * ffi.sizeOf<ffi.Size>(),
+    );
+    for (int i = 0; i < numOutputs; i++) {
+      final Pointer<ffi.Float> arrPtr = malloc.allocate<ffi.Float>(
+        outputSizes[i] * ffi.sizeOf<ffi.Float>(),
+      );
+      allocatedArrays.add(arrPtr);
+      outputsPtr.elementAt(i).value = arrPtr;
+      capacitiesPtr.elementAt(i).value = outputSizes[i];
+    }
+
+    void onInferred(int status, ffi.Pointer<ffi.Void> userData) {
+      print('推理完成回调被调用，状态: $status');
+      final results = <List<double>>[];
+      if (status == QnnStatus.QNN_STATUS_SUCCESS.value) {
+        for (var i = 0; i < numOutputs; i++) {
+          final arrPtr = outputsPtr.elementAt(i).value;
+          final outputList = <double>[];
+          for (var j = 0; j < outputSizes[i]; j++) {
+            outputList.add(arrPtr[j]);
+          }
+          results.add(outputList);
+        }
+      }
+      completer.complete(results);
+
+      // 释放临时分配的内存
+      for (final ptr in allocatedArrays) {
+        malloc.free(ptr);
+      }
+      malloc.free(inputsPtr);
+      malloc.free(sizesPtr);
+      malloc.free(outputsPtr);
+      malloc.free(capacitiesPtr);
+
+      // 关闭NativeCallable以避免内存泄漏
+      callback.close();
+    }
+
+    callback = NativeCallable.listener(onInferred);
+
+    _bindings.qnn_sample_app_infer_async(
+      _app,
+      inputsPtr,
+      sizesPtr,
+      numInputs,
+      outputsPtr,
+      capacitiesPtr,
+      numOutputs,
+      graphIdx,
+      callback.nativeFunction,
+      ffi.nullptr,
+    );
+
+    return completer.future;
+  }
 }
@@ -29,8 +29,9 @@ class QnnWrapperBindings {
   /// 创建 QnnSampleApp 对象。
   /// 参数 backendPath 和 modelPath 为后端库及模型库文件路径，
   /// outputDataType 与 inputDataType 为数据类型枚举值。
-  /// dataDir 为应用数据目录路径，用于切换工作目录。
-  /// htpConfig 为HTP后端特定配置，如果不是HTP后端则忽略。
+  /// dataDir 为应用数据目录路径，非空时把进程工作目录切换过去；工作目录是进程级状态，
+  /// 会影响其它线程，各创建/加载接口之间对切换目录串行，并在切换后立即把相对路径解析为绝对路径。
+  /// HTP 后端的图配置通过 qnn_sample_app_create_with_options 传入，这里使用默认值。
   /// 如果创建失败返回 NULL。
   ffi.Pointer<QnnSampleApp> qnn_sample_app_create(
     ffi.Pointer<ffi.Char> backendPath,
@@ -71,6 +72,325 @@ class QnnWrapperBindings {
             )
           >();
 
+  /// 与 qnn_sample_app_create 相同，但对 .so 模型启用编译缓存：
+  /// 首次启动编译并 finalize 后把 context 序列化到 cacheDir，之后的启动直接走二进制加载路径。
+  /// 缓存 key 由模型文件内容、backend build id、SoC/arch 和后端配置决定，任一变化都会重新编译；
+  /// 缓存加载失败时自动删除该缓存并重新编译。
+  /// maxCacheBytes 为缓存目录总大小上限，超出时删除最久未使用的缓存，传 0 使用默认值（2 GB）。
+  /// cacheDir 为 NULL 或空串时等同于 qnn_sample_app_create；.bin 模型忽略缓存参数。
+  ffi.Pointer<QnnSampleApp> qnn_sample_app_create_with_cache(
+    ffi.Pointer<ffi.Char> backendPath,
+    ffi.Pointer<ffi.Char> modelPath,
+    QnnOutputDataType outputDataType,
+    QnnInputDataType inputDataType,
+    ffi.Pointer<ffi.Char> dataDir,
+    ffi.Pointer<ffi.Char> cacheDir,
+    int maxCacheBytes,
+  ) {
+    return _qnn_sample_app_create_with_cache(
+      backendPath,
+      modelPath,
+      outputDataType.value,
+      inputDataType.value,
+      dataDir,
+      cacheDir,
+      maxCacheBytes,
+    );
+  }
+
+  late final _qnn_sample_app_create_with_cachePtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<QnnSampleApp> Function(
+        ffi.Pointer<ffi.Char>,
+        ffi.Pointer<ffi.Char>,
+        ffi.UnsignedInt,
+        ffi.UnsignedInt,
+        ffi.Pointer<ffi.Char>,
+        ffi.Pointer<ffi.Char>,
+        ffi.UnsignedLongLong,
+      )
+    >
+  >('qnn_sample_app_create_with_cache');
+  late final _qnn_sample_app_create_with_cache =
+      _qnn_sample_app_create_with_cachePtr
+          .asFunction<
+            ffi.Pointer<QnnSampleApp> Function(
+              ffi.Pointer<ffi.Char>,
+              ffi.Pointer<ffi.Char>,
+              int,
+              int,
+              ffi.Pointer<ffi.Char>,
+              ffi.Pointer<ffi.Char>,
+              int,
+            )
+          >();
+
+  /// 用默认值填充 HTP 图配置
+  void qnn_htp_config_init(ffi.Pointer<QnnBackendHtpConfig> config) {
+    return _qnn_htp_config_init(config);
+  }
+
+  late final _qnn_htp_config_initPtr = _lookup<
+    ffi.NativeFunction<ffi.Void Function(ffi.Pointer<QnnBackendHtpConfig>)>
+  >('qnn_htp_config_init');
+  late final _qnn_htp_config_init =
+      _qnn_htp_config_initPtr
+          .asFunction<void Function(ffi.Pointer<QnnBackendHtpConfig>)>();
+
+  /// 与 qnn_sample_app_create 相同，额外选项见 QnnCreateOptions，options 为 NULL 时等同于 qnn_sample_app_create。
+  /// 启用 warmupRuns 时返回的实例已经过预热，第一次请求即为稳态速度。
+  ffi.Pointer<QnnSampleApp> qnn_sample_app_create_with_options(
+    ffi.Pointer<ffi.Char> backendPath,
+    ffi.Pointer<ffi.Char> modelPath,
+    QnnOutputDataType outputDataType,
+    QnnInputDataType inputDataType,
+    ffi.Pointer<ffi.Char> dataDir,
+    ffi.Pointer<QnnCreateOptions> options,
+  ) {
+    return _qnn_sample_app_create_with_options(
+      backendPath,
+      modelPath,
+      outputDataType.value,
+      inputDataType.value,
+      dataDir,
+      options,
+    );
+  }
+
+  late final _qnn_sample_app_create_with_optionsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<QnnSampleApp> Function(
+        ffi.Pointer<ffi.Char>,
+        ffi.Pointer<ffi.Char>,
+        ffi.UnsignedInt,
+        ffi.UnsignedInt,
+        ffi.Pointer<ffi.Char>,
+        ffi.Pointer<QnnCreateOptions>,
+      )
+    >
+  >('qnn_sample_app_create_with_options');
+  late final _qnn_sample_app_create_with_options =
+      _qnn_sample_app_create_with_optionsPtr
+          .asFunction<
+            ffi.Pointer<QnnSampleApp> Function(
+              ffi.Pointer<ffi.Char>,
+              ffi.Pointer<ffi.Char>,
+              int,
+              int,
+              ffi.Pointer<ffi.Char>,
+              ffi.Pointer<QnnCreateOptions>,
+            )
+          >();
+
+  /// 本实例是否命中编译缓存（1 命中，0 未命中或未启用）
+  int qnn_sample_app_is_loaded_from_cache(ffi.Pointer<QnnSampleApp> app) {
+    return _qnn_sample_app_is_loaded_from_cache(app);
+  }
+
+  late final _qnn_sample_app_is_loaded_from_cachePtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<QnnSampleApp>)>>(
+        'qnn_sample_app_is_loaded_from_cache',
+      );
+  late final _qnn_sample_app_is_loaded_from_cache =
+      _qnn_sample_app_is_loaded_from_cachePtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
+
+  /// 非阻塞的分阶段加载：立即返回加载句柄，加载在独立线程上进行。
+  /// 同时启动多个即可并行加载多个模型，同一 backend 只初始化一次。
+  /// 参数与 qnn_sample_app_create_with_cache 相同，cacheDir 可为 NULL。
+  ffi.Pointer<QnnModelLoader> qnn_model_loader_start(
+    ffi.Pointer<ffi.Char> backendPath,
+    ffi.Pointer<ffi.Char> modelPath,
+    QnnOutputDataType outputDataType,
+    QnnInputDataType inputDataType,
+    ffi.Pointer<ffi.Char> dataDir,
+    ffi.Pointer<ffi.Char> cacheDir,
+    int maxCacheBytes,
+  ) {
+    return _qnn_model_loader_start(
+      backendPath,
+      modelPath,
+      outputDataType.value,
+      inputDataType.value,
+      dataDir,
+      cacheDir,
+      maxCacheBytes,
+    );
+  }
+
+  late final _qnn_model_loader_startPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<QnnModelLoader> Function(
+        ffi.Pointer<ffi.Char>,
+        ffi.Pointer<ffi.Char>,
+        ffi.UnsignedInt,
+        ffi.UnsignedInt,
+        ffi.Pointer<ffi.Char>,
+        ffi.Pointer<ffi.Char>,
+        ffi.UnsignedLongLong,
+      )
+    >
+  >('qnn_model_loader_start');
+  late final _qnn_model_loader_start =
+      _qnn_model_loader_startPtr
+          .asFunction<
+            ffi.Pointer<QnnModelLoader> Function(
+              ffi.Pointer<ffi.Char>,
+              ffi.Pointer<ffi.Char>,
+              int,
+              int,
+              ffi.Pointer<ffi.Char>,
+              ffi.Pointer<ffi.Char>,
+              int,
+            )
+          >();
+
+  /// 与 qnn_model_loader_start 相同，额外选项见 QnnCreateOptions，options 可为 NULL
+  ffi.Pointer<QnnModelLoader> qnn_model_loader_start_with_options(
+    ffi.Pointer<ffi.Char> backendPath,
+    ffi.Pointer<ffi.Char> modelPath,
+    QnnOutputDataType outputDataType,
+    QnnInputDataType inputDataType,
+    ffi.Pointer<ffi.Char> dataDir,
+    ffi.Pointer<QnnCreateOptions> options,
+  ) {
+    return _qnn_model_loader_start_with_options(
+      backendPath,
+      modelPath,
+      outputDataType.value,
+      inputDataType.value,
+      dataDir,
+      options,
+    );
+  }
+
+  late final _qnn_model_loader_start_with_optionsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<QnnModelLoader> Function(
+        ffi.Pointer<ffi.Char>,
+        ffi.Pointer<ffi.Char>,
+        ffi.UnsignedInt,
+        ffi.UnsignedInt,
+        ffi.Pointer<ffi.Char>,
+        ffi.Pointer<QnnCreateOptions>,
+      )
+    >
+  >('qnn_model_loader_start_with_options');
+  late final _qnn_model_loader_start_with_options =
+      _qnn_model_loader_start_with_optionsPtr
+          .asFunction<
+            ffi.Pointer<QnnModelLoader> Function(
+              ffi.Pointer<ffi.Char>,
+              ffi.Pointer<ffi.Char>,
+              int,
+              int,
+              ffi.Pointer<ffi.Char>,
+              ffi.Pointer<QnnCreateOptions>,
+            )
+          >();
+
+  /// 轮询当前阶段
+  QnnLoadStage qnn_model_loader_get_stage(ffi.Pointer<QnnModelLoader> loader) {
+    return QnnLoadStage.fromValue(_qnn_model_loader_get_stage(loader));
+  }
+
+  late final _qnn_model_loader_get_stagePtr = _lookup<
+    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<QnnModelLoader>)>
+  >('qnn_model_loader_get_stage');
+  late final _qnn_model_loader_get_stage =
+      _qnn_model_loader_get_stagePtr
+          .asFunction<int Function(ffi.Pointer<QnnModelLoader>)>();
+
+  /// 等待加载结束或超时，返回当时的阶段；timeoutMs 为负表示一直等待
+  QnnLoadStage qnn_model_loader_wait(
+    ffi.Pointer<QnnModelLoader> loader,
+    int timeoutMs,
+  ) {
+    return QnnLoadStage.fromValue(_qnn_model_loader_wait(loader, timeoutMs));
+  }
+
+  late final _qnn_model_loader_waitPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(ffi.Pointer<QnnModelLoader>, ffi.Int)
+    >
+  >('qnn_model_loader_wait');
+  late final _qnn_model_loader_wait =
+      _qnn_model_loader_waitPtr
+          .asFunction<int Function(ffi.Pointer<QnnModelLoader>, int)>();
+
+  QnnStatus qnn_model_loader_get_timings(
+    ffi.Pointer<QnnModelLoader> loader,
+    ffi.Pointer<QnnLoadTimings> timings,
+  ) {
+    return QnnStatus.fromValue(_qnn_model_loader_get_timings(loader, timings));
+  }
+
+  late final _qnn_model_loader_get_timingsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnModelLoader>,
+        ffi.Pointer<QnnLoadTimings>,
+      )
+    >
+  >('qnn_model_loader_get_timings');
+  late final _qnn_model_loader_get_timings =
+      _qnn_model_loader_get_timingsPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnModelLoader>,
+              ffi.Pointer<QnnLoadTimings>,
+            )
+          >();
+
+  /// 失败原因，返回的字符串由调用者负责释放
+  ffi.Pointer<ffi.Char> qnn_model_loader_get_error(
+    ffi.Pointer<QnnModelLoader> loader,
+  ) {
+    return _qnn_model_loader_get_error(loader);
+  }
+
+  late final _qnn_model_loader_get_errorPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnModelLoader>)
+    >
+  >('qnn_model_loader_get_error');
+  late final _qnn_model_loader_get_error =
+      _qnn_model_loader_get_errorPtr
+          .asFunction<
+            ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnModelLoader>)
+          >();
+
+  /// READY 后取走实例，只能取一次，之后由调用者通过 qnn_sample_app_destroy 释放；
+  /// 未就绪返回 NULL。分配句柄失败时也返回 NULL，实例仍留在加载器中，可以再次调用。
+  ffi.Pointer<QnnSampleApp> qnn_model_loader_take_app(
+    ffi.Pointer<QnnModelLoader> loader,
+  ) {
+    return _qnn_model_loader_take_app(loader);
+  }
+
+  late final _qnn_model_loader_take_appPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<QnnSampleApp> Function(ffi.Pointer<QnnModelLoader>)
+    >
+  >('qnn_model_loader_take_app');
+  late final _qnn_model_loader_take_app =
+      _qnn_model_loader_take_appPtr
+          .asFunction<
+            ffi.Pointer<QnnSampleApp> Function(ffi.Pointer<QnnModelLoader>)
+          >();
+
+  /// 等待加载线程结束并释放句柄，未取走的实例一并释放
+  void qnn_model_loader_destroy(ffi.Pointer<QnnModelLoader> loader) {
+    return _qnn_model_loader_destroy(loader);
+  }
+
+  late final _qnn_model_loader_destroyPtr = _lookup<
+    ffi.NativeFunction<ffi.Void Function(ffi.Pointer<QnnModelLoader>)>
+  >('qnn_model_loader_destroy');
+  late final _qnn_model_loader_destroy =
+      _qnn_model_loader_destroyPtr
+          .asFunction<void Function(ffi.Pointer<QnnModelLoader>)>();
+
   /// 释放 QnnSampleApp 对象
   void qnn_sample_app_destroy(ffi.Pointer<QnnSampleApp> app) {
     return _qnn_sample_app_destroy(app);
@@ -235,149 +555,1266 @@ class QnnWrapperBindings {
       _qnn_sample_app_free_graphsPtr
           .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
 
-  /// 获取后端生成的版本号字符串。
-  /// 返回的字符串由内部动态分配，调用者需要使用 free() 释放。
-  ffi.Pointer<ffi.Char> qnn_sample_app_get_backend_build_id(
+  /// 热切换模型：保留 backend、device 和 HTP 性能投票，只把 context 和图替换为 modelPath（.bin）中的内容，
+  /// 切换耗时基本只有 context 反序列化。在途的原生异步执行先在旧图上完成，同步执行阻塞到切换结束后
+  /// 在新图上运行（图索引在新模型中不存在时返回失败）。之前取得的张量视图和图名称指针在切换后失效。
+  /// 流水线张量组需全部释放，合批调度器需先销毁。新模型加载失败时保留原模型，实例可以继续使用。
+  /// _async 版本排在该实例此前提交的异步调用之后执行。
+  QnnStatus qnn_sample_app_swap_model(
     ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Char> modelPath,
   ) {
-    return _qnn_sample_app_get_backend_build_id(app);
+    return QnnStatus.fromValue(_qnn_sample_app_swap_model(app, modelPath));
   }
 
-  late final _qnn_sample_app_get_backend_build_idPtr = _lookup<
+  late final _qnn_sample_app_swap_modelPtr = _lookup<
     ffi.NativeFunction<
-      ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>)
+      ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>, ffi.Pointer<ffi.Char>)
     >
-  >('qnn_sample_app_get_backend_build_id');
-  late final _qnn_sample_app_get_backend_build_id =
-      _qnn_sample_app_get_backend_build_idPtr
+  >('qnn_sample_app_swap_model');
+  late final _qnn_sample_app_swap_model =
+      _qnn_sample_app_swap_modelPtr
           .asFunction<
-            ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>)
+            int Function(ffi.Pointer<QnnSampleApp>, ffi.Pointer<ffi.Char>)
           >();
 
-  QnnStatus qnn_sample_app_is_device_property_supported(
+  /// 获取 .bin 模型加载的耗时与内存统计，非 .bin 模型各字段为 0。
+  QnnStatus qnn_sample_app_get_binary_load_stats(
     ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<QnnBinaryLoadStats> stats,
   ) {
     return QnnStatus.fromValue(
-      _qnn_sample_app_is_device_property_supported(app),
+      _qnn_sample_app_get_binary_load_stats(app, stats),
     );
   }
 
-  late final _qnn_sample_app_is_device_property_supportedPtr = _lookup<
-    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>)>
-  >('qnn_sample_app_is_device_property_supported');
-  late final _qnn_sample_app_is_device_property_supported =
-      _qnn_sample_app_is_device_property_supportedPtr
-          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
-
-  QnnStatus qnn_sample_app_create_device(ffi.Pointer<QnnSampleApp> app) {
-    return QnnStatus.fromValue(_qnn_sample_app_create_device(app));
-  }
-
-  late final _qnn_sample_app_create_devicePtr = _lookup<
-    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>)>
-  >('qnn_sample_app_create_device');
-  late final _qnn_sample_app_create_device =
-      _qnn_sample_app_create_devicePtr
-          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
-
-  QnnStatus qnn_sample_app_free_device(ffi.Pointer<QnnSampleApp> app) {
-    return QnnStatus.fromValue(_qnn_sample_app_free_device(app));
-  }
-
-  late final _qnn_sample_app_free_devicePtr = _lookup<
-    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>)>
-  >('qnn_sample_app_free_device');
-  late final _qnn_sample_app_free_device =
-      _qnn_sample_app_free_devicePtr
-          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
+  late final _qnn_sample_app_get_binary_load_statsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<QnnBinaryLoadStats>,
+      )
+    >
+  >('qnn_sample_app_get_binary_load_stats');
+  late final _qnn_sample_app_get_binary_load_stats =
+      _qnn_sample_app_get_binary_load_statsPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<QnnBinaryLoadStats>,
+            )
+          >();
 
-  /// 加载浮点数输入张量。
-  /// 参数 inputs 为指向各输入数组的指针数组，sizes 为各数组元素的个数，numInputs 为输入个数，graphIdx 为图索引。
-  QnnStatus qnn_sample_app_load_float_inputs(
+  /// 获取实例创建（冷启动）各阶段的耗时与内存统计，用于跟踪 SDK 升级前后的回归。
+  /// _json 版本返回同样内容的 JSON 字符串，由调用者负责释放。
+  QnnStatus qnn_sample_app_get_startup_stats(
     ffi.Pointer<QnnSampleApp> app,
-    ffi.Pointer<ffi.Pointer<ffi.Float>> inputs,
-    ffi.Pointer<ffi.Size> sizes,
-    int numInputs,
-    int graphIdx,
+    ffi.Pointer<QnnStartupStats> stats,
   ) {
-    return QnnStatus.fromValue(
-      _qnn_sample_app_load_float_inputs(
-        app,
-        inputs,
-        sizes,
-        numInputs,
-        graphIdx,
-      ),
-    );
+    return QnnStatus.fromValue(_qnn_sample_app_get_startup_stats(app, stats));
   }
 
-  late final _qnn_sample_app_load_float_inputsPtr = _lookup<
+  late final _qnn_sample_app_get_startup_statsPtr = _lookup<
     ffi.NativeFunction<
       ffi.UnsignedInt Function(
         ffi.Pointer<QnnSampleApp>,
-        ffi.Pointer<ffi.Pointer<ffi.Float>>,
-        ffi.Pointer<ffi.Size>,
-        ffi.Size,
-        ffi.Int,
+        ffi.Pointer<QnnStartupStats>,
       )
     >
-  >('qnn_sample_app_load_float_inputs');
-  late final _qnn_sample_app_load_float_inputs =
-      _qnn_sample_app_load_float_inputsPtr
+  >('qnn_sample_app_get_startup_stats');
+  late final _qnn_sample_app_get_startup_stats =
+      _qnn_sample_app_get_startup_statsPtr
           .asFunction<
             int Function(
               ffi.Pointer<QnnSampleApp>,
-              ffi.Pointer<ffi.Pointer<ffi.Float>>,
+              ffi.Pointer<QnnStartupStats>,
+            )
+          >();
+
+  ffi.Pointer<ffi.Char> qnn_sample_app_get_startup_stats_json(
+    ffi.Pointer<QnnSampleApp> app,
+  ) {
+    return _qnn_sample_app_get_startup_stats_json(app);
+  }
+
+  late final _qnn_sample_app_get_startup_stats_jsonPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>)
+    >
+  >('qnn_sample_app_get_startup_stats_json');
+  late final _qnn_sample_app_get_startup_stats_json =
+      _qnn_sample_app_get_startup_stats_jsonPtr
+          .asFunction<
+            ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>)
+          >();
+
+  /// 张量内存改为可共享的 fd 内存（rpcmem / memfd）并通过 memRegister 注册，执行时 backend 直接访问，
+  /// 省去每次执行的输入/输出拷贝。输入/输出视图等接口的用法不变。
+  /// 必须在首次加载输入或获取视图之前调用；backend 不支持 memRegister 时返回 QNN_STATUS_FEATURE_UNSUPPORTED。
+  QnnStatus qnn_sample_app_enable_shared_memory(
+    ffi.Pointer<QnnSampleApp> app,
+    QnnSharedMemoryType type,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_enable_shared_memory(app, type.value),
+    );
+  }
+
+  late final _qnn_sample_app_enable_shared_memoryPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>, ffi.UnsignedInt)
+    >
+  >('qnn_sample_app_enable_shared_memory');
+  late final _qnn_sample_app_enable_shared_memory =
+      _qnn_sample_app_enable_shared_memoryPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>, int)>();
+
+  /// 多图支持：每张图有独立的持久化输入/输出张量，首次使用时分配，切换图不会重新分配。
+  /// qnn_sample_app_execute_graphs 执行最近一次加载输入的图（默认图 0）。
+  QnnStatus qnn_sample_app_get_graph_count(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Size> numGraphs,
+  ) {
+    return QnnStatus.fromValue(_qnn_sample_app_get_graph_count(app, numGraphs));
+  }
+
+  late final _qnn_sample_app_get_graph_countPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>, ffi.Pointer<ffi.Size>)
+    >
+  >('qnn_sample_app_get_graph_count');
+  late final _qnn_sample_app_get_graph_count =
+      _qnn_sample_app_get_graph_countPtr
+          .asFunction<
+            int Function(ffi.Pointer<QnnSampleApp>, ffi.Pointer<ffi.Size>)
+          >();
+
+  /// 获取图名称，返回的字符串归实例所有，在下一次切换模型或实例销毁前有效；索引无效时返回 NULL。
+  ffi.Pointer<ffi.Char> qnn_sample_app_get_graph_name(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+  ) {
+    return _qnn_sample_app_get_graph_name(app, graphIdx);
+  }
+
+  late final _qnn_sample_app_get_graph_namePtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>, ffi.Int)
+    >
+  >('qnn_sample_app_get_graph_name');
+  late final _qnn_sample_app_get_graph_name =
+      _qnn_sample_app_get_graph_namePtr
+          .asFunction<
+            ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>, int)
+          >();
+
+  /// 按名称查找图索引，找不到时返回 -1。
+  int qnn_sample_app_get_graph_index(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Char> graphName,
+  ) {
+    return _qnn_sample_app_get_graph_index(app, graphName);
+  }
+
+  late final _qnn_sample_app_get_graph_indexPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Int Function(ffi.Pointer<QnnSampleApp>, ffi.Pointer<ffi.Char>)
+    >
+  >('qnn_sample_app_get_graph_index');
+  late final _qnn_sample_app_get_graph_index =
+      _qnn_sample_app_get_graph_indexPtr
+          .asFunction<
+            int Function(ffi.Pointer<QnnSampleApp>, ffi.Pointer<ffi.Char>)
+          >();
+
+  QnnStatus qnn_sample_app_execute_graph(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+  ) {
+    return QnnStatus.fromValue(_qnn_sample_app_execute_graph(app, graphIdx));
+  }
+
+  late final _qnn_sample_app_execute_graphPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>, ffi.Int)
+    >
+  >('qnn_sample_app_execute_graph');
+  late final _qnn_sample_app_execute_graph =
+      _qnn_sample_app_execute_graphPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>, int)>();
+
+  QnnStatus qnn_sample_app_execute_graph_by_name(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Char> graphName,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_execute_graph_by_name(app, graphName),
+    );
+  }
+
+  late final _qnn_sample_app_execute_graph_by_namePtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>, ffi.Pointer<ffi.Char>)
+    >
+  >('qnn_sample_app_execute_graph_by_name');
+  late final _qnn_sample_app_execute_graph_by_name =
+      _qnn_sample_app_execute_graph_by_namePtr
+          .asFunction<
+            int Function(ffi.Pointer<QnnSampleApp>, ffi.Pointer<ffi.Char>)
+          >();
+
+  /// 获取后端生成的版本号字符串。
+  /// 返回的字符串由内部动态分配，调用者需要使用 free() 释放。
+  ffi.Pointer<ffi.Char> qnn_sample_app_get_backend_build_id(
+    ffi.Pointer<QnnSampleApp> app,
+  ) {
+    return _qnn_sample_app_get_backend_build_id(app);
+  }
+
+  late final _qnn_sample_app_get_backend_build_idPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>)
+    >
+  >('qnn_sample_app_get_backend_build_id');
+  late final _qnn_sample_app_get_backend_build_id =
+      _qnn_sample_app_get_backend_build_idPtr
+          .asFunction<
+            ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>)
+          >();
+
+  QnnStatus qnn_sample_app_is_device_property_supported(
+    ffi.Pointer<QnnSampleApp> app,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_is_device_property_supported(app),
+    );
+  }
+
+  late final _qnn_sample_app_is_device_property_supportedPtr = _lookup<
+    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>)>
+  >('qnn_sample_app_is_device_property_supported');
+  late final _qnn_sample_app_is_device_property_supported =
+      _qnn_sample_app_is_device_property_supportedPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
+
+  QnnStatus qnn_sample_app_create_device(ffi.Pointer<QnnSampleApp> app) {
+    return QnnStatus.fromValue(_qnn_sample_app_create_device(app));
+  }
+
+  late final _qnn_sample_app_create_devicePtr = _lookup<
+    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>)>
+  >('qnn_sample_app_create_device');
+  late final _qnn_sample_app_create_device =
+      _qnn_sample_app_create_devicePtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
+
+  QnnStatus qnn_sample_app_free_device(ffi.Pointer<QnnSampleApp> app) {
+    return QnnStatus.fromValue(_qnn_sample_app_free_device(app));
+  }
+
+  late final _qnn_sample_app_free_devicePtr = _lookup<
+    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>)>
+  >('qnn_sample_app_free_device');
+  late final _qnn_sample_app_free_device =
+      _qnn_sample_app_free_devicePtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
+
+  /// 加载浮点数输入张量。
+  /// 参数 inputs 为指向各输入数组的指针数组，sizes 为各数组元素的个数，numInputs 为输入个数，graphIdx 为图索引。
+  QnnStatus qnn_sample_app_load_float_inputs(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> inputs,
+    ffi.Pointer<ffi.Size> sizes,
+    int numInputs,
+    int graphIdx,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_load_float_inputs(
+        app,
+        inputs,
+        sizes,
+        numInputs,
+        graphIdx,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_load_float_inputsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        ffi.Int,
+      )
+    >
+  >('qnn_sample_app_load_float_inputs');
+  late final _qnn_sample_app_load_float_inputs =
+      _qnn_sample_app_load_float_inputsPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              int,
+            )
+          >();
+
+  /// 获取浮点数输出张量。
+  /// 参数 outputs 是一个输出指针，函数内部会分配内存保存各个输出数据（调用者需要对每个输出以及 outputs 数组调用 free() 释放）。
+  /// out_sizes 返回各输出张量的元素个数，numOutputs 返回输出张量数量。
+  QnnStatus qnn_sample_app_get_float_outputs(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Float>>> outputs,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
+    ffi.Pointer<ffi.Size> numOutputs,
+    int graphIdx,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_float_outputs(
+        app,
+        outputs,
+        out_sizes,
+        numOutputs,
+        graphIdx,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_get_float_outputsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Float>>>,
+        ffi.Pointer<ffi.Pointer<ffi.Size>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Int,
+      )
+    >
+  >('qnn_sample_app_get_float_outputs');
+  late final _qnn_sample_app_get_float_outputs =
+      _qnn_sample_app_get_float_outputsPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Float>>>,
+              ffi.Pointer<ffi.Pointer<ffi.Size>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+            )
+          >();
+
+  /// 获取指定图的输入张量个数。
+  QnnStatus qnn_sample_app_get_input_count(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    ffi.Pointer<ffi.Size> numInputs,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_input_count(app, graphIdx, numInputs),
+    );
+  }
+
+  late final _qnn_sample_app_get_input_countPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.Pointer<ffi.Size>,
+      )
+    >
+  >('qnn_sample_app_get_input_count');
+  late final _qnn_sample_app_get_input_count =
+      _qnn_sample_app_get_input_countPtr
+          .asFunction<
+            int Function(ffi.Pointer<QnnSampleApp>, int, ffi.Pointer<ffi.Size>)
+          >();
+
+  /// 零拷贝输入：获取第 inputIdx 个输入张量的缓冲区视图。
+  /// 调用者按 dataType / 量化参数直接写入 view->data（最多 dataSize 字节），
+  /// 然后调用 qnn_sample_app_execute_graphs 即可，无需再调用 load_float_inputs。
+  /// 首次调用时会为该图分配持久化张量。
+  QnnStatus qnn_sample_app_get_input_tensor_view(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    int inputIdx,
+    ffi.Pointer<QnnTensorView> view,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_input_tensor_view(app, graphIdx, inputIdx, view),
+    );
+  }
+
+  late final _qnn_sample_app_get_input_tensor_viewPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.Size,
+        ffi.Pointer<QnnTensorView>,
+      )
+    >
+  >('qnn_sample_app_get_input_tensor_view');
+  late final _qnn_sample_app_get_input_tensor_view =
+      _qnn_sample_app_get_input_tensor_viewPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              int,
+              ffi.Pointer<QnnTensorView>,
+            )
+          >();
+
+  /// 获取指定图的输出张量个数。
+  QnnStatus qnn_sample_app_get_output_count(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    ffi.Pointer<ffi.Size> numOutputs,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_output_count(app, graphIdx, numOutputs),
+    );
+  }
+
+  late final _qnn_sample_app_get_output_countPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.Pointer<ffi.Size>,
+      )
+    >
+  >('qnn_sample_app_get_output_count');
+  late final _qnn_sample_app_get_output_count =
+      _qnn_sample_app_get_output_countPtr
+          .asFunction<
+            int Function(ffi.Pointer<QnnSampleApp>, int, ffi.Pointer<ffi.Size>)
+          >();
+
+  /// 将浮点输出直接反量化到调用者预先分配的缓冲区中，不在内部分配内存。
+  /// outputs 为各输出缓冲区指针数组，capacities 为各缓冲区可容纳的 float 个数，
+  /// numOutputs 为缓冲区个数，必须不少于模型的输出张量个数。
+  /// 所需容量可以通过 qnn_sample_app_get_output_tensor_view 的 dims 计算。
+  QnnStatus qnn_sample_app_get_float_outputs_into(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> outputs,
+    ffi.Pointer<ffi.Size> capacities,
+    int numOutputs,
+    int graphIdx,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_float_outputs_into(
+        app,
+        outputs,
+        capacities,
+        numOutputs,
+        graphIdx,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_get_float_outputs_intoPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        ffi.Int,
+      )
+    >
+  >('qnn_sample_app_get_float_outputs_into');
+  late final _qnn_sample_app_get_float_outputs_into =
+      _qnn_sample_app_get_float_outputs_intoPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              int,
+            )
+          >();
+
+  /// 只读输出视图：获取第 outputIdx 个输出张量的原生缓冲区视图及其量化参数。
+  /// 调用者不得写入或释放 view->data，数据在下一次执行后被覆盖。
+  QnnStatus qnn_sample_app_get_output_tensor_view(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    int outputIdx,
+    ffi.Pointer<QnnTensorView> view,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_output_tensor_view(app, graphIdx, outputIdx, view),
+    );
+  }
+
+  late final _qnn_sample_app_get_output_tensor_viewPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.Size,
+        ffi.Pointer<QnnTensorView>,
+      )
+    >
+  >('qnn_sample_app_get_output_tensor_view');
+  late final _qnn_sample_app_get_output_tensor_view =
+      _qnn_sample_app_get_output_tensor_viewPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              int,
+              ffi.Pointer<QnnTensorView>,
+            )
+          >();
+
+  /// 按张量原生数据类型加载输入（如 uint8 像素、int32 token id、fp16），不做量化。
+  /// inputs 为各输入原始数据指针，sizes 为各输入的字节数，必须与张量的字节数完全一致。
+  /// 如果 inputs[i] 就是输入视图的 data 指针，则跳过拷贝。
+  QnnStatus qnn_sample_app_load_native_inputs(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> inputs,
+    ffi.Pointer<ffi.Size> sizes,
+    int numInputs,
+    int graphIdx,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_load_native_inputs(
+        app,
+        inputs,
+        sizes,
+        numInputs,
+        graphIdx,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_load_native_inputsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<ffi.Pointer<ffi.Void>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        ffi.Int,
+      )
+    >
+  >('qnn_sample_app_load_native_inputs');
+  late final _qnn_sample_app_load_native_inputs =
+      _qnn_sample_app_load_native_inputsPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<ffi.Pointer<ffi.Void>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              int,
+            )
+          >();
+
+  /// 按原生数据类型拷贝输出原始字节到调用者提供的缓冲区，不做反量化。
+  /// capacities 为各缓冲区字节数，writtenSizes 可为 NULL，否则返回各输出写入的字节数。
+  /// 如需完全零拷贝，请使用 qnn_sample_app_get_output_tensor_view。
+  QnnStatus qnn_sample_app_get_native_outputs(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> outputs,
+    ffi.Pointer<ffi.Size> capacities,
+    int numOutputs,
+    ffi.Pointer<ffi.Size> writtenSizes,
+    int graphIdx,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_native_outputs(
+        app,
+        outputs,
+        capacities,
+        numOutputs,
+        writtenSizes,
+        graphIdx,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_get_native_outputsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<ffi.Pointer<ffi.Void>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        ffi.Pointer<ffi.Size>,
+        ffi.Int,
+      )
+    >
+  >('qnn_sample_app_get_native_outputs');
+  late final _qnn_sample_app_get_native_outputs =
+      _qnn_sample_app_get_native_outputsPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<ffi.Pointer<ffi.Void>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              ffi.Pointer<ffi.Size>,
+              int,
+            )
+          >();
+
+  /// 单次调用完成推理：加载浮点输入、执行图、将输出反量化到调用者提供的缓冲区。
+  /// 输入约定同 qnn_sample_app_load_float_inputs，输出约定同 qnn_sample_app_get_float_outputs_into。
+  /// inputs 为 NULL 表示输入已通过输入视图写好；outputs 为 NULL 表示跳过输出转换，由调用者通过输出视图读取。
+  QnnStatus qnn_sample_app_infer(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> inputs,
+    ffi.Pointer<ffi.Size> sizes,
+    int numInputs,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> outputs,
+    ffi.Pointer<ffi.Size> capacities,
+    int numOutputs,
+    int graphIdx,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_infer(
+        app,
+        inputs,
+        sizes,
+        numInputs,
+        outputs,
+        capacities,
+        numOutputs,
+        graphIdx,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_inferPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        ffi.Int,
+      )
+    >
+  >('qnn_sample_app_infer');
+  late final _qnn_sample_app_infer =
+      _qnn_sample_app_inferPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              int,
+            )
+          >();
+
+  /// 预热：用全零或随机数据填充该图的默认输入并执行 runs 次，stats 返回首次与稳态耗时，可为 NULL。
+  /// 会覆盖该图默认张量中已有的输入/输出数据。
+  /// get_warmup_stats 返回最近一次预热（包括创建时的自动预热）的结果，该图未预热过时返回失败。
+  QnnStatus qnn_sample_app_warmup(
+    ffi.Pointer<QnnSampleApp> app,
+    int runs,
+    int graphIdx,
+    QnnWarmupInput input,
+    ffi.Pointer<QnnWarmupStats> stats,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_warmup(app, runs, graphIdx, input.value, stats),
+    );
+  }
+
+  late final _qnn_sample_app_warmupPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.UnsignedInt,
+        ffi.Int,
+        ffi.UnsignedInt,
+        ffi.Pointer<QnnWarmupStats>,
+      )
+    >
+  >('qnn_sample_app_warmup');
+  late final _qnn_sample_app_warmup =
+      _qnn_sample_app_warmupPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              int,
+              int,
+              ffi.Pointer<QnnWarmupStats>,
+            )
+          >();
+
+  QnnStatus qnn_sample_app_get_warmup_stats(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    ffi.Pointer<QnnWarmupStats> stats,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_warmup_stats(app, graphIdx, stats),
+    );
+  }
+
+  late final _qnn_sample_app_get_warmup_statsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.Pointer<QnnWarmupStats>,
+      )
+    >
+  >('qnn_sample_app_get_warmup_stats');
+  late final _qnn_sample_app_get_warmup_stats =
+      _qnn_sample_app_get_warmup_statsPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              ffi.Pointer<QnnWarmupStats>,
+            )
+          >();
+
+  /// 获取常开的延迟直方图与计数器，开销很低，不需要开启 QNN 性能分析。
+  /// reset 非 0 时读取的同时清零，可用于按周期上报。
+  QnnStatus qnn_sample_app_get_metrics(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<QnnMetrics> metrics,
+    int reset,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_metrics(app, metrics, reset),
+    );
+  }
+
+  late final _qnn_sample_app_get_metricsPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<QnnMetrics>,
+        ffi.Int,
+      )
+    >
+  >('qnn_sample_app_get_metrics');
+  late final _qnn_sample_app_get_metrics =
+      _qnn_sample_app_get_metricsPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<QnnMetrics>,
+              int,
+            )
+          >();
+
+  /// 运行时开启 backend 性能分析：之后每次成功执行收集一次事件树，只保留最近 historySize 次（默认建议 16）。
+  /// 切换级别会清空已有结果，OFF 关闭并释放 profile 句柄。
+  /// get_profile 的 back 为 0 表示最近一次；events 可为 NULL 只获取概要，
+  /// capacity 小于 info->numEvents 时只拷贝前 capacity 个。
+  /// get_profiles_json 返回最近 maxCount 次（0 为全部）的 JSON 数组，调用者需要使用 free() 释放。
+  QnnStatus qnn_sample_app_set_profiling(
+    ffi.Pointer<QnnSampleApp> app,
+    QnnProfilingLevel level,
+    int historySize,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_set_profiling(app, level.value, historySize),
+    );
+  }
+
+  late final _qnn_sample_app_set_profilingPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.UnsignedInt,
+        ffi.UnsignedInt,
+      )
+    >
+  >('qnn_sample_app_set_profiling');
+  late final _qnn_sample_app_set_profiling =
+      _qnn_sample_app_set_profilingPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>, int, int)>();
+
+  int qnn_sample_app_get_profile_count(ffi.Pointer<QnnSampleApp> app) {
+    return _qnn_sample_app_get_profile_count(app);
+  }
+
+  late final _qnn_sample_app_get_profile_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<QnnSampleApp>)>>(
+        'qnn_sample_app_get_profile_count',
+      );
+  late final _qnn_sample_app_get_profile_count =
+      _qnn_sample_app_get_profile_countPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
+
+  QnnStatus qnn_sample_app_get_profile(
+    ffi.Pointer<QnnSampleApp> app,
+    int back,
+    ffi.Pointer<QnnExecutionProfileInfo> info,
+    ffi.Pointer<QnnProfileEvent> events,
+    int capacity,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_profile(app, back, info, events, capacity),
+    );
+  }
+
+  late final _qnn_sample_app_get_profilePtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Size,
+        ffi.Pointer<QnnExecutionProfileInfo>,
+        ffi.Pointer<QnnProfileEvent>,
+        ffi.Size,
+      )
+    >
+  >('qnn_sample_app_get_profile');
+  late final _qnn_sample_app_get_profile =
+      _qnn_sample_app_get_profilePtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              ffi.Pointer<QnnExecutionProfileInfo>,
+              ffi.Pointer<QnnProfileEvent>,
+              int,
+            )
+          >();
+
+  ffi.Pointer<ffi.Char> qnn_sample_app_get_profiles_json(
+    ffi.Pointer<QnnSampleApp> app,
+    int maxCount,
+  ) {
+    return _qnn_sample_app_get_profiles_json(app, maxCount);
+  }
+
+  late final _qnn_sample_app_get_profiles_jsonPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>, ffi.Size)
+    >
+  >('qnn_sample_app_get_profiles_json');
+  late final _qnn_sample_app_get_profiles_json =
+      _qnn_sample_app_get_profiles_jsonPtr
+          .asFunction<
+            ffi.Pointer<ffi.Char> Function(ffi.Pointer<QnnSampleApp>, int)
+          >();
+
+  void qnn_sample_app_clear_profiles(ffi.Pointer<QnnSampleApp> app) {
+    return _qnn_sample_app_clear_profiles(app);
+  }
+
+  late final _qnn_sample_app_clear_profilesPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<QnnSampleApp>)>>(
+        'qnn_sample_app_clear_profiles',
+      );
+  late final _qnn_sample_app_clear_profiles =
+      _qnn_sample_app_clear_profilesPtr
+          .asFunction<void Function(ffi.Pointer<QnnSampleApp>)>();
+
+  /// HTP 性能档位：每次执行前自动投到 active 档位，最后一次执行结束 idleTimeoutMs 毫秒后放松到 idle 档位
+  /// （默认 BURST / LOW_POWER / 1000ms）。pin 之后固定为指定档位直到 unpin，适合批量任务。
+  /// 档位属于共享 backend，对同一 backend 的所有实例生效。
+  /// 仅 HTP 后端可用，否则返回 QNN_STATUS_FEATURE_UNSUPPORTED；get_power_profile 此时返回 -1。
+  QnnStatus qnn_sample_app_set_power_policy(
+    ffi.Pointer<QnnSampleApp> app,
+    QnnPowerProfile active,
+    QnnPowerProfile idle,
+    int idleTimeoutMs,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_set_power_policy(
+        app,
+        active.value,
+        idle.value,
+        idleTimeoutMs,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_set_power_policyPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.UnsignedInt,
+        ffi.UnsignedInt,
+        ffi.UnsignedInt,
+      )
+    >
+  >('qnn_sample_app_set_power_policy');
+  late final _qnn_sample_app_set_power_policy =
+      _qnn_sample_app_set_power_policyPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>, int, int, int)>();
+
+  QnnStatus qnn_sample_app_pin_power_profile(
+    ffi.Pointer<QnnSampleApp> app,
+    QnnPowerProfile profile,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_pin_power_profile(app, profile.value),
+    );
+  }
+
+  late final _qnn_sample_app_pin_power_profilePtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>, ffi.UnsignedInt)
+    >
+  >('qnn_sample_app_pin_power_profile');
+  late final _qnn_sample_app_pin_power_profile =
+      _qnn_sample_app_pin_power_profilePtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>, int)>();
+
+  QnnStatus qnn_sample_app_unpin_power_profile(ffi.Pointer<QnnSampleApp> app) {
+    return QnnStatus.fromValue(_qnn_sample_app_unpin_power_profile(app));
+  }
+
+  late final _qnn_sample_app_unpin_power_profilePtr = _lookup<
+    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>)>
+  >('qnn_sample_app_unpin_power_profile');
+  late final _qnn_sample_app_unpin_power_profile =
+      _qnn_sample_app_unpin_power_profilePtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
+
+  int qnn_sample_app_get_power_profile(ffi.Pointer<QnnSampleApp> app) {
+    return _qnn_sample_app_get_power_profile(app);
+  }
+
+  late final _qnn_sample_app_get_power_profilePtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<QnnSampleApp>)>>(
+        'qnn_sample_app_get_power_profile',
+      );
+  late final _qnn_sample_app_get_power_profile =
+      _qnn_sample_app_get_power_profilePtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
+
+  /// 流水线张量组：每张图持有 2~4 组独立的输入/输出张量（默认 2 组），与上面接口使用的默认张量互不影响。
+  /// 典型用法：acquire 一组 -> 写入输入（load_float_inputs_to_set 或输入视图）-> submit
+  /// -> 读取输出（get_float_outputs_from_set 或输出视图）-> release。
+  /// 生产者填充第 k+1 组时第 k 组可以在另一个线程上执行，消费者同时读取第 k-1 组。
+  /// setIdx 为组句柄，仅在 acquire 与 release 之间有效。
+  QnnStatus qnn_sample_app_set_tensor_ring_size(
+    ffi.Pointer<QnnSampleApp> app,
+    int size,
+  ) {
+    return QnnStatus.fromValue(_qnn_sample_app_set_tensor_ring_size(app, size));
+  }
+
+  late final _qnn_sample_app_set_tensor_ring_sizePtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>, ffi.UnsignedInt)
+    >
+  >('qnn_sample_app_set_tensor_ring_size');
+  late final _qnn_sample_app_set_tensor_ring_size =
+      _qnn_sample_app_set_tensor_ring_sizePtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>, int)>();
+
+  /// 没有空闲组时返回 QNN_STATUS_FAILURE
+  QnnStatus qnn_sample_app_acquire_tensor_set(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    ffi.Pointer<ffi.UnsignedInt> setIdx,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_acquire_tensor_set(app, graphIdx, setIdx),
+    );
+  }
+
+  late final _qnn_sample_app_acquire_tensor_setPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.Pointer<ffi.UnsignedInt>,
+      )
+    >
+  >('qnn_sample_app_acquire_tensor_set');
+  late final _qnn_sample_app_acquire_tensor_set =
+      _qnn_sample_app_acquire_tensor_setPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              ffi.Pointer<ffi.UnsignedInt>,
+            )
+          >();
+
+  QnnStatus qnn_sample_app_load_float_inputs_to_set(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    int setIdx,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> inputs,
+    ffi.Pointer<ffi.Size> sizes,
+    int numInputs,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_load_float_inputs_to_set(
+        app,
+        graphIdx,
+        setIdx,
+        inputs,
+        sizes,
+        numInputs,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_load_float_inputs_to_setPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.UnsignedInt,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+      )
+    >
+  >('qnn_sample_app_load_float_inputs_to_set');
+  late final _qnn_sample_app_load_float_inputs_to_set =
+      _qnn_sample_app_load_float_inputs_to_setPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              int,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
               ffi.Pointer<ffi.Size>,
               int,
+            )
+          >();
+
+  QnnStatus qnn_sample_app_get_tensor_set_input_view(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    int setIdx,
+    int inputIdx,
+    ffi.Pointer<QnnTensorView> view,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_tensor_set_input_view(
+        app,
+        graphIdx,
+        setIdx,
+        inputIdx,
+        view,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_get_tensor_set_input_viewPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.UnsignedInt,
+        ffi.Size,
+        ffi.Pointer<QnnTensorView>,
+      )
+    >
+  >('qnn_sample_app_get_tensor_set_input_view');
+  late final _qnn_sample_app_get_tensor_set_input_view =
+      _qnn_sample_app_get_tensor_set_input_viewPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              int,
+              int,
+              ffi.Pointer<QnnTensorView>,
+            )
+          >();
+
+  QnnStatus qnn_sample_app_get_tensor_set_output_view(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    int setIdx,
+    int outputIdx,
+    ffi.Pointer<QnnTensorView> view,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_tensor_set_output_view(
+        app,
+        graphIdx,
+        setIdx,
+        outputIdx,
+        view,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_get_tensor_set_output_viewPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.UnsignedInt,
+        ffi.Size,
+        ffi.Pointer<QnnTensorView>,
+      )
+    >
+  >('qnn_sample_app_get_tensor_set_output_view');
+  late final _qnn_sample_app_get_tensor_set_output_view =
+      _qnn_sample_app_get_tensor_set_output_viewPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
               int,
+              int,
+              ffi.Pointer<QnnTensorView>,
             )
           >();
 
-  /// 获取浮点数输出张量。
-  /// 参数 outputs 是一个输出指针，函数内部会分配内存保存各个输出数据（调用者需要对每个输出以及 outputs 数组调用 free() 释放）。
-  /// out_sizes 返回各输出张量的元素个数，numOutputs 返回输出张量数量。
-  QnnStatus qnn_sample_app_get_float_outputs(
+  /// 同步执行该组，返回后即可读取输出
+  QnnStatus qnn_sample_app_submit_tensor_set(
     ffi.Pointer<QnnSampleApp> app,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Float>>> outputs,
-    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
-    ffi.Pointer<ffi.Size> numOutputs,
     int graphIdx,
+    int setIdx,
   ) {
     return QnnStatus.fromValue(
-      _qnn_sample_app_get_float_outputs(
+      _qnn_sample_app_submit_tensor_set(app, graphIdx, setIdx),
+    );
+  }
+
+  late final _qnn_sample_app_submit_tensor_setPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.UnsignedInt,
+      )
+    >
+  >('qnn_sample_app_submit_tensor_set');
+  late final _qnn_sample_app_submit_tensor_set =
+      _qnn_sample_app_submit_tensor_setPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>, int, int)>();
+
+  QnnStatus qnn_sample_app_get_float_outputs_from_set(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    int setIdx,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> outputs,
+    ffi.Pointer<ffi.Size> capacities,
+    int numOutputs,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_get_float_outputs_from_set(
         app,
+        graphIdx,
+        setIdx,
         outputs,
-        out_sizes,
+        capacities,
         numOutputs,
-        graphIdx,
       ),
     );
   }
 
-  late final _qnn_sample_app_get_float_outputsPtr = _lookup<
+  late final _qnn_sample_app_get_float_outputs_from_setPtr = _lookup<
     ffi.NativeFunction<
       ffi.UnsignedInt Function(
         ffi.Pointer<QnnSampleApp>,
-        ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Float>>>,
-        ffi.Pointer<ffi.Pointer<ffi.Size>>,
-        ffi.Pointer<ffi.Size>,
         ffi.Int,
+        ffi.UnsignedInt,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
       )
     >
-  >('qnn_sample_app_get_float_outputs');
-  late final _qnn_sample_app_get_float_outputs =
-      _qnn_sample_app_get_float_outputsPtr
+  >('qnn_sample_app_get_float_outputs_from_set');
+  late final _qnn_sample_app_get_float_outputs_from_set =
+      _qnn_sample_app_get_float_outputs_from_setPtr
           .asFunction<
             int Function(
               ffi.Pointer<QnnSampleApp>,
-              ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Float>>>,
-              ffi.Pointer<ffi.Pointer<ffi.Size>>,
+              int,
+              int,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
               ffi.Pointer<ffi.Size>,
               int,
             )
           >();
 
+  /// 执行中的组不能释放
+  QnnStatus qnn_sample_app_release_tensor_set(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    int setIdx,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_release_tensor_set(app, graphIdx, setIdx),
+    );
+  }
+
+  late final _qnn_sample_app_release_tensor_setPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.UnsignedInt,
+      )
+    >
+  >('qnn_sample_app_release_tensor_set');
+  late final _qnn_sample_app_release_tensor_set =
+      _qnn_sample_app_release_tensor_setPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>, int, int)>();
+
+  /// backend 是否支持原生异步执行（graphExecuteAsync），支持返回 1，否则返回 0
+  int qnn_sample_app_supports_async_execution(ffi.Pointer<QnnSampleApp> app) {
+    return _qnn_sample_app_supports_async_execution(app);
+  }
+
+  late final _qnn_sample_app_supports_async_executionPtr =
+      _lookup<ffi.NativeFunction<ffi.Int Function(ffi.Pointer<QnnSampleApp>)>>(
+        'qnn_sample_app_supports_async_execution',
+      );
+  late final _qnn_sample_app_supports_async_execution =
+      _qnn_sample_app_supports_async_executionPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>)>();
+
+  /// 原生异步执行的在途数上限，默认 2
+  QnnStatus qnn_sample_app_set_max_in_flight(
+    ffi.Pointer<QnnSampleApp> app,
+    int maxInFlight,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_set_max_in_flight(app, maxInFlight),
+    );
+  }
+
+  late final _qnn_sample_app_set_max_in_flightPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(ffi.Pointer<QnnSampleApp>, ffi.UnsignedInt)
+    >
+  >('qnn_sample_app_set_max_in_flight');
+  late final _qnn_sample_app_set_max_in_flight =
+      _qnn_sample_app_set_max_in_flightPtr
+          .asFunction<int Function(ffi.Pointer<QnnSampleApp>, int)>();
+
+  /// 阻塞直到所有原生异步执行完成
+  void qnn_sample_app_wait_async_executions(ffi.Pointer<QnnSampleApp> app) {
+    return _qnn_sample_app_wait_async_executions(app);
+  }
+
+  late final _qnn_sample_app_wait_async_executionsPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<QnnSampleApp>)>>(
+        'qnn_sample_app_wait_async_executions',
+      );
+  late final _qnn_sample_app_wait_async_executions =
+      _qnn_sample_app_wait_async_executionsPtr
+          .asFunction<void Function(ffi.Pointer<QnnSampleApp>)>();
+
   /// 获取HTP架构版本号
   /// 参数 backendPath 为后端库路径
   /// 返回HTP架构版本号，如果发生错误则返回-1
@@ -652,6 +2089,41 @@ class QnnWrapperBindings {
             )
           >();
 
+  void qnn_sample_app_execute_graph_async(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    QnnAsyncCallback callback,
+    ffi.Pointer<ffi.Void> userData,
+  ) {
+    return _qnn_sample_app_execute_graph_async(
+      app,
+      graphIdx,
+      callback,
+      userData,
+    );
+  }
+
+  late final _qnn_sample_app_execute_graph_asyncPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Void Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        QnnAsyncCallback,
+        ffi.Pointer<ffi.Void>,
+      )
+    >
+  >('qnn_sample_app_execute_graph_async');
+  late final _qnn_sample_app_execute_graph_async =
+      _qnn_sample_app_execute_graph_asyncPtr
+          .asFunction<
+            void Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              QnnAsyncCallback,
+              ffi.Pointer<ffi.Void>,
+            )
+          >();
+
   void qnn_sample_app_register_op_packages_async(
     ffi.Pointer<QnnSampleApp> app,
     QnnAsyncCallback callback,
@@ -826,6 +2298,36 @@ class QnnWrapperBindings {
             )
           >();
 
+  void qnn_sample_app_swap_model_async(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Char> modelPath,
+    QnnAsyncCallback callback,
+    ffi.Pointer<ffi.Void> userData,
+  ) {
+    return _qnn_sample_app_swap_model_async(app, modelPath, callback, userData);
+  }
+
+  late final _qnn_sample_app_swap_model_asyncPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Void Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<ffi.Char>,
+        QnnAsyncCallback,
+        ffi.Pointer<ffi.Void>,
+      )
+    >
+  >('qnn_sample_app_swap_model_async');
+  late final _qnn_sample_app_swap_model_async =
+      _qnn_sample_app_swap_model_asyncPtr
+          .asFunction<
+            void Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<ffi.Char>,
+              QnnAsyncCallback,
+              ffi.Pointer<ffi.Void>,
+            )
+          >();
+
   void qnn_sample_app_get_backend_build_id_async(
     ffi.Pointer<QnnSampleApp> app,
     QnnStringCallback callback,
@@ -999,23 +2501,173 @@ class QnnWrapperBindings {
     );
   }
 
-  late final _qnn_sample_app_get_float_outputs_asyncPtr = _lookup<
+  late final _qnn_sample_app_get_float_outputs_asyncPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Void Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        QnnFloatOutputCallback,
+        ffi.Pointer<ffi.Void>,
+      )
+    >
+  >('qnn_sample_app_get_float_outputs_async');
+  late final _qnn_sample_app_get_float_outputs_async =
+      _qnn_sample_app_get_float_outputs_asyncPtr
+          .asFunction<
+            void Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              QnnFloatOutputCallback,
+              ffi.Pointer<ffi.Void>,
+            )
+          >();
+
+  /// 异步推理：inputs/outputs 指向的缓冲区在回调返回前必须保持有效
+  void qnn_sample_app_infer_async(
+    ffi.Pointer<QnnSampleApp> app,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> inputs,
+    ffi.Pointer<ffi.Size> sizes,
+    int numInputs,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> outputs,
+    ffi.Pointer<ffi.Size> capacities,
+    int numOutputs,
+    int graphIdx,
+    QnnAsyncCallback callback,
+    ffi.Pointer<ffi.Void> userData,
+  ) {
+    return _qnn_sample_app_infer_async(
+      app,
+      inputs,
+      sizes,
+      numInputs,
+      outputs,
+      capacities,
+      numOutputs,
+      graphIdx,
+      callback,
+      userData,
+    );
+  }
+
+  late final _qnn_sample_app_infer_asyncPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Void Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        ffi.Int,
+        QnnAsyncCallback,
+        ffi.Pointer<ffi.Void>,
+      )
+    >
+  >('qnn_sample_app_infer_async');
+  late final _qnn_sample_app_infer_async =
+      _qnn_sample_app_infer_asyncPtr
+          .asFunction<
+            void Function(
+              ffi.Pointer<QnnSampleApp>,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              int,
+              QnnAsyncCallback,
+              ffi.Pointer<ffi.Void>,
+            )
+          >();
+
+  void qnn_sample_app_warmup_async(
+    ffi.Pointer<QnnSampleApp> app,
+    int runs,
+    int graphIdx,
+    QnnWarmupInput input,
+    QnnAsyncCallback callback,
+    ffi.Pointer<ffi.Void> userData,
+  ) {
+    return _qnn_sample_app_warmup_async(
+      app,
+      runs,
+      graphIdx,
+      input.value,
+      callback,
+      userData,
+    );
+  }
+
+  late final _qnn_sample_app_warmup_asyncPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Void Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.UnsignedInt,
+        ffi.Int,
+        ffi.UnsignedInt,
+        QnnAsyncCallback,
+        ffi.Pointer<ffi.Void>,
+      )
+    >
+  >('qnn_sample_app_warmup_async');
+  late final _qnn_sample_app_warmup_async =
+      _qnn_sample_app_warmup_asyncPtr
+          .asFunction<
+            void Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              int,
+              int,
+              QnnAsyncCallback,
+              ffi.Pointer<ffi.Void>,
+            )
+          >();
+
+  /// 异步执行该组，调用线程可以继续填充下一组，本函数从不阻塞。
+  /// backend 支持 graphExecuteAsync 时直接入队，完成回调在 backend 的通知线程上调用；
+  /// 不支持时退回实例工作线程上的同步执行，回调在工作线程上调用。
+  /// 在途数达到 qnn_sample_app_set_max_in_flight 设置的上限时返回 QNN_STATUS_BUSY，
+  /// 组保持已 acquire 状态且回调不会被调用，可稍后重试；其余情况返回 QNN_STATUS_SUCCESS，
+  /// 结果通过回调给出，入队失败的回调投递到实例工作线程，不会在调用线程上执行。
+  QnnStatus qnn_sample_app_submit_tensor_set_async(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    int setIdx,
+    QnnAsyncCallback callback,
+    ffi.Pointer<ffi.Void> userData,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_sample_app_submit_tensor_set_async(
+        app,
+        graphIdx,
+        setIdx,
+        callback,
+        userData,
+      ),
+    );
+  }
+
+  late final _qnn_sample_app_submit_tensor_set_asyncPtr = _lookup<
     ffi.NativeFunction<
-      ffi.Void Function(
+      ffi.UnsignedInt Function(
         ffi.Pointer<QnnSampleApp>,
         ffi.Int,
-        QnnFloatOutputCallback,
+        ffi.UnsignedInt,
+        QnnAsyncCallback,
         ffi.Pointer<ffi.Void>,
       )
     >
-  >('qnn_sample_app_get_float_outputs_async');
-  late final _qnn_sample_app_get_float_outputs_async =
-      _qnn_sample_app_get_float_outputs_asyncPtr
+  >('qnn_sample_app_submit_tensor_set_async');
+  late final _qnn_sample_app_submit_tensor_set_async =
+      _qnn_sample_app_submit_tensor_set_asyncPtr
           .asFunction<
-            void Function(
+            int Function(
               ffi.Pointer<QnnSampleApp>,
               int,
-              QnnFloatOutputCallback,
+              int,
+              QnnAsyncCallback,
               ffi.Pointer<ffi.Void>,
             )
           >();
@@ -1046,6 +2698,184 @@ class QnnWrapperBindings {
               ffi.Pointer<ffi.Void>,
             )
           >();
+
+  ffi.Pointer<QnnBatchScheduler> qnn_batch_scheduler_create(
+    ffi.Pointer<QnnSampleApp> app,
+    int graphIdx,
+    int maxDelayUs,
+  ) {
+    return _qnn_batch_scheduler_create(app, graphIdx, maxDelayUs);
+  }
+
+  late final _qnn_batch_scheduler_createPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.Pointer<QnnBatchScheduler> Function(
+        ffi.Pointer<QnnSampleApp>,
+        ffi.Int,
+        ffi.UnsignedInt,
+      )
+    >
+  >('qnn_batch_scheduler_create');
+  late final _qnn_batch_scheduler_create =
+      _qnn_batch_scheduler_createPtr
+          .asFunction<
+            ffi.Pointer<QnnBatchScheduler> Function(
+              ffi.Pointer<QnnSampleApp>,
+              int,
+              int,
+            )
+          >();
+
+  /// 执行完已排队的请求（并调用其回调）后销毁；会等待 app 工作线程，不能在异步回调中调用
+  void qnn_batch_scheduler_destroy(ffi.Pointer<QnnBatchScheduler> scheduler) {
+    return _qnn_batch_scheduler_destroy(scheduler);
+  }
+
+  late final _qnn_batch_scheduler_destroyPtr = _lookup<
+    ffi.NativeFunction<ffi.Void Function(ffi.Pointer<QnnBatchScheduler>)>
+  >('qnn_batch_scheduler_destroy');
+  late final _qnn_batch_scheduler_destroy =
+      _qnn_batch_scheduler_destroyPtr
+          .asFunction<void Function(ffi.Pointer<QnnBatchScheduler>)>();
+
+  int qnn_batch_scheduler_get_batch_size(
+    ffi.Pointer<QnnBatchScheduler> scheduler,
+  ) {
+    return _qnn_batch_scheduler_get_batch_size(scheduler);
+  }
+
+  late final _qnn_batch_scheduler_get_batch_sizePtr = _lookup<
+    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<QnnBatchScheduler>)>
+  >('qnn_batch_scheduler_get_batch_size');
+  late final _qnn_batch_scheduler_get_batch_size =
+      _qnn_batch_scheduler_get_batch_sizePtr
+          .asFunction<int Function(ffi.Pointer<QnnBatchScheduler>)>();
+
+  /// 提交单样本请求。sizes 为各输入单样本元素个数（张量元素个数 / batch），输入在提交时即被拷贝；
+  /// outputs 为单样本输出缓冲区，capacities 以 float 计，在回调被调用前必须保持有效。
+  /// 回调在 app 的工作线程中执行，请勿在回调中销毁调度器或 app。
+  QnnStatus qnn_batch_scheduler_submit(
+    ffi.Pointer<QnnBatchScheduler> scheduler,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> inputs,
+    ffi.Pointer<ffi.Size> sizes,
+    int numInputs,
+    ffi.Pointer<ffi.Pointer<ffi.Float>> outputs,
+    ffi.Pointer<ffi.Size> capacities,
+    int numOutputs,
+    QnnAsyncCallback callback,
+    ffi.Pointer<ffi.Void> userData,
+  ) {
+    return QnnStatus.fromValue(
+      _qnn_batch_scheduler_submit(
+        scheduler,
+        inputs,
+        sizes,
+        numInputs,
+        outputs,
+        capacities,
+        numOutputs,
+        callback,
+        userData,
+      ),
+    );
+  }
+
+  late final _qnn_batch_scheduler_submitPtr = _lookup<
+    ffi.NativeFunction<
+      ffi.UnsignedInt Function(
+        ffi.Pointer<QnnBatchScheduler>,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        ffi.Pointer<ffi.Pointer<ffi.Float>>,
+        ffi.Pointer<ffi.Size>,
+        ffi.Size,
+        QnnAsyncCallback,
+        ffi.Pointer<ffi.Void>,
+      )
+    >
+  >('qnn_batch_scheduler_submit');
+  late final _qnn_batch_scheduler_submit =
+      _qnn_batch_scheduler_submitPtr
+          .asFunction<
+            int Function(
+              ffi.Pointer<QnnBatchScheduler>,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              ffi.Pointer<ffi.Pointer<ffi.Float>>,
+              ffi.Pointer<ffi.Size>,
+              int,
+              QnnAsyncCallback,
+              ffi.Pointer<ffi.Void>,
+            )
+          >();
+
+  /// 不等待凑满，立即执行当前已排队的请求
+  void qnn_batch_scheduler_flush(ffi.Pointer<QnnBatchScheduler> scheduler) {
+    return _qnn_batch_scheduler_flush(scheduler);
+  }
+
+  late final _qnn_batch_scheduler_flushPtr = _lookup<
+    ffi.NativeFunction<ffi.Void Function(ffi.Pointer<QnnBatchScheduler>)>
+  >('qnn_batch_scheduler_flush');
+  late final _qnn_batch_scheduler_flush =
+      _qnn_batch_scheduler_flushPtr
+          .asFunction<void Function(ffi.Pointer<QnnBatchScheduler>)>();
+
+  /// 进程级时间线，导出为 Trace Event Format JSON，可直接用 chrome://tracing 或 Perfetto 打开。
+  /// 包含 FFI 入口、实例工作线程排队等待、量化/反量化、graphExecute，
+  /// 以及开启了 qnn_sample_app_set_profiling 的实例的 backend 事件（按层级放在对应的执行区间内）。
+  /// 事件缓冲最多 capacity 个（0 使用默认 65536），满了丢弃最旧的；start 会清空之前的事件。
+  /// stop 后事件保留，可继续导出；get_json 返回的字符串需要使用 free() 释放。
+  void qnn_trace_start(int capacity) {
+    return _qnn_trace_start(capacity);
+  }
+
+  late final _qnn_trace_startPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Size)>>(
+        'qnn_trace_start',
+      );
+  late final _qnn_trace_start =
+      _qnn_trace_startPtr.asFunction<void Function(int)>();
+
+  void qnn_trace_stop() {
+    return _qnn_trace_stop();
+  }
+
+  late final _qnn_trace_stopPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function()>>('qnn_trace_stop');
+  late final _qnn_trace_stop = _qnn_trace_stopPtr.asFunction<void Function()>();
+
+  QnnStatus qnn_trace_write(ffi.Pointer<ffi.Char> path) {
+    return QnnStatus.fromValue(_qnn_trace_write(path));
+  }
+
+  late final _qnn_trace_writePtr = _lookup<
+    ffi.NativeFunction<ffi.UnsignedInt Function(ffi.Pointer<ffi.Char>)>
+  >('qnn_trace_write');
+  late final _qnn_trace_write =
+      _qnn_trace_writePtr.asFunction<int Function(ffi.Pointer<ffi.Char>)>();
+
+  ffi.Pointer<ffi.Char> qnn_trace_get_json() {
+    return _qnn_trace_get_json();
+  }
+
+  late final _qnn_trace_get_jsonPtr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<ffi.Char> Function()>>(
+        'qnn_trace_get_json',
+      );
+  late final _qnn_trace_get_json =
+      _qnn_trace_get_jsonPtr.asFunction<ffi.Pointer<ffi.Char> Function()>();
+
+  void qnn_trace_clear() {
+    return _qnn_trace_clear();
+  }
+
+  late final _qnn_trace_clearPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function()>>('qnn_trace_clear');
+  late final _qnn_trace_clear =
+      _qnn_trace_clearPtr.asFunction<void Function()>();
 }
 
 /// 定义状态码，和 C++ 中 sample_app::StatusCode 保持一致
@@ -1055,7 +2885,9 @@ enum QnnStatus {
   QNN_STATUS_FAILURE_INPUT_LIST_EXHAUSTED(2),
   QNN_STATUS_FAILURE_SYSTEM_ERROR(3),
   QNN_STATUS_FAILURE_SYSTEM_COMMUNICATION_ERROR(4),
-  QNN_STATUS_FEATURE_UNSUPPORTED(5);
+  QNN_STATUS_FEATURE_UNSUPPORTED(5),
+  /// 资源暂时用尽，调用未生效，可稍后重试
+  QNN_STATUS_BUSY(6);
 
   final int value;
   const QnnStatus(this.value);
@@ -1067,6 +2899,7 @@ enum QnnStatus {
     3 => QNN_STATUS_FAILURE_SYSTEM_ERROR,
     4 => QNN_STATUS_FAILURE_SYSTEM_COMMUNICATION_ERROR,
     5 => QNN_STATUS_FEATURE_UNSUPPORTED,
+    6 => QNN_STATUS_BUSY,
     _ => throw ArgumentError("Unknown value for QnnStatus: $value"),
   };
 }
@@ -1124,19 +2957,487 @@ enum QnnHtpPrecisionMode {
   };
 }
 
-/// 定义HTP后端配置结构体
+/// 定义HTP后端配置结构体，先用 qnn_htp_config_init 填充默认值再修改需要的字段。
+/// 在 finalize 之前校验并应用到每张图，只对 .so 模型生效（.bin 和编译缓存命中时图已编译完成）；
+/// 通过本结构体给出的取值无效、设备不支持或 graphSetConfig 失败时创建失败；不传时使用默认配置，失败只记录警告
 final class QnnBackendHtpConfig extends ffi.Struct {
-  /// 优化级别(0-3)，3为最佳性能
+  /// 优化级别(1-3)，3为最佳性能，默认 2
   @ffi.Int()
   external int optimizationLevel;
 
-  /// 精度模式
+  /// 精度模式，默认 FLOAT16，DEFAULT 表示由 backend 决定
   @ffi.UnsignedInt()
   external int precisionMode;
+
+  /// VTCM 大小(MB)，0 表示设备最大值，不能超过设备 VTCM 大小
+  @ffi.UnsignedInt()
+  external int vtcmSizeMb;
+
+  /// HVX 线程数，0 表示不限制
+  @ffi.UnsignedLongLong()
+  external int numHvxThreads;
+
+  /// -1 自动（默认），仅在设备报告支持时启用；0 关闭；1 启用，需要设备支持
+  @ffi.Int()
+  external int enableDlbc;
+
+  /// 1 启用权重 DLBC，默认关闭
+  @ffi.Int()
+  external int enableDlbcWeights;
+}
+
+/// 定义张量数据类型，取值和 QNN 中 Qnn_DataType_t 保持一致
+enum QnnTensorDataType {
+  QNN_TENSOR_DATA_TYPE_INT_8(8),
+  QNN_TENSOR_DATA_TYPE_INT_16(22),
+  QNN_TENSOR_DATA_TYPE_INT_32(50),
+  QNN_TENSOR_DATA_TYPE_INT_64(100),
+  QNN_TENSOR_DATA_TYPE_UINT_8(264),
+  QNN_TENSOR_DATA_TYPE_UINT_16(278),
+  QNN_TENSOR_DATA_TYPE_UINT_32(306),
+  QNN_TENSOR_DATA_TYPE_UINT_64(356),
+  QNN_TENSOR_DATA_TYPE_FLOAT_16(534),
+  QNN_TENSOR_DATA_TYPE_FLOAT_32(562),
+  QNN_TENSOR_DATA_TYPE_SFIXED_POINT_8(776),
+  QNN_TENSOR_DATA_TYPE_SFIXED_POINT_16(790),
+  QNN_TENSOR_DATA_TYPE_UFIXED_POINT_8(1032),
+  QNN_TENSOR_DATA_TYPE_UFIXED_POINT_16(1046),
+  QNN_TENSOR_DATA_TYPE_BOOL_8(1288),
+  QNN_TENSOR_DATA_TYPE_UNDEFINED(2147483647);
+
+  final int value;
+  const QnnTensorDataType(this.value);
+
+  static QnnTensorDataType fromValue(int value) => switch (value) {
+    8 => QNN_TENSOR_DATA_TYPE_INT_8,
+    22 => QNN_TENSOR_DATA_TYPE_INT_16,
+    50 => QNN_TENSOR_DATA_TYPE_INT_32,
+    100 => QNN_TENSOR_DATA_TYPE_INT_64,
+    264 => QNN_TENSOR_DATA_TYPE_UINT_8,
+    278 => QNN_TENSOR_DATA_TYPE_UINT_16,
+    306 => QNN_TENSOR_DATA_TYPE_UINT_32,
+    356 => QNN_TENSOR_DATA_TYPE_UINT_64,
+    534 => QNN_TENSOR_DATA_TYPE_FLOAT_16,
+    562 => QNN_TENSOR_DATA_TYPE_FLOAT_32,
+    776 => QNN_TENSOR_DATA_TYPE_SFIXED_POINT_8,
+    790 => QNN_TENSOR_DATA_TYPE_SFIXED_POINT_16,
+    1032 => QNN_TENSOR_DATA_TYPE_UFIXED_POINT_8,
+    1046 => QNN_TENSOR_DATA_TYPE_UFIXED_POINT_16,
+    1288 => QNN_TENSOR_DATA_TYPE_BOOL_8,
+    2147483647 => QNN_TENSOR_DATA_TYPE_UNDEFINED,
+    _ => throw ArgumentError("Unknown value for QnnTensorDataType: $value"),
+  };
+}
+
+/// 张量视图：借用 QnnSampleApp 内部持久化张量的缓冲区，不拥有内存，调用者不能释放。
+/// data/dims/name 在切换图或销毁实例之前一直有效。
+/// scale/offset 为量化参数，仅对 FIXED_POINT 类型有意义，反量化公式为 (q + offset) * scale。
+final class QnnTensorView extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> name;
+
+  external ffi.Pointer<ffi.Void> data;
+
+  /// 缓冲区字节数
+  @ffi.Size()
+  external int dataSize;
+
+  @ffi.UnsignedInt()
+  external int dataType;
+
+  @ffi.UnsignedInt()
+  external int rank;
+
+  external ffi.Pointer<ffi.UnsignedInt> dims;
+
+  @ffi.Float()
+  external double scale;
+
+  @ffi.Int()
+  external int offset;
+}
+
+/// context binary 加载统计，字段含义同 C++ 中 sample_app::BinaryLoadStats
+final class QnnBinaryLoadStats extends ffi.Struct {
+  /// 1 表示通过 mmap 加载
+  @ffi.Int()
+  external int mapped;
+
+  @ffi.UnsignedLongLong()
+  external int fileSize;
+
+  @ffi.Double()
+  external double readMs;
+
+  @ffi.Double()
+  external double binaryInfoMs;
+
+  @ffi.Double()
+  external double contextCreateMs;
+
+  @ffi.Double()
+  external double totalMs;
+
+  @ffi.UnsignedLongLong()
+  external int peakRssBeforeKb;
+
+  @ffi.UnsignedLongLong()
+  external int peakRssAfterKb;
+
+  @ffi.UnsignedLongLong()
+  external int heapBytesAvoided;
+}
+
+/// 实例创建各阶段耗时（毫秒）与内存统计，字段含义同 C++ 中 sample_app::StartupStats
+final class QnnStartupStats extends ffi.Struct {
+  /// 1 表示复用了已有的共享 backend，backend 各项为 0
+  @ffi.Int()
+  external int backendShared;
+
+  @ffi.Double()
+  external double backendAcquireMs;
+
+  /// dlOpen + QnnInterface_getProviders
+  @ffi.Double()
+  external double backendLoadMs;
+
+  @ffi.Double()
+  external double backendCreateMs;
+
+  @ffi.Double()
+  external double deviceCreateMs;
+
+  @ffi.Double()
+  external double powerConfigMs;
+
+  @ffi.Double()
+  external double modelLoadMs;
+
+  @ffi.Double()
+  external double opPackagesMs;
+
+  @ffi.Double()
+  external double cacheLookupMs;
+
+  /// contextCreate 或 contextCreateFromBinary
+  @ffi.Double()
+  external double contextCreateMs;
+
+  @ffi.Double()
+  external double composeGraphsMs;
+
+  @ffi.Double()
+  external double graphConfigMs;
+
+  @ffi.Double()
+  external double finalizeGraphsMs;
+
+  @ffi.Double()
+  external double cacheStoreMs;
+
+  @ffi.Int()
+  external int binaryMapped;
+
+  @ffi.UnsignedLongLong()
+  external int binarySize;
+
+  @ffi.Double()
+  external double binaryReadMs;
+
+  /// systemContextGetBinaryInfo（含 copyMetadataMs）或 sidecar 读取
+  @ffi.Double()
+  external double binaryInfoMs;
+
+  @ffi.Double()
+  external double copyMetadataMs;
+
+  @ffi.Double()
+  external double graphRetrieveMs;
+
+  @ffi.UnsignedLongLong()
+  external int heapBytesAllocated;
+
+  @ffi.UnsignedLongLong()
+  external int peakRssBeforeKb;
+
+  @ffi.UnsignedLongLong()
+  external int peakRssAfterKb;
+
+  @ffi.Double()
+  external double totalMs;
+
+  /// 图信息来自 "<binary>.graphinfo"，跳过了 binary info 解析
+  @ffi.Int()
+  external int metadataFromSidecar;
+
+  /// 创建时自动预热所有图的耗时，未启用为 0
+  @ffi.Double()
+  external double warmupMs;
+}
+
+/// 创建实例的可选项，字段为 0/NULL 时使用默认行为
+final class QnnCreateOptions extends ffi.Struct {
+  /// 编译缓存目录，含义同 qnn_sample_app_create_with_cache
+  external ffi.Pointer<ffi.Char> cacheDir;
+
+  @ffi.UnsignedLongLong()
+  external int maxCacheBytes;
+
+  /// 大于 0 时在创建结束前对每张图自动预热该次数
+  @ffi.UnsignedInt()
+  external int warmupRuns;
+
+  /// HTP 图配置，NULL 使用默认值，非 HTP 后端忽略
+  external ffi.Pointer<QnnBackendHtpConfig> htpConfig;
+}
+
+/// 预热时输入的填充方式，与 C++ 中 sample_app::WarmupInput 保持一致
+enum QnnWarmupInput {
+  QNN_WARMUP_INPUT_ZEROS(0),
+  /// 固定种子的伪随机数据
+  QNN_WARMUP_INPUT_RANDOM(1);
+
+  final int value;
+  const QnnWarmupInput(this.value);
+
+  static QnnWarmupInput fromValue(int value) => switch (value) {
+    0 => QNN_WARMUP_INPUT_ZEROS,
+    1 => QNN_WARMUP_INPUT_RANDOM,
+    _ => throw ArgumentError("Unknown value for QnnWarmupInput: $value"),
+  };
+}
+
+/// 预热得到的单次执行耗时（毫秒）
+final class QnnWarmupStats extends ffi.Struct {
+  @ffi.UnsignedInt()
+  external int runs;
+
+  /// 第一次执行
+  @ffi.Double()
+  external double firstRunMs;
+
+  /// 其余各次的中位数
+  @ffi.Double()
+  external double steadyStateMs;
+
+  @ffi.Double()
+  external double minMs;
+
+  @ffi.Double()
+  external double maxMs;
+
+  @ffi.Double()
+  external double totalMs;
+}
+
+/// 耗时分位数（微秒），来自常开的对数直方图，相对误差约 3%
+final class QnnLatencySummary extends ffi.Struct {
+  @ffi.UnsignedLongLong()
+  external int count;
+
+  @ffi.Double()
+  external double meanUs;
+
+  @ffi.Double()
+  external double p50Us;
+
+  @ffi.Double()
+  external double p90Us;
+
+  @ffi.Double()
+  external double p99Us;
+
+  /// 精确值
+  @ffi.Double()
+  external double maxUs;
+}
+
+/// 实例的运行时指标
+final class QnnMetrics extends ffi.Struct {
+  /// float 输入量化写入张量
+  external QnnLatencySummary inputStaging;
+
+  /// graphExecute，原生异步执行为提交到完成
+  external QnnLatencySummary execute;
+
+  /// 输出反量化为 float
+  external QnnLatencySummary outputConversion;
+
+  /// qnn_sample_app_infer 端到端
+  external QnnLatencySummary infer;
+
+  /// 执行次数，含失败
+  @ffi.UnsignedLongLong()
+  external int executions;
+
+  @ffi.UnsignedLongLong()
+  external int failures;
+
+  /// 输入/输出 float 数据的字节数
+  @ffi.UnsignedLongLong()
+  external int bytesConverted;
+}
+
+/// 性能分析级别，与 C++ 中 sample_app::ProfilingLevel 保持一致
+enum QnnProfilingLevel {
+  QNN_PROFILING_LEVEL_OFF(0),
+  /// 图级别的执行耗时
+  QNN_PROFILING_LEVEL_BASIC(1),
+  /// 额外包含逐节点的子事件
+  QNN_PROFILING_LEVEL_DETAILED(2);
+
+  final int value;
+  const QnnProfilingLevel(this.value);
+
+  static QnnProfilingLevel fromValue(int value) => switch (value) {
+    0 => QNN_PROFILING_LEVEL_OFF,
+    1 => QNN_PROFILING_LEVEL_BASIC,
+    2 => QNN_PROFILING_LEVEL_DETAILED,
+    _ => throw ArgumentError("Unknown value for QnnProfilingLevel: $value"),
+  };
+}
+
+/// 一个性能分析事件，事件树按先序遍历展开，通过 parent 还原层级
+final class QnnProfileEvent extends ffi.Struct {
+  @ffi.UnsignedLongLong()
+  external int eventId;
+
+  /// 事件或节点名，过长时截断
+  @ffi.Array.multi([128])
+  external ffi.Array<ffi.Char> identifier;
+
+  /// QnnProfile_EventType_t
+  @ffi.UnsignedInt()
+  external int type;
+
+  /// QnnProfile_EventUnit_t
+  @ffi.UnsignedInt()
+  external int unit;
+
+  @ffi.UnsignedLongLong()
+  external int value;
+
+  /// 父事件下标，顶层事件为 -1
+  @ffi.Int()
+  external int parent;
+
+  @ffi.UnsignedInt()
+  external int depth;
+}
+
+/// 一次执行的性能分析概要
+final class QnnExecutionProfileInfo extends ffi.Struct {
+  /// 实例内递增的执行序号
+  @ffi.UnsignedLongLong()
+  external int sequence;
+
+  @ffi.Int()
+  external int graphIdx;
+
+  /// 1 表示原生异步执行
+  @ffi.Int()
+  external int async$1;
+
+  /// 单调时钟时间戳（微秒）
+  @ffi.UnsignedLongLong()
+  external int startUs;
+
+  /// 同步执行为 graphExecute 耗时，异步执行为提交到完成
+  @ffi.Double()
+  external double wallMs;
+
+  @ffi.Size()
+  external int numEvents;
+}
+
+/// HTP 性能档位，与 C++ 中 sample_app::PowerProfile 保持一致
+enum QnnPowerProfile {
+  /// 锁定 turbo，延迟最低
+  QNN_POWER_PROFILE_BURST(0),
+  /// nom+ 附近，适合长时间连续推理
+  QNN_POWER_PROFILE_SUSTAINED(1),
+  /// DCVS 按负载调整
+  QNN_POWER_PROFILE_BALANCED(2),
+  /// 省电，适合空闲或后台任务
+  QNN_POWER_PROFILE_LOW_POWER(3);
+
+  final int value;
+  const QnnPowerProfile(this.value);
+
+  static QnnPowerProfile fromValue(int value) => switch (value) {
+    0 => QNN_POWER_PROFILE_BURST,
+    1 => QNN_POWER_PROFILE_SUSTAINED,
+    2 => QNN_POWER_PROFILE_BALANCED,
+    3 => QNN_POWER_PROFILE_LOW_POWER,
+    _ => throw ArgumentError("Unknown value for QnnPowerProfile: $value"),
+  };
+}
+
+/// 共享内存分配器类型，和 C++ 中 sharedmem::AllocatorType 保持一致
+enum QnnSharedMemoryType {
+  /// 优先 rpcmem，不可用时使用 memfd
+  QNN_SHARED_MEMORY_AUTO(0),
+  QNN_SHARED_MEMORY_RPCMEM(1),
+  QNN_SHARED_MEMORY_MEMFD(2);
+
+  final int value;
+  const QnnSharedMemoryType(this.value);
+
+  static QnnSharedMemoryType fromValue(int value) => switch (value) {
+    0 => QNN_SHARED_MEMORY_AUTO,
+    1 => QNN_SHARED_MEMORY_RPCMEM,
+    2 => QNN_SHARED_MEMORY_MEMFD,
+    _ => throw ArgumentError("Unknown value for QnnSharedMemoryType: $value"),
+  };
 }
 
 final class QnnSampleApp extends ffi.Opaque {}
 
+final class QnnModelLoader extends ffi.Opaque {}
+
+/// 分阶段加载的当前阶段，与 C++ 中 sample_app::LoadStage 保持一致
+enum QnnLoadStage {
+  QNN_LOAD_STAGE_PENDING(0),
+  /// 并行：backend 初始化 + 模型文件预读
+  QNN_LOAD_STAGE_PREPARING(1),
+  /// context 创建/反序列化、finalize、预热
+  QNN_LOAD_STAGE_CREATING(2),
+  QNN_LOAD_STAGE_READY(3),
+  QNN_LOAD_STAGE_FAILED(4);
+
+  final int value;
+  const QnnLoadStage(this.value);
+
+  static QnnLoadStage fromValue(int value) => switch (value) {
+    0 => QNN_LOAD_STAGE_PENDING,
+    1 => QNN_LOAD_STAGE_PREPARING,
+    2 => QNN_LOAD_STAGE_CREATING,
+    3 => QNN_LOAD_STAGE_READY,
+    4 => QNN_LOAD_STAGE_FAILED,
+    _ => throw ArgumentError("Unknown value for QnnLoadStage: $value"),
+  };
+}
+
+/// 分阶段加载的耗时（毫秒），backendMs 与 prefetchMs 并行，prepareMs 为该阶段的实际耗时
+final class QnnLoadTimings extends ffi.Struct {
+  @ffi.Double()
+  external double queuedMs;
+
+  @ffi.Double()
+  external double backendMs;
+
+  @ffi.Double()
+  external double prefetchMs;
+
+  @ffi.Double()
+  external double prepareMs;
+
+  @ffi.Double()
+  external double createMs;
+
+  @ffi.Double()
+  external double totalMs;
+}
+
 /// 定义异步回调函数类型
 typedef QnnAsyncCallback =
     ffi.Pointer<ffi.NativeFunction<QnnAsyncCallbackFunction>>;
@@ -1184,3 +3485,5 @@ typedef QnnArchVersionCallbackFunction =
     ffi.Void Function(ffi.Int version, ffi.Pointer<ffi.Void> userData);
 typedef DartQnnArchVersionCallbackFunction =
     void Function(int version, ffi.Pointer<ffi.Void> userData);
+
+final class QnnBatchScheduler extends ffi.Opaque {}
@@ -0,0 +1,183 @@
+#include "BackendRegistry.hpp"
+
+#include <chrono>
+
+#include "DynamicLoadUtil.hpp"
+#include "Logger.hpp"
+#include "PAL/DynamicLoading.hpp"
+
+using namespace qnn;
+using namespace qnn::tools;
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+sample_app::SharedBackend::~SharedBackend() {
+  // 先停止空闲放松线程，再销毁它使用的 powerConfigId
+  powerManager.reset();
+  if (powerConfigId != 0 && nullptr != perfInfra.destroyPowerConfigId) {
+    perfInfra.destroyPowerConfigId(powerConfigId);
+  }
+  if (nullptr != deviceHandle && nullptr != qnnInterface.deviceFree &&
+      QNN_SUCCESS != qnnInterface.deviceFree(deviceHandle)) {
+    QNN_ERROR("Could not free shared device");
+  }
+  if (nullptr != backendHandle && nullptr != qnnInterface.backendFree &&
+      QNN_BACKEND_NO_ERROR != qnnInterface.backendFree(backendHandle)) {
+    QNN_ERROR("Could not free shared backend");
+  }
+  if (nullptr != libraryHandle) {
+    pal::dynamicloading::dlClose(libraryHandle);
+  }
+  QNN_DEBUG("Released shared backend %s", backendPath.c_str());
+}
+
+sample_app::BackendRegistry &sample_app::BackendRegistry::instance() {
+  // 有意不析构：进程退出时仍可能有实例持有共享 backend
+  static BackendRegistry *registry = new BackendRegistry();
+  return *registry;
+}
+
+std::shared_ptr<sample_app::SharedBackend> sample_app::BackendRegistry::acquire(
+    const std::string &backendPath, bool customDeviceConfig, bool *created) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (created != nullptr) {
+    *created = false;
+  }
+  auto it = m_backends.find(backendPath);
+  if (it != m_backends.end()) {
+    if (auto backend = it->second.lock()) {
+      QNN_INFO("Reusing shared backend %s", backendPath.c_str());
+      return backend;
+    }
+  }
+  auto backend = create(backendPath, customDeviceConfig);
+  if (backend) {
+    m_backends[backendPath] = backend;
+    if (created != nullptr) {
+      *created = true;
+    }
+  }
+  return backend;
+}
+
+size_t sample_app::BackendRegistry::size() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  size_t count = 0;
+  for (auto &entry : m_backends) {
+    count += entry.second.expired() ? 0 : 1;
+  }
+  return count;
+}
+
+std::shared_ptr<sample_app::SharedBackend> sample_app::BackendRegistry::create(
+    const std::string &backendPath, bool customDeviceConfig) {
+  std::unique_ptr<SharedBackend> backend(new SharedBackend());
+  backend->backendPath = backendPath;
+  backend->isHtp       = backendPath.find("Htp") != std::string::npos;
+
+  auto stepStart = Clock::now();
+  QnnFunctionPointers functionPointers;
+  if (dynamicloadutil::StatusCode::SUCCESS !=
+      dynamicloadutil::getQnnFunctionPointers(
+          backendPath, "", &functionPointers, &backend->libraryHandle, false, nullptr)) {
+    QNN_ERROR("Failed to load backend %s", backendPath.c_str());
+    return nullptr;
+  }
+  backend->qnnInterface  = functionPointers.qnnInterface;
+  backend->timings.loadMs = elapsedMs(stepStart);
+
+  stepStart      = Clock::now();
+  auto qnnStatus = backend->qnnInterface.backendCreate(nullptr, nullptr, &backend->backendHandle);
+  if (QNN_BACKEND_NO_ERROR != qnnStatus) {
+    QNN_ERROR("Could not initialize backend due to error = %d", qnnStatus);
+    backend->backendHandle = nullptr;
+    return nullptr;
+  }
+  backend->timings.createMs = elapsedMs(stepStart);
+
+  if (!backend->isHtp) {
+    QNN_INFO("Created shared backend %s", backendPath.c_str());
+    return std::shared_ptr<SharedBackend>(backend.release(),
+                                          [this](SharedBackend *b) { release(b); });
+  }
+
+  // HTP：按当前平台的 SoC/arch 创建 device
+  stepStart = Clock::now();
+  QnnHtpDevice_CustomConfig_t socConfig{};
+  QnnHtpDevice_CustomConfig_t archConfig{};
+  QnnDevice_Config_t devConfigSoc{};
+  QnnDevice_Config_t devConfigArch{};
+  const QnnDevice_Config_t *deviceConfigs[3] = {nullptr, nullptr, nullptr};
+  const QnnDevice_PlatformInfo_t *platformInfo = nullptr;
+  if (customDeviceConfig && nullptr != backend->qnnInterface.deviceGetPlatformInfo &&
+      QNN_SUCCESS == backend->qnnInterface.deviceGetPlatformInfo(nullptr, &platformInfo) &&
+      nullptr != platformInfo && platformInfo->v1.numHwDevices > 0 &&
+      nullptr != platformInfo->v1.hwDevices[0].v1.deviceInfoExtension) {
+    auto &onChipDevice = platformInfo->v1.hwDevices[0].v1.deviceInfoExtension->onChipDevice;
+    backend->socModel      = onChipDevice.socModel;
+    backend->vtcmSizeMb    = static_cast<uint32_t>(onChipDevice.vtcmSize);
+    backend->dlbcSupported = static_cast<int>(onChipDevice.dlbcSupport) == 1;
+    socConfig.option        = QNN_HTP_DEVICE_CONFIG_OPTION_SOC;
+    socConfig.socModel      = onChipDevice.socModel;
+    archConfig.option       = QNN_HTP_DEVICE_CONFIG_OPTION_ARCH;
+    archConfig.arch.arch     = onChipDevice.arch;
+    archConfig.arch.deviceId = 0;  // 默认设备ID为0
+    devConfigSoc.option        = QNN_DEVICE_CONFIG_OPTION_CUSTOM;
+    devConfigSoc.customConfig  = &socConfig;
+    devConfigArch.option       = QNN_DEVICE_CONFIG_OPTION_CUSTOM;
+    devConfigArch.customConfig = &archConfig;
+    deviceConfigs[0] = &devConfigSoc;
+    deviceConfigs[1] = &devConfigArch;
+  }
+  if (nullptr != platformInfo && nullptr != backend->qnnInterface.deviceFreePlatformInfo) {
+    backend->qnnInterface.deviceFreePlatformInfo(nullptr, platformInfo);
+  }
+  if (nullptr != backend->qnnInterface.deviceCreate) {
+    qnnStatus = backend->qnnInterface.deviceCreate(
+        nullptr, deviceConfigs[0] != nullptr ? deviceConfigs : nullptr, &backend->deviceHandle);
+    if (QNN_SUCCESS != qnnStatus) {
+      QNN_WARN("Failed to create shared device: %d", qnnStatus);
+      backend->deviceHandle = nullptr;
+    }
+  }
+
+  backend->timings.deviceCreateMs = elapsedMs(stepStart);
+
+  // 配置性能基础设施 (Performance Infrastructure)，整个进程只投一票
+  stepStart = Clock::now();
+  QnnDevice_Infrastructure_t deviceInfra = nullptr;
+  if (nullptr != backend->deviceHandle &&
+      nullptr != backend->qnnInterface.deviceGetInfrastructure &&
+      QNN_SUCCESS == backend->qnnInterface.deviceGetInfrastructure(&deviceInfra) &&
+      nullptr != deviceInfra) {
+    backend->perfInfra = static_cast<QnnHtpDevice_Infrastructure_t *>(deviceInfra)->perfInfra;
+    uint32_t powerConfigId = 0;
+    if (QNN_SUCCESS == backend->perfInfra.createPowerConfigId(0, 0, &powerConfigId)) {
+      QNN_INFO("创建电源配置ID成功: %d", powerConfigId);
+      backend->powerConfigId = powerConfigId;
+      if (customDeviceConfig) {
+        backend->powerManager =
+            std::make_unique<PowerManager>(backend->perfInfra, powerConfigId);
+      }
+    }
+  }
+  backend->timings.powerConfigMs = elapsedMs(stepStart);
+
+  QNN_INFO("Created shared backend %s", backendPath.c_str());
+  return std::shared_ptr<SharedBackend>(backend.release(),
+                                        [this](SharedBackend *b) { release(b); });
+}
+
+void sample_app::BackendRegistry::release(SharedBackend *backend) {
+  // 持锁销毁，避免与 acquire 中的创建并发调用 backend 接口
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_backends.find(backend->backendPath);
+  if (it != m_backends.end() && it->second.expired()) {
+    m_backends.erase(it);
+  }
+  delete backend;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "HTP/QnnHtpDevice.h"
+#include "PowerManager.hpp"
+#include "SampleApp.hpp"
+
+namespace qnn {
+namespace tools {
+namespace sample_app {
+
+// 共享 backend 创建过程各步骤的耗时（毫秒）
+struct BackendTimings {
+  double loadMs         = 0.0;  // dlOpen + QnnInterface_getProviders
+  double createMs       = 0.0;  // backendCreate
+  double deviceCreateMs = 0.0;  // deviceGetPlatformInfo + deviceCreate
+  double powerConfigMs  = 0.0;  // createPowerConfigId + setPowerConfig
+};
+
+// 同一 backend 库在进程内共享的资源：库句柄、backend 句柄、device 句柄和 HTP 性能投票。
+// 由 BackendRegistry 创建，最后一个持有者释放时按 device -> backend -> 库的顺序销毁。
+struct SharedBackend {
+  std::string backendPath;
+  void *libraryHandle = nullptr;
+  QNN_INTERFACE_VER_TYPE qnnInterface;
+  Qnn_BackendHandle_t backendHandle = nullptr;
+  Qnn_DeviceHandle_t deviceHandle   = nullptr;
+  bool isHtp                        = false;
+  // HTP 平台信息，deviceGetPlatformInfo 不可用时为 0/false
+  uint32_t socModel   = 0;
+  uint32_t vtcmSizeMb = 0;
+  bool dlbcSupported  = false;
+  // HTP 性能基础设施，powerConfigId 为 0 表示未创建
+  QnnHtpDevice_PerfInfrastructure_t perfInfra{};
+  uint32_t powerConfigId = 0;
+  // 仅 customDeviceConfig 时创建，按执行自动在活跃/空闲档位间切换投票
+  std::unique_ptr<PowerManager> powerManager;
+  BackendTimings timings;
+
+  ~SharedBackend();
+};
+
+// 进程级 backend 注册表，按 backend 路径复用 SharedBackend，引用计数由 shared_ptr 维护
+class BackendRegistry {
+ public:
+  static BackendRegistry &instance();
+
+  // 首次获取时加载库、创建 backend/device 并投票；失败返回 nullptr。
+  // customDeviceConfig 为 true 时 HTP device 按当前 SoC/arch 配置并由 PowerManager 管理性能投票；
+  // created 非空时返回本次调用是否新建了 backend
+  std::shared_ptr<SharedBackend> acquire(const std::string &backendPath,
+                                         bool customDeviceConfig,
+                                         bool *created = nullptr);
+
+  // 当前存活的共享 backend 数量
+  size_t size();
+
+ private:
+  BackendRegistry() = default;
+
+  std::shared_ptr<SharedBackend> create(const std::string &backendPath, bool customDeviceConfig);
+
+  void release(SharedBackend *backend);
+
+  std::mutex m_mutex;
+  std::map<std::string, std::weak_ptr<SharedBackend>> m_backends;
+};
+
+}  // namespace sample_app
+}  // namespace tools
+}  // namespace qnn
@@ -0,0 +1,286 @@
+#include "BatchScheduler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "Logger.hpp"
+
+using namespace qnn;
+using namespace qnn::tools;
+
+// 单样本元素个数 = 张量总元素个数 / batch 维大小
+static bool sampleSize(const sample_app::TensorView &view, uint32_t &batch, size_t &size) {
+  if (view.rank == 0 || view.dims == nullptr || view.dims[0] == 0) {
+    return false;
+  }
+  size_t elements = 1;
+  for (uint32_t d = 1; d < view.rank; d++) {
+    elements *= view.dims[d];
+  }
+  batch = view.dims[0];
+  size  = elements;
+  return true;
+}
+
+sample_app::BatchScheduler::BatchScheduler(QnnSampleApp *app,
+                                           int graphIdx,
+                                           std::chrono::microseconds maxDelay,
+                                           Executor executor)
+    : m_app(app), m_graphIdx(graphIdx), m_maxDelay(maxDelay), m_executor(std::move(executor)) {
+  if (nullptr == m_app) {
+    throw std::runtime_error("BatchScheduler requires a valid QnnSampleApp");
+  }
+  uint32_t numInputs  = m_app->getNumInputTensors(m_graphIdx);
+  uint32_t numOutputs = m_app->getNumOutputTensors(m_graphIdx);
+  if (numInputs == 0 || numOutputs == 0) {
+    throw std::runtime_error("BatchScheduler: graph has no inputs or outputs");
+  }
+
+  bool batchKnown = false;
+  auto checkBatch = [&](const TensorView &view, std::vector<size_t> &sizes) {
+    uint32_t batch = 0;
+    size_t size    = 0;
+    if (!sampleSize(view, batch, size)) {
+      throw std::runtime_error(std::string("BatchScheduler: tensor ") + view.name +
+                               " has no batch dimension");
+    }
+    if (batchKnown && batch != m_batchSize) {
+      throw std::runtime_error(std::string("BatchScheduler: tensor ") + view.name +
+                               " batch dimension mismatch");
+    }
+    m_batchSize = batch;
+    batchKnown  = true;
+    sizes.push_back(size);
+  };
+
+  TensorView view;
+  for (uint32_t i = 0; i < numInputs; i++) {
+    if (StatusCode::SUCCESS != m_app->getInputTensorView(i, view, m_graphIdx)) {
+      throw std::runtime_error("BatchScheduler: failed to query input tensor");
+    }
+    checkBatch(view, m_inputSampleSizes);
+  }
+  for (uint32_t i = 0; i < numOutputs; i++) {
+    if (StatusCode::SUCCESS != m_app->getOutputTensorView(i, view, m_graphIdx)) {
+      throw std::runtime_error("BatchScheduler: failed to query output tensor");
+    }
+    checkBatch(view, m_outputSampleSizes);
+  }
+
+  if (!m_executor) {
+    m_ownQueue.reset(new taskqueue::TaskQueue(1));
+    taskqueue::TaskQueue *queue = m_ownQueue.get();
+    m_executor = [queue](std::function<void()> task) { queue->submit(std::move(task)); };
+  }
+  QNN_INFO("BatchScheduler: batch size %u, max delay %lld us",
+           m_batchSize,
+           static_cast<long long>(m_maxDelay.count()));
+
+  m_thread = std::thread(&BatchScheduler::dispatchLoop, this);
+}
+
+sample_app::BatchScheduler::~BatchScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+  // 调度线程退出前已把剩余请求交出，等它们在 executor 上执行完
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_idleCv.wait(lock, [this] { return m_outstanding == 0; });
+  lock.unlock();
+  m_ownQueue.reset();
+}
+
+std::shared_ptr<sample_app::BatchScheduler::Batch> sample_app::BatchScheduler::takeBatch() {
+  if (!m_freeBatches.empty()) {
+    std::shared_ptr<Batch> batch = std::move(m_freeBatches.back());
+    m_freeBatches.pop_back();
+    return batch;
+  }
+  auto batch = std::make_shared<Batch>();
+  for (auto size : m_inputSampleSizes) {
+    batch->inputs.emplace_back(size * m_batchSize, 0.0f);
+    batch->inputPtrs.push_back(batch->inputs.back().data());
+    batch->inputSizes.push_back(batch->inputs.back().size());
+  }
+  for (auto size : m_outputSampleSizes) {
+    batch->outputs.emplace_back(size * m_batchSize, 0.0f);
+    batch->outputPtrs.push_back(batch->outputs.back().data());
+    batch->outputCapacities.push_back(batch->outputs.back().size());
+  }
+  batch->requestOutputs.resize(m_batchSize * m_outputSampleSizes.size());
+  batch->callbacks.resize(m_batchSize);
+  return batch;
+}
+
+sample_app::StatusCode sample_app::BatchScheduler::submit(const float *const *inputs,
+                                                          const size_t *sizes,
+                                                          size_t numInputs,
+                                                          float *const *outputs,
+                                                          const size_t *capacities,
+                                                          size_t numOutputs,
+                                                          Callback callback) {
+  if (nullptr == inputs || nullptr == sizes || nullptr == outputs || nullptr == capacities) {
+    QNN_ERROR("BatchScheduler::submit: null argument");
+    return StatusCode::FAILURE;
+  }
+  if (numInputs != m_inputSampleSizes.size() || numOutputs != m_outputSampleSizes.size()) {
+    QNN_ERROR("BatchScheduler::submit: expected %zu inputs and %zu outputs, got %zu and %zu",
+              m_inputSampleSizes.size(),
+              m_outputSampleSizes.size(),
+              numInputs,
+              numOutputs);
+    return StatusCode::FAILURE;
+  }
+  for (size_t i = 0; i < numInputs; i++) {
+    if (nullptr == inputs[i] || sizes[i] != m_inputSampleSizes[i]) {
+      QNN_ERROR("BatchScheduler::submit: input %zu expects %zu elements, got %zu",
+                i,
+                m_inputSampleSizes[i],
+                sizes[i]);
+      return StatusCode::FAILURE;
+    }
+  }
+  for (size_t i = 0; i < numOutputs; i++) {
+    if (nullptr == outputs[i] || capacities[i] < m_outputSampleSizes[i]) {
+      QNN_ERROR("BatchScheduler::submit: output %zu needs %zu elements, capacity %zu",
+                i,
+                m_outputSampleSizes[i],
+                capacities[i]);
+      return StatusCode::FAILURE;
+    }
+  }
+
+  std::shared_ptr<Batch> full;
+  bool started = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stop) {
+      QNN_ERROR("BatchScheduler::submit: scheduler is shutting down");
+      return StatusCode::FAILURE;
+    }
+    if (!m_current) {
+      m_current                   = takeBatch();
+      m_current->firstEnqueueTime = std::chrono::steady_clock::now();
+      started                     = true;
+    }
+    // 调用者数据直接拷进本请求的槽位，不再经过单独的请求缓冲区
+    Batch &batch = *m_current;
+    size_t slot  = batch.count++;
+    for (size_t i = 0; i < numInputs; i++) {
+      size_t size = m_inputSampleSizes[i];
+      std::memcpy(batch.inputs[i].data() + slot * size, inputs[i], size * sizeof(float));
+    }
+    for (size_t i = 0; i < numOutputs; i++) {
+      batch.requestOutputs[slot * numOutputs + i] = outputs[i];
+    }
+    batch.callbacks[slot] = std::move(callback);
+    if (batch.count == m_batchSize) {
+      full = std::move(m_current);
+    }
+  }
+  if (full) {
+    dispatch(std::move(full));
+  } else if (started) {
+    // 唤醒调度线程按新 batch 的截止时间等待
+    m_cv.notify_one();
+  }
+  return StatusCode::SUCCESS;
+}
+
+void sample_app::BatchScheduler::flush() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_flushRequested = true;
+  }
+  m_cv.notify_one();
+}
+
+void sample_app::BatchScheduler::dispatch(std::shared_ptr<Batch> batch) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_outstanding++;
+  }
+  m_executor([this, batch]() {
+    runBatch(*batch);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_freeBatches.push_back(batch);
+    if (--m_outstanding == 0) {
+      m_idleCv.notify_all();
+    }
+  });
+}
+
+void sample_app::BatchScheduler::dispatchLoop() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    if (!m_current) {
+      m_flushRequested = false;
+      if (m_stop) {
+        break;
+      }
+      m_cv.wait(lock, [this] { return m_stop || m_current; });
+      continue;
+    }
+    // 超时、主动 flush 或退出时交出未满的 batch；凑满的 batch 由 submit 直接交出
+    auto deadline = m_current->firstEnqueueTime + m_maxDelay;
+    if (!m_flushRequested && !m_stop && std::chrono::steady_clock::now() < deadline) {
+      m_cv.wait_until(lock, deadline);
+      continue;
+    }
+    std::shared_ptr<Batch> batch = std::move(m_current);
+    lock.unlock();
+    dispatch(std::move(batch));
+    lock.lock();
+  }
+}
+
+void sample_app::BatchScheduler::runBatch(Batch &batch) {
+  // 未填满的槽位补零
+  for (size_t i = 0; i < batch.inputs.size(); i++) {
+    float *dst  = batch.inputs[i].data();
+    size_t size = m_inputSampleSizes[i];
+    std::fill(dst + batch.count * size, dst + m_batchSize * size, 0.0f);
+  }
+
+  StatusCode status = m_app->infer(batch.inputPtrs.data(),
+                                   batch.inputSizes.data(),
+                                   batch.inputPtrs.size(),
+                                   batch.outputPtrs.data(),
+                                   batch.outputCapacities.data(),
+                                   batch.outputPtrs.size(),
+                                   m_graphIdx);
+  size_t numOutputs = batch.outputs.size();
+  if (StatusCode::SUCCESS != status) {
+    QNN_ERROR("BatchScheduler: batch of %zu requests failed", batch.count);
+  } else {
+    // 按槽位把输出拆回各请求
+    for (size_t i = 0; i < numOutputs; i++) {
+      const float *src = batch.outputs[i].data();
+      size_t size      = m_outputSampleSizes[i];
+      for (size_t slot = 0; slot < batch.count; slot++) {
+        std::memcpy(batch.requestOutputs[slot * numOutputs + i],
+                    src + slot * size,
+                    size * sizeof(float));
+      }
+    }
+  }
+
+  for (size_t slot = 0; slot < batch.count; slot++) {
+    Callback callback = std::move(batch.callbacks[slot]);
+    batch.callbacks[slot] = nullptr;
+    if (callback) {
+      try {
+        callback(status);
+      } catch (...) {
+        QNN_ERROR("BatchScheduler: unhandled exception in request callback");
+      }
+    }
+  }
+  batch.count = 0;
+}
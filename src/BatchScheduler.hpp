@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "QnnSampleApp.hpp"
+#include "TaskQueue.hpp"
+
+namespace qnn {
+namespace tools {
+namespace sample_app {
+
+// 请求合批调度器：接收单样本推理请求，打包进图输入张量的 batch 维度（第 0 维），
+// 凑满一个 batch 或者等待超过 maxDelay 时执行一次，再把输出按请求拆分回去。
+// 整批推理交给 executor 执行（封装层传入实例的工作线程，与该实例的其它异步调用串行）；
+// 调度器自己的线程只负责超时判断。
+class BatchScheduler {
+ public:
+  using Callback = std::function<void(StatusCode status)>;
+  // 执行一批推理的执行器，为空时使用调度器私有的单线程队列
+  using Executor = std::function<void(std::function<void()> task)>;
+
+  // 所有输入/输出张量的第 0 维必须相同，否则抛出 std::runtime_error
+  BatchScheduler(QnnSampleApp *app,
+                 int graphIdx,
+                 std::chrono::microseconds maxDelay,
+                 Executor executor = nullptr);
+
+  // 把已排队的请求交给 executor，并等待所有已交出的批次执行完（回调都已返回）后退出；
+  // 因此不能在 executor 的线程上（例如请求回调中）析构
+  ~BatchScheduler();
+
+  BatchScheduler(const BatchScheduler &) = delete;
+  BatchScheduler &operator=(const BatchScheduler &) = delete;
+
+  // inputs 为单个样本的 float 数据，sizes 必须等于单样本元素个数，提交时直接拷贝进 batch 槽位；
+  // outputs 为单样本输出缓冲区（容量以 float 计），在 callback 被调用前必须保持有效
+  StatusCode submit(const float *const *inputs, const size_t *sizes, size_t numInputs,
+                    float *const *outputs, const size_t *capacities, size_t numOutputs,
+                    Callback callback);
+
+  // 不等待凑满，立即执行当前已排队的请求
+  void flush();
+
+  uint32_t batchSize() const { return m_batchSize; }
+
+ private:
+  // 一个 batch 的暂存区，执行完后回到 m_freeBatches 复用，稳定运行时不再分配
+  struct Batch {
+    std::vector<std::vector<float>> inputs;   // 每个输入张量 batchSize 个槽位
+    std::vector<std::vector<float>> outputs;
+    std::vector<const float *> inputPtrs;
+    std::vector<size_t> inputSizes;
+    std::vector<float *> outputPtrs;
+    std::vector<size_t> outputCapacities;
+    std::vector<float *> requestOutputs;      // 第 slot 个请求的第 i 个输出：[slot * numOutputs + i]
+    std::vector<Callback> callbacks;
+    size_t count = 0;
+    std::chrono::steady_clock::time_point firstEnqueueTime;
+  };
+
+  std::shared_ptr<Batch> takeBatch();
+
+  void dispatch(std::shared_ptr<Batch> batch);
+
+  void dispatchLoop();
+
+  void runBatch(Batch &batch);
+
+  QnnSampleApp *m_app;
+  int m_graphIdx;
+  std::chrono::microseconds m_maxDelay;
+  Executor m_executor;
+  std::unique_ptr<taskqueue::TaskQueue> m_ownQueue;  // 未传入 executor 时使用
+  uint32_t m_batchSize = 1;
+  std::vector<size_t> m_inputSampleSizes;   // 单样本输入元素个数
+  std::vector<size_t> m_outputSampleSizes;  // 单样本输出元素个数
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::shared_ptr<Batch> m_current;  // 正在填充的 batch
+  std::vector<std::shared_ptr<Batch>> m_freeBatches;
+  size_t m_outstanding = 0;          // 已交给 executor 尚未执行完的批次
+  std::condition_variable m_idleCv;
+  bool m_flushRequested = false;
+  bool m_stop = false;
+  std::thread m_thread;
+};
+
+}  // namespace sample_app
+}  // namespace tools
+}  // namespace qnn
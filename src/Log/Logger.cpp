@@ -10,7 +10,9 @@
 #include <cstdio>
 #include <iostream>
 #include <sstream>
+#ifdef __ANDROID__
 #include <android/log.h>
+#endif
 
 #include "LogUtils.hpp"
 #include "Logger.hpp"
@@ -38,6 +40,7 @@ std::shared_ptr<Logger> Logger::createLogger(QnnLog_Callback_t callback,
   return s_logger;
 }
 
+#ifdef __ANDROID__
 // 添加安卓日志回调函数
 namespace qnn {
 namespace log {
@@ -67,6 +70,7 @@ void logAndroidCallback(const char* message, QnnLog_Level_t level, uint64_t time
 } // namespace utils
 } // namespace log
 } // namespace qnn
+#endif
 
 Logger::Logger(QnnLog_Callback_t callback, QnnLog_Level_t maxLevel, QnnLog_Error_t* status)
     : m_callback(callback), m_maxLevel(maxLevel), m_epoch(getTimestamp()) {
@@ -0,0 +1,175 @@
+#include "ModelLoader.hpp"
+
+#include <unistd.h>
+
+#include <filesystem>
+#include <future>
+#include <stdexcept>
+
+#include "Logger.hpp"
+#include "MappedFile.hpp"
+#include "PAL/DynamicLoading.hpp"
+
+using namespace qnn;
+using namespace qnn::tools;
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedMs(Clock::time_point start, Clock::time_point end = Clock::now()) {
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 把模型文件读入 page cache，构造函数中的 mmap/dlopen 不再等待磁盘 IO；
+// .bin 模型还会预先 dlopen System 库，返回其句柄（否则返回 nullptr），
+// 调用者在构造函数结束后关闭，构造期间再次加载时直接复用已映射的库
+static void *prefetchModel(const sample_app::LoadRequest &request) {
+  datautil::MappedFile file;
+  if (file.map(request.modelPath)) {
+    long pageSize = sysconf(_SC_PAGESIZE);
+    size_t step   = pageSize > 0 ? static_cast<size_t>(pageSize) : 4096;
+    volatile uint8_t sink = 0;
+    for (size_t offset = 0; offset < file.size(); offset += step) {
+      sink = sink + file.data()[offset];
+    }
+    (void)sink;
+  }
+  bool isBinary = request.modelPath.size() >= 4 &&
+                  request.modelPath.compare(request.modelPath.size() - 4, 4, ".bin") == 0;
+  if (!isBinary) {
+    return nullptr;
+  }
+  std::string backendDir = std::filesystem::path(request.backendPath).parent_path().string();
+  return pal::dynamicloading::dlOpen((backendDir + "/libQnnSystem.so").c_str(),
+                                     pal::dynamicloading::DL_NOW | pal::dynamicloading::DL_LOCAL);
+}
+
+sample_app::ModelLoader::ModelLoader(LoadRequest request)
+    : m_request(std::move(request)), m_submitTime(Clock::now()) {}
+
+std::shared_ptr<sample_app::ModelLoader> sample_app::ModelLoader::start(LoadRequest request) {
+  std::shared_ptr<ModelLoader> loader(new ModelLoader(std::move(request)));
+  loader->m_thread = std::thread(&ModelLoader::run, loader.get());
+  return loader;
+}
+
+sample_app::ModelLoader::~ModelLoader() {
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+sample_app::LoadStage sample_app::ModelLoader::stage() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stage;
+}
+
+sample_app::LoadStage sample_app::ModelLoader::wait(std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  auto done = [this] { return m_stage == LoadStage::READY || m_stage == LoadStage::FAILED; };
+  if (timeout.count() < 0) {
+    m_cv.wait(lock, done);
+  } else {
+    m_cv.wait_for(lock, timeout, done);
+  }
+  return m_stage;
+}
+
+std::unique_ptr<sample_app::QnnSampleApp> sample_app::ModelLoader::take() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_stage != LoadStage::READY) {
+    return nullptr;
+  }
+  return std::move(m_app);
+}
+
+sample_app::LoadTimings sample_app::ModelLoader::timings() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_timings;
+}
+
+std::string sample_app::ModelLoader::error() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_error;
+}
+
+void sample_app::ModelLoader::setStage(LoadStage stage) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stage = stage;
+  }
+  m_cv.notify_all();
+}
+
+void sample_app::ModelLoader::run() {
+  auto startTime = Clock::now();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_timings.queuedMs = elapsedMs(m_submitTime, startTime);
+  }
+  setStage(LoadStage::PREPARING);
+
+  std::unique_ptr<QnnSampleApp> app;
+  std::string error;
+  LoadTimings timings;
+  void *systemLibraryHandle = nullptr;
+  try {
+    // 模型文件预读与 backend 初始化互不依赖，并行执行
+    auto prefetch = std::async(std::launch::async, [this, &systemLibraryHandle] {
+      auto prefetchStart  = Clock::now();
+      systemLibraryHandle = prefetchModel(m_request);
+      return elapsedMs(prefetchStart);
+    });
+    auto backendStart = Clock::now();
+    // 构造函数会再次 acquire 同一个共享 backend，这里持有引用保证期间不被释放
+    auto backend       = QnnSampleApp::acquireSharedBackend(m_request.backendPath);
+    timings.backendMs  = elapsedMs(backendStart);
+    timings.prefetchMs = prefetch.get();
+    timings.prepareMs  = elapsedMs(startTime);
+    if (!backend) {
+      throw std::runtime_error("Failed to initialize backend");
+    }
+
+    setStage(LoadStage::CREATING);
+    auto createStart = Clock::now();
+    app.reset(new QnnSampleApp(m_request.backendPath,
+                               m_request.modelPath,
+                               m_request.outputDataType,
+                               m_request.inputDataType,
+                               m_request.backendCfg,
+                               m_request.cacheConfig,
+                               m_request.warmupRuns));
+    timings.createMs = elapsedMs(createStart);
+  } catch (const std::exception &e) {
+    error = e.what();
+  } catch (...) {
+    error = "unknown error";
+  }
+  if (nullptr != systemLibraryHandle) {
+    pal::dynamicloading::dlClose(systemLibraryHandle);
+  }
+  timings.totalMs = elapsedMs(startTime);
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    timings.queuedMs = m_timings.queuedMs;
+    m_timings        = timings;
+    if (app) {
+      m_app   = std::move(app);
+      m_stage = LoadStage::READY;
+    } else {
+      m_error = error;
+      m_stage = LoadStage::FAILED;
+    }
+  }
+  if (error.empty()) {
+    QNN_INFO("Loaded %s: backend %.1f ms || prefetch %.1f ms, create %.1f ms, total %.1f ms",
+             m_request.modelPath.c_str(),
+             timings.backendMs,
+             timings.prefetchMs,
+             timings.createMs,
+             timings.totalMs);
+  } else {
+    QNN_ERROR("Failed to load %s: %s", m_request.modelPath.c_str(), error.c_str());
+  }
+  m_cv.notify_all();
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "QnnSampleApp.hpp"
+
+namespace qnn {
+namespace tools {
+namespace sample_app {
+
+struct LoadRequest {
+  std::string backendPath;
+  std::string modelPath;
+  iotensor::OutputDataType outputDataType = iotensor::OutputDataType::FLOAT_ONLY;
+  iotensor::InputDataType inputDataType   = iotensor::InputDataType::FLOAT;
+  BackendConfig backendCfg;
+  contextcache::Config cacheConfig;
+  uint32_t warmupRuns = 0;  // 大于 0 时构造结束前自动预热，READY 后即为稳态速度
+};
+
+enum class LoadStage {
+  PENDING,    // 已提交，线程尚未开始
+  PREPARING,  // 并行：共享 backend 初始化 + 模型文件预读（.bin 同时预加载 System 库）
+  CREATING,   // 构造 QnnSampleApp：context 创建/反序列化、compose/finalize、预热
+  READY,
+  FAILED
+};
+
+// 各阶段耗时（毫秒），PREPARING 的两个分支并行执行，prepareMs 为二者中较长者
+struct LoadTimings {
+  double queuedMs   = 0;
+  double backendMs  = 0;
+  double prefetchMs = 0;
+  double prepareMs  = 0;
+  double createMs   = 0;
+  double totalMs    = 0;
+};
+
+// 分阶段的非阻塞模型加载。每个加载在自己的线程上运行，多个加载之间互不等待，
+// 同一 backend 的初始化经 BackendRegistry 只做一次。可轮询 stage() 或用 wait() 等待就绪。
+class ModelLoader {
+ public:
+  static std::shared_ptr<ModelLoader> start(LoadRequest request);
+
+  // 等待加载线程结束；未被 take() 取走的实例一并释放
+  ~ModelLoader();
+
+  ModelLoader(const ModelLoader &) = delete;
+  ModelLoader &operator=(const ModelLoader &) = delete;
+
+  LoadStage stage() const;
+
+  // 阻塞直到 READY/FAILED 或超时，返回当时的阶段；timeout 为负表示一直等待
+  LoadStage wait(std::chrono::milliseconds timeout = std::chrono::milliseconds(-1));
+
+  // READY 之后取走实例（只能取一次），否则返回空
+  std::unique_ptr<QnnSampleApp> take();
+
+  LoadTimings timings() const;
+
+  std::string error() const;
+
+ private:
+  explicit ModelLoader(LoadRequest request);
+
+  void run();
+
+  void setStage(LoadStage stage);
+
+  LoadRequest m_request;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  LoadStage m_stage = LoadStage::PENDING;
+  LoadTimings m_timings;
+  std::string m_error;
+  std::unique_ptr<QnnSampleApp> m_app;
+  std::chrono::steady_clock::time_point m_submitTime;
+  std::thread m_thread;
+};
+
+}  // namespace sample_app
+}  // namespace tools
+}  // namespace qnn
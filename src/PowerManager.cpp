@@ -0,0 +1,254 @@
+#include "PowerManager.hpp"
+
+#include <cstring>
+
+#include "HTP/QnnHtpPerfInfrastructure.h"
+#include "Logger.hpp"
+
+using namespace qnn;
+using namespace qnn::tools;
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// 单个档位对应的投票参数，核心与总线使用相同的电压档
+struct ProfileSettings {
+  QnnHtpPerfInfrastructure_VoltageCorner_t cornerMin;
+  QnnHtpPerfInfrastructure_VoltageCorner_t cornerTarget;
+  QnnHtpPerfInfrastructure_VoltageCorner_t cornerMax;
+  uint32_t sleepLatencyUs;
+  uint32_t dcvsEnable;
+  QnnHtpPerfInfrastructure_PowerMode_t powerMode;
+  uint32_t hmxPickDefault;  // 1 表示 HMX 由驱动决定，忽略下面的 HMX 参数
+  QnnHtpPerfInfrastructure_ExpVoltageCorner_t hmxCorner;
+  QnnHtpPerfInfrastructure_ClkPerfMode_t hmxPerfMode;
+  uint32_t rpcControlLatencyUs;
+  uint32_t rpcPollingTimeUs;  // 0 表示不轮询
+};
+
+// 按 PowerProfile 的顺序排列，BURST 与原先构造函数中固定的投票一致
+const ProfileSettings PROFILE_SETTINGS[] = {
+    {DCVS_VOLTAGE_VCORNER_TURBO,
+     DCVS_VOLTAGE_VCORNER_TURBO,
+     DCVS_VOLTAGE_VCORNER_TURBO,
+     40,
+     0,
+     QNN_HTP_PERF_INFRASTRUCTURE_POWERMODE_PERFORMANCE_MODE,
+     0,
+     DCVS_EXP_VCORNER_TUR,
+     QNN_HTP_PERF_INFRASTRUCTURE_CLK_PERF_HIGH,
+     100,
+     1000},
+    {DCVS_VOLTAGE_VCORNER_NOM,
+     DCVS_VOLTAGE_VCORNER_NOM_PLUS,
+     DCVS_VOLTAGE_VCORNER_TURBO,
+     100,
+     0,
+     QNN_HTP_PERF_INFRASTRUCTURE_POWERMODE_PERFORMANCE_MODE,
+     0,
+     DCVS_EXP_VCORNER_NOM,
+     QNN_HTP_PERF_INFRASTRUCTURE_CLK_PERF_HIGH,
+     100,
+     0},
+    {DCVS_VOLTAGE_VCORNER_SVS_PLUS,
+     DCVS_VOLTAGE_VCORNER_NOM,
+     DCVS_VOLTAGE_VCORNER_NOM_PLUS,
+     1000,
+     1,
+     QNN_HTP_PERF_INFRASTRUCTURE_POWERMODE_ADJUST_UP_DOWN,
+     1,
+     DCVS_EXP_VCORNER_NOM,
+     QNN_HTP_PERF_INFRASTRUCTURE_CLK_PERF_LOW,
+     1000,
+     0},
+    {DCVS_VOLTAGE_VCORNER_SVS2,
+     DCVS_VOLTAGE_VCORNER_SVS,
+     DCVS_VOLTAGE_VCORNER_SVS_PLUS,
+     2000,
+     1,
+     QNN_HTP_PERF_INFRASTRUCTURE_POWERMODE_POWER_SAVER_MODE,
+     1,
+     DCVS_EXP_VCORNER_SVS,
+     QNN_HTP_PERF_INFRASTRUCTURE_CLK_PERF_LOW,
+     5000,
+     0},
+};
+
+}  // namespace
+
+sample_app::PowerManager::PowerManager(const QnnHtpDevice_PerfInfrastructure_t &perfInfra,
+                                       uint32_t powerConfigId)
+    : m_perfInfra(perfInfra), m_powerConfigId(powerConfigId), m_current(PowerProfile::BURST) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    vote(m_active);
+    m_lastActivity = Clock::now();
+  }
+  m_thread = std::thread(&PowerManager::relaxLoop, this);
+}
+
+sample_app::PowerManager::~PowerManager() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+}
+
+const char *sample_app::PowerManager::profileName(PowerProfile profile) {
+  switch (profile) {
+    case PowerProfile::BURST:
+      return "burst";
+    case PowerProfile::SUSTAINED:
+      return "sustained";
+    case PowerProfile::BALANCED:
+      return "balanced";
+    case PowerProfile::LOW_POWER:
+      return "low-power";
+  }
+  return "unknown";
+}
+
+bool sample_app::PowerManager::vote(PowerProfile profile) {
+  const ProfileSettings &settings = PROFILE_SETTINGS[static_cast<int>(profile)];
+
+  QnnHtpPerfInfrastructure_PowerConfig_t dcvsConfig;
+  memset(&dcvsConfig, 0, sizeof(dcvsConfig));
+  dcvsConfig.option = QNN_HTP_PERF_INFRASTRUCTURE_POWER_CONFIGOPTION_DCVS_V3;
+  dcvsConfig.dcvsV3Config.contextId               = m_powerConfigId;
+  dcvsConfig.dcvsV3Config.setBusParams            = 1;
+  dcvsConfig.dcvsV3Config.busVoltageCornerMin     = settings.cornerMin;
+  dcvsConfig.dcvsV3Config.busVoltageCornerTarget  = settings.cornerTarget;
+  dcvsConfig.dcvsV3Config.busVoltageCornerMax     = settings.cornerMax;
+  dcvsConfig.dcvsV3Config.setCoreParams           = 1;
+  dcvsConfig.dcvsV3Config.coreVoltageCornerMin    = settings.cornerMin;
+  dcvsConfig.dcvsV3Config.coreVoltageCornerTarget = settings.cornerTarget;
+  dcvsConfig.dcvsV3Config.coreVoltageCornerMax    = settings.cornerMax;
+  dcvsConfig.dcvsV3Config.setSleepLatency         = 1;
+  dcvsConfig.dcvsV3Config.sleepLatency            = settings.sleepLatencyUs;
+  dcvsConfig.dcvsV3Config.setDcvsEnable           = 1;
+  dcvsConfig.dcvsV3Config.dcvsEnable              = settings.dcvsEnable;
+  dcvsConfig.dcvsV3Config.powerMode               = settings.powerMode;
+
+  // 配置HMX (如果SoC支持)
+  QnnHtpPerfInfrastructure_PowerConfig_t hmxConfig;
+  memset(&hmxConfig, 0, sizeof(hmxConfig));
+  hmxConfig.option = QNN_HTP_PERF_INFRASTRUCTURE_POWER_CONFIGOPTION_HMX_V2;
+  hmxConfig.hmxV2Config.hmxPickDefault         = settings.hmxPickDefault;
+  hmxConfig.hmxV2Config.hmxPerfMode            = settings.hmxPerfMode;
+  hmxConfig.hmxV2Config.hmxVoltageCornerMin    = settings.hmxCorner;
+  hmxConfig.hmxV2Config.hmxVoltageCornerTarget = settings.hmxCorner;
+  hmxConfig.hmxV2Config.hmxVoltageCornerMax    = settings.hmxCorner;
+
+  QnnHtpPerfInfrastructure_PowerConfig_t rpcLatencyConfig;
+  memset(&rpcLatencyConfig, 0, sizeof(rpcLatencyConfig));
+  rpcLatencyConfig.option = QNN_HTP_PERF_INFRASTRUCTURE_POWER_CONFIGOPTION_RPC_CONTROL_LATENCY;
+  rpcLatencyConfig.rpcControlLatencyConfig = settings.rpcControlLatencyUs;
+
+  QnnHtpPerfInfrastructure_PowerConfig_t rpcPollingConfig;
+  memset(&rpcPollingConfig, 0, sizeof(rpcPollingConfig));
+  rpcPollingConfig.option = QNN_HTP_PERF_INFRASTRUCTURE_POWER_CONFIGOPTION_RPC_POLLING_TIME;
+  rpcPollingConfig.rpcPollingTimeConfig = settings.rpcPollingTimeUs;
+
+  const QnnHtpPerfInfrastructure_PowerConfig_t *powerConfigs[] = {
+      &dcvsConfig, &hmxConfig, &rpcLatencyConfig, &rpcPollingConfig, nullptr};
+  auto voteStart = Clock::now();
+  Qnn_ErrorHandle_t result = m_perfInfra.setPowerConfig(m_powerConfigId, powerConfigs);
+  // 失败时也记录为当前档位，避免空闲线程或每次执行反复重试
+  m_current = profile;
+  if (result != QNN_SUCCESS) {
+    QNN_ERROR("Failed to vote %s power profile: %d", profileName(profile), static_cast<int>(result));
+    return false;
+  }
+  QNN_DEBUG("Voted %s power profile in %.2f ms",
+            profileName(profile),
+            std::chrono::duration<double, std::milli>(Clock::now() - voteStart).count());
+  return true;
+}
+
+void sample_app::PowerManager::beginExecute() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_executing++;
+  if (!m_pinned && m_current != m_active) {
+    vote(m_active);
+  }
+}
+
+void sample_app::PowerManager::endExecute() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_executing > 0) {
+      m_executing--;
+    }
+    m_lastActivity = Clock::now();
+  }
+  m_cv.notify_all();
+}
+
+void sample_app::PowerManager::setPolicy(PowerProfile active,
+                                         PowerProfile idle,
+                                         std::chrono::milliseconds idleTimeout) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_active       = active;
+    m_idle         = idle;
+    m_idleTimeout  = idleTimeout;
+    m_lastActivity = Clock::now();
+    if (!m_pinned && m_executing > 0 && m_current != m_active) {
+      vote(m_active);
+    }
+  }
+  m_cv.notify_all();
+}
+
+bool sample_app::PowerManager::pin(PowerProfile profile) {
+  bool voted = true;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pinned = true;
+    if (m_current != profile) {
+      voted = vote(profile);
+    }
+  }
+  m_cv.notify_all();
+  return voted;
+}
+
+void sample_app::PowerManager::unpin() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pinned       = false;
+    m_lastActivity = Clock::now();
+    if (m_executing > 0 && m_current != m_active) {
+      vote(m_active);
+    }
+  }
+  m_cv.notify_all();
+}
+
+sample_app::PowerProfile sample_app::PowerManager::currentProfile() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_current;
+}
+
+void sample_app::PowerManager::relaxLoop() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stop) {
+    if (m_pinned || m_executing > 0 || m_current == m_idle) {
+      m_cv.wait(lock);
+      continue;
+    }
+    auto deadline = m_lastActivity + m_idleTimeout;
+    if (Clock::now() >= deadline) {
+      QNN_DEBUG("Idle for %lld ms, relaxing power vote",
+                static_cast<long long>(m_idleTimeout.count()));
+      vote(m_idle);
+      continue;
+    }
+    m_cv.wait_until(lock, deadline);
+  }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "HTP/QnnHtpDevice.h"
+
+namespace qnn {
+namespace tools {
+namespace sample_app {
+
+// HTP 性能档位，从高到低
+enum class PowerProfile {
+  BURST,      // DCVS 关闭，核心/总线锁定 turbo，RPC 轮询，延迟最低
+  SUSTAINED,  // DCVS 关闭，nom+ 附近，适合长时间连续推理
+  BALANCED,   // DCVS 开启，按负载在 svs+ ~ nom+ 之间调整
+  LOW_POWER   // DCVS 省电模式，svs 附近，适合空闲或后台任务
+};
+
+constexpr std::chrono::milliseconds DEFAULT_POWER_IDLE_TIMEOUT{1000};
+
+// 管理共享 backend 上唯一的 powerConfigId 的投票。
+// 每次 graphExecute 之前投到活跃档位（默认 BURST），最后一次执行结束后空闲 idleTimeout
+// 由后台线程放松到空闲档位（默认 LOW_POWER）；pin 之后固定为指定档位，不再自动切换。
+// 投票只在档位变化时发生，已处于活跃档位时 beginExecute 只是计数。
+// 同一 backend 的所有实例共用一个 PowerManager，策略与 pin 对它们同时生效。
+class PowerManager {
+ public:
+  // 构造时投一次活跃档位，使加载和首次执行不受低频影响
+  PowerManager(const QnnHtpDevice_PerfInfrastructure_t &perfInfra, uint32_t powerConfigId);
+
+  ~PowerManager();
+
+  PowerManager(const PowerManager &) = delete;
+  PowerManager &operator=(const PowerManager &) = delete;
+
+  void beginExecute();
+
+  void endExecute();
+
+  void setPolicy(PowerProfile active, PowerProfile idle, std::chrono::milliseconds idleTimeout);
+
+  // 固定档位直到 unpin，例如后台批量建索引时固定为 LOW_POWER
+  bool pin(PowerProfile profile);
+
+  void unpin();
+
+  PowerProfile currentProfile();
+
+  static const char *profileName(PowerProfile profile);
+
+ private:
+  // 持有 m_mutex 时调用
+  bool vote(PowerProfile profile);
+
+  void relaxLoop();
+
+  QnnHtpDevice_PerfInfrastructure_t m_perfInfra;
+  uint32_t m_powerConfigId;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  PowerProfile m_current;
+  PowerProfile m_active = PowerProfile::BURST;
+  PowerProfile m_idle   = PowerProfile::LOW_POWER;
+  std::chrono::milliseconds m_idleTimeout = DEFAULT_POWER_IDLE_TIMEOUT;
+  bool m_pinned          = false;
+  uint32_t m_executing   = 0;
+  std::chrono::steady_clock::time_point m_lastActivity;
+  bool m_stop = false;
+  std::thread m_thread;
+};
+
+}  // namespace sample_app
+}  // namespace tools
+}  // namespace qnn
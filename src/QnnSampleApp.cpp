@@ -6,16 +6,22 @@
 //
 //==============================================================================
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <inttypes.h>
 
 #include <cstring>
+#include <iomanip>
+#include <random>
+#include <sstream>
 
 #include "DataUtil.hpp"
 #include "DynamicLoadUtil.hpp"
 #include "HTP/QnnHtpPerfInfrastructure.h"
 #include "Logger.hpp"
+#include "MappedFile.hpp"
 #include "PAL/DynamicLoading.hpp"
 #include "QnnCommon.h"
 #include "QnnDevice.h"
@@ -25,6 +31,7 @@
 #include "QnnTypeMacros.hpp"
 #include "QnnTypes.h"
 #include "QnnWrapperUtils.hpp"
+#include "Tracer.hpp"
 
 #include "QnnLog.h"
 
@@ -60,20 +67,51 @@ sample_app::QnnSampleApp::QnnSampleApp(const std::string &backendPath,
                                        const std::string &modelPath,
                                        iotensor::OutputDataType outputDataType,
                                        iotensor::InputDataType inputDataType,
-                                       const BackendConfig &backendCfg)
+                                       const BackendConfig &backendCfg,
+                                       const contextcache::Config &cacheConfig,
+                                       uint32_t warmupRuns)
     : m_outputDataType(outputDataType), m_inputDataType(inputDataType),
       m_profilingLevel(ProfilingLevel::OFF), // 默认关闭性能分析
       m_isBackendInitialized(false), m_isContextCreated(false), m_debug(false),
       m_backendCfg(backendCfg) // 初始化后端配置
 {
+  using Clock = std::chrono::steady_clock;
+  auto elapsedMs = [](Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  };
+  auto startupStart = Clock::now();
+  m_startupStats.peakRssBeforeKb = datautil::readPeakRssKb();
+
   // 确定是否为二进制模型文件
   m_isBinaryModel = (modelPath.length() >= 4) &&
                     (modelPath.rfind(".bin") == (modelPath.length() - 4));
 
-  // 动态加载 backend 和 model 库
-  auto dynStatus = dynamicloadutil::getQnnFunctionPointers(
-      backendPath, modelPath, &m_qnnFunctionPointers, &m_ownedBackendHandle,
-      !m_isBinaryModel, &m_ownedModelHandle);
+  // backend 库、backend/device 句柄和 HTP 性能投票按 backend 路径在进程内共享
+  auto phaseStart = Clock::now();
+  bool backendCreated = false;
+  m_sharedBackend = acquireSharedBackend(backendPath, &backendCreated);
+  m_startupStats.backendAcquireMs = elapsedMs(phaseStart);
+  if (!m_sharedBackend) {
+    QNN_ERROR("后端初始化失败");
+    throw std::runtime_error("Failed to initialize backend");
+  }
+  m_startupStats.backendShared = !backendCreated;
+  if (backendCreated) {
+    m_startupStats.backend = m_sharedBackend->timings;
+  }
+  m_qnnFunctionPointers.qnnInterface = m_sharedBackend->qnnInterface;
+  m_backendLibraryHandle = m_sharedBackend->libraryHandle;
+  m_backendHandle = m_sharedBackend->backendHandle;
+  m_deviceHandle = m_sharedBackend->deviceHandle;
+  m_isBackendInitialized = true;
+
+  // 动态加载 model 库
+  phaseStart = Clock::now();
+  auto dynStatus = dynamicloadutil::StatusCode::SUCCESS;
+  if (!m_isBinaryModel) {
+    dynStatus = dynamicloadutil::getModelFunctionPointers(
+        modelPath, &m_qnnFunctionPointers, &m_ownedModelHandle);
+  }
 
   if (m_isBinaryModel) {
     // 二进制模型需要System接口
@@ -84,15 +122,13 @@ sample_app::QnnSampleApp::QnnSampleApp(const std::string &backendPath,
         backendDir + "/libQnnSystem.so", &m_qnnFunctionPointers);
     m_cachedBinaryPath = modelPath;
   }
+  m_startupStats.modelLoadMs = elapsedMs(phaseStart);
 
   if (dynStatus != dynamicloadutil::StatusCode::SUCCESS) {
     QNN_ERROR("初始化QNN函数指针失败");
     throw std::runtime_error("Failed to initialize QNN function pointers");
   }
 
-  // 设置backend句柄
-  m_backendLibraryHandle = m_ownedBackendHandle;
-
 
     if (backendPath.find("Gpu") != std::string::npos) {
     // 配置GPU后端
@@ -144,17 +180,31 @@ sample_app::QnnSampleApp::QnnSampleApp(const std::string &backendPath,
     }
   }
 
-  // 初始化后端
-  if (initializeBackend() != StatusCode::SUCCESS) {
-    QNN_ERROR("后端初始化失败");
-    throw std::runtime_error("Failed to initialize backend");
-  }
-
   // 注册Op包（二进制模型可能不需要，但为安全起见保留）
+  phaseStart = Clock::now();
   if (StatusCode::SUCCESS != registerOpPackages()) {
     QNN_ERROR("注册Op包失败");
     throw std::runtime_error("Failed to register op packages");
   }
+  m_startupStats.opPackagesMs = elapsedMs(phaseStart);
+
+  // .so 模型启用了编译缓存时先查缓存，命中则直接走二进制加载路径
+  contextcache::ContextCache contextCache(cacheConfig);
+  std::string cacheKey;
+  if (!m_isBinaryModel && contextCache.enabled()) {
+    phaseStart = Clock::now();
+    contextCache.sweepStaleStaging();
+    cacheKey = contextcache::ContextCache::computeKey(
+        modelPath, contextCacheFingerprint(backendPath));
+    std::string cachedPath = contextCache.lookup(cacheKey);
+    m_startupStats.cacheLookupMs = elapsedMs(phaseStart);
+    if (!cachedPath.empty()) {
+      m_loadedFromCache = loadFromContextCache(backendPath, cachedPath);
+      if (!m_loadedFromCache) {
+        contextCache.invalidate(cacheKey);
+      }
+    }
+  }
 
   // 根据模型类型选择初始化路径
   if (m_isBinaryModel) {
@@ -163,278 +213,74 @@ sample_app::QnnSampleApp::QnnSampleApp(const std::string &backendPath,
       QNN_ERROR("从二进制文件创建模型失败");
       throw std::runtime_error("Failed to create model from binary");
     }
-  } else {
+  } else if (!m_loadedFromCache) {
     // 非二进制模型路径：常规初始化
+    phaseStart = Clock::now();
     if (createContext() != StatusCode::SUCCESS) {
       QNN_ERROR("创建上下文失败");
       throw std::runtime_error("Failed to create context");
     }
+    m_startupStats.contextCreateMs = elapsedMs(phaseStart);
+    phaseStart = Clock::now();
     if (composeGraphs() != StatusCode::SUCCESS) {
       QNN_ERROR("组合图失败");
       throw std::runtime_error("Failed to compose graphs");
     }
+    m_startupStats.composeGraphsMs = elapsedMs(phaseStart);
+    phaseStart = Clock::now();
 
     // 配置一下HTP后端
-    if (backendPath.find("Htp") != std::string::npos) {
-      // 配置图
-      QnnHtpGraph_CustomConfig_t *configGraphVtcm =
-          new QnnHtpGraph_CustomConfig_t();
-      configGraphVtcm->option = QNN_HTP_GRAPH_CONFIG_OPTION_VTCM_SIZE;
-      configGraphVtcm->vtcmSizeInMB = QNN_HTP_GRAPH_CONFIG_OPTION_MAX;
-
-      QnnGraph_Config_t *devConfigGraphVtcm = new QnnGraph_Config_t();
-      devConfigGraphVtcm->option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
-      devConfigGraphVtcm->customConfig = configGraphVtcm;
-
-      QnnHtpGraph_CustomConfig_t *configGraphPrecision =
-          new QnnHtpGraph_CustomConfig_t();
-      configGraphPrecision->option = QNN_HTP_GRAPH_CONFIG_OPTION_PRECISION;
-      configGraphPrecision->precision =
-          (Qnn_Precision_t)m_backendCfg.htpConfig.precisionMode;
-
-      QnnGraph_Config_t *devConfigGraphPrecision = new QnnGraph_Config_t();
-      devConfigGraphPrecision->option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
-      devConfigGraphPrecision->customConfig = configGraphPrecision;
-
-      // 添加图优化级别配置 (O=3)
-      QnnHtpGraph_CustomConfig_t *configGraphOpt =
-          new QnnHtpGraph_CustomConfig_t();
-      configGraphOpt->option = QNN_HTP_GRAPH_CONFIG_OPTION_OPTIMIZATION;
-      configGraphOpt->optimizationOption.type =
-          QNN_HTP_GRAPH_OPTIMIZATION_TYPE_FINALIZE_OPTIMIZATION_FLAG;
-      configGraphOpt->optimizationOption.floatValue =
-          (float)m_backendCfg.htpConfig.optimizationLevel; // O=3最佳性能
-
-      QnnGraph_Config_t *devConfigGraphOpt = new QnnGraph_Config_t();
-      devConfigGraphOpt->option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
-      devConfigGraphOpt->customConfig = configGraphOpt;
-
-      // 添加HVX线程数配置
-      QnnHtpGraph_CustomConfig_t *configGraphHvx =
-          new QnnHtpGraph_CustomConfig_t();
-      configGraphHvx->option = QNN_HTP_GRAPH_CONFIG_OPTION_NUM_HVX_THREADS;
-      configGraphHvx->numHvxThreads = UINT64_MAX; // 设置为最大线程！！！！
-
-      QnnGraph_Config_t *devConfigGraphHvx = new QnnGraph_Config_t();
-      devConfigGraphHvx->option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
-      devConfigGraphHvx->customConfig = configGraphHvx;
-
-      // 添加DLBC优化配置
-      QnnHtpGraph_CustomConfig_t *configGraphDlbc =
-          new QnnHtpGraph_CustomConfig_t();
-      configGraphDlbc->option = QNN_HTP_GRAPH_CONFIG_OPTION_OPTIMIZATION;
-      configGraphDlbc->optimizationOption.type =
-          QNN_HTP_GRAPH_OPTIMIZATION_TYPE_ENABLE_DLBC;
-      configGraphDlbc->optimizationOption.floatValue = 1.0f; // 启用DLBC
-
-      QnnGraph_Config_t *devConfigGraphDlbc = new QnnGraph_Config_t();
-      devConfigGraphDlbc->option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
-      devConfigGraphDlbc->customConfig = configGraphDlbc;
-
-      // QnnHtpGraph_CustomConfig_t *configGraphDlbcWeights =
-      //     new QnnHtpGraph_CustomConfig_t();
-      // configGraphDlbcWeights->option =
-      //     QNN_HTP_GRAPH_CONFIG_OPTION_OPTIMIZATION;
-      // configGraphDlbcWeights->optimizationOption.type =
-      //     QNN_HTP_GRAPH_OPTIMIZATION_TYPE_ENABLE_DLBC_WEIGHTS;
-      // configGraphDlbcWeights->optimizationOption.floatValue =
-      //     1.0f; // 启用权重DLBC优化
-
-      // QnnGraph_Config_t *devConfigGraphDlbcWeights =
-      //     new QnnGraph_Config_t();
-      // devConfigGraphDlbcWeights->option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
-      // devConfigGraphDlbcWeights->customConfig = configGraphDlbcWeights;
-
-      QnnGraph_Config_t **pGraphConfig =
-          new QnnGraph_Config_t *[7]; // 增加数组大小以容纳新配置
-      pGraphConfig[0] = devConfigGraphVtcm;
-      pGraphConfig[1] = devConfigGraphPrecision;
-      pGraphConfig[2] = devConfigGraphOpt;  // 新增优化级别
-      pGraphConfig[3] = devConfigGraphHvx;  // 新增HVX线程
-      pGraphConfig[4] = devConfigGraphDlbc; // 新增DLBC优化
-      // pGraphConfig[5] = devConfigGraphDlbcWeights; // 新增DLBC权重优化  //
-      // 好像设备上不支持
-      pGraphConfig[5] = nullptr;
-      pGraphConfig[6] = nullptr;
-
-      if (USE_CUSTOM_PARAMS) {
-        auto result = m_qnnFunctionPointers.qnnInterface.graphSetConfig(
-            m_graphsInfo[0]->graph, (const QnnGraph_Config_t **)pGraphConfig);
-        if (result != QNN_SUCCESS) {
-          QNN_ERROR("设置图配置失败: %d", result);
-        } else {
-          QNN_INFO("设置图配置成功");
-        }
-      }
+    if (backendPath.find("Htp") != std::string::npos &&
+        StatusCode::SUCCESS != applyHtpGraphConfig()) {
+      QNN_ERROR("HTP图配置失败");
+      throw std::runtime_error("Failed to apply HTP graph config");
     }
 
+    m_startupStats.graphConfigMs = elapsedMs(phaseStart);
+
+    phaseStart = Clock::now();
     if (finalizeGraphs() != StatusCode::SUCCESS) {
       QNN_ERROR("完成图初始化失败");
       throw std::runtime_error("Failed to finalize graphs");
     }
-  }
-
-  // 配置一下HTP后端
-  if (backendPath.find("Htp") != std::string::npos) {
-    // 获取平台信息
-    const QnnDevice_PlatformInfo_t *platformInfo;
-    Qnn_ErrorHandle_t err =
-        m_qnnFunctionPointers.qnnInterface.deviceGetPlatformInfo(nullptr,
-                                                                 &platformInfo);
-
-    // 使用new分配SoC配置
-    QnnHtpDevice_CustomConfig_t *configSoc = new QnnHtpDevice_CustomConfig_t();
-    configSoc->option = QNN_HTP_DEVICE_CONFIG_OPTION_SOC;
-    configSoc->socModel = platformInfo->v1.hwDevices[0]
-                              .v1.deviceInfoExtension->onChipDevice.socModel;
-
-    QnnDevice_Config_t *devConfigSoc = new QnnDevice_Config_t();
-    devConfigSoc->option = QNN_DEVICE_CONFIG_OPTION_CUSTOM;
-    devConfigSoc->customConfig = configSoc;
-
-    // 使用new分配架构配置
-    QnnHtpDevice_CustomConfig_t *configArch = new QnnHtpDevice_CustomConfig_t();
-    configArch->option = QNN_HTP_DEVICE_CONFIG_OPTION_ARCH;
-    configArch->arch.arch =
-        platformInfo->v1.hwDevices[0].v1.deviceInfoExtension->onChipDevice.arch;
-    configArch->arch.deviceId = 0; // 默认设备ID为0
-
-    QnnDevice_Config_t *devConfigArch = new QnnDevice_Config_t();
-    devConfigArch->option = QNN_DEVICE_CONFIG_OPTION_CUSTOM;
-    devConfigArch->customConfig = configArch;
-
-    // 使用new分配指针数组
-    QnnDevice_Config_t **pDeviceConfig = new QnnDevice_Config_t *[3];
-    pDeviceConfig[0] = devConfigSoc;
-    pDeviceConfig[1] = devConfigArch;
-    pDeviceConfig[2] = nullptr; // 以nullptr结束的数组
-    if (USE_CUSTOM_PARAMS) {
-      m_deviceConfig = pDeviceConfig;
+    m_startupStats.finalizeGraphsMs = elapsedMs(phaseStart);
 
-      auto result = m_qnnFunctionPointers.qnnInterface.backendSetConfig(
-          m_backendHandle, (const QnnBackend_Config_t **)m_backendConfig);
-      if (result != QNN_SUCCESS) {
-        QNN_ERROR("设置后端配置失败: %d", result);
-      } else {
-        QNN_INFO("设置后端配置成功");
-      }
+    if (!cacheKey.empty()) {
+      phaseStart = Clock::now();
+      storeToContextCache(contextCache, cacheKey);
+      m_startupStats.cacheStoreMs = elapsedMs(phaseStart);
     }
+  }
 
-    // 配置性能基础设施 (Performance Infrastructure)
-    Qnn_DeviceHandle_t deviceHandle = nullptr;
-    Qnn_ErrorHandle_t perfResult =
-        m_qnnFunctionPointers.qnnInterface.deviceCreate(
-            m_logHandle, (const QnnDevice_Config_t **)m_deviceConfig,
-            &deviceHandle);
-    if (perfResult == QNN_SUCCESS && deviceHandle != nullptr) {
-      QnnDevice_Infrastructure_t deviceInfra = nullptr;
-      perfResult = m_qnnFunctionPointers.qnnInterface.deviceGetInfrastructure(
-          &deviceInfra);
-
-      if (perfResult == QNN_SUCCESS && deviceInfra != nullptr) {
-        QnnHtpDevice_Infrastructure_t *htpInfra =
-            static_cast<QnnHtpDevice_Infrastructure_t *>(deviceInfra);
-        QnnHtpDevice_PerfInfrastructure_t perfInfra = htpInfra->perfInfra;
-        uint32_t powerConfigId = 0;
-
-        // 创建电源配置ID
-        perfResult = perfInfra.createPowerConfigId(0, 0, &powerConfigId);
-
-        if (perfResult == QNN_SUCCESS) {
-          QNN_INFO("创建电源配置ID成功: %d", powerConfigId);
-
-          // 配置DCVS V3高性能Burst模式
-          QnnHtpPerfInfrastructure_PowerConfig_t *dcvsConfig =
-              new QnnHtpPerfInfrastructure_PowerConfig_t();
-          memset(dcvsConfig, 0, sizeof(QnnHtpPerfInfrastructure_PowerConfig_t));
-          dcvsConfig->option =
-              QNN_HTP_PERF_INFRASTRUCTURE_POWER_CONFIGOPTION_DCVS_V3;
-          dcvsConfig->dcvsV3Config.contextId = powerConfigId;
-          dcvsConfig->dcvsV3Config.setBusParams = 1;
-          dcvsConfig->dcvsV3Config.busVoltageCornerMin =
-              DCVS_VOLTAGE_VCORNER_TURBO;
-          dcvsConfig->dcvsV3Config.busVoltageCornerTarget =
-              DCVS_VOLTAGE_VCORNER_TURBO;
-          dcvsConfig->dcvsV3Config.busVoltageCornerMax =
-              DCVS_VOLTAGE_VCORNER_TURBO;
-          dcvsConfig->dcvsV3Config.setCoreParams = 1;
-          dcvsConfig->dcvsV3Config.coreVoltageCornerMin =
-              DCVS_VOLTAGE_VCORNER_TURBO;
-          dcvsConfig->dcvsV3Config.coreVoltageCornerTarget =
-              DCVS_VOLTAGE_VCORNER_TURBO;
-          dcvsConfig->dcvsV3Config.coreVoltageCornerMax =
-              DCVS_VOLTAGE_VCORNER_TURBO;
-          dcvsConfig->dcvsV3Config.setSleepLatency = 1;
-          dcvsConfig->dcvsV3Config.sleepLatency = 40; // Burst模式建议值
-          dcvsConfig->dcvsV3Config.setDcvsEnable = 1;
-          dcvsConfig->dcvsV3Config.dcvsEnable = 0; // 禁用DCVS以锁定高频
-          dcvsConfig->dcvsV3Config.powerMode =
-              QNN_HTP_PERF_INFRASTRUCTURE_POWERMODE_PERFORMANCE_MODE;
-
-          // 配置HMX (如果SoC支持)
-          QnnHtpPerfInfrastructure_PowerConfig_t *hmxConfig =
-              new QnnHtpPerfInfrastructure_PowerConfig_t();
-          memset(hmxConfig, 0, sizeof(QnnHtpPerfInfrastructure_PowerConfig_t));
-          hmxConfig->option =
-              QNN_HTP_PERF_INFRASTRUCTURE_POWER_CONFIGOPTION_HMX_V2;
-          hmxConfig->hmxV2Config.hmxPickDefault = 0;
-          hmxConfig->hmxV2Config.hmxPerfMode =
-              QNN_HTP_PERF_INFRASTRUCTURE_CLK_PERF_HIGH;
-          hmxConfig->hmxV2Config.hmxVoltageCornerMin = DCVS_EXP_VCORNER_TUR;
-          hmxConfig->hmxV2Config.hmxVoltageCornerTarget = DCVS_EXP_VCORNER_TUR;
-          hmxConfig->hmxV2Config.hmxVoltageCornerMax = DCVS_EXP_VCORNER_TUR;
-
-          // 配置RPC Control Latency
-          QnnHtpPerfInfrastructure_PowerConfig_t *rpcLatencyConfig =
-              new QnnHtpPerfInfrastructure_PowerConfig_t();
-          memset(rpcLatencyConfig, 0,
-                 sizeof(QnnHtpPerfInfrastructure_PowerConfig_t));
-          rpcLatencyConfig->option =
-              QNN_HTP_PERF_INFRASTRUCTURE_POWER_CONFIGOPTION_RPC_CONTROL_LATENCY;
-          rpcLatencyConfig->rpcControlLatencyConfig = 100; // 建议值100us
-
-          // 配置RPC Polling Time
-          QnnHtpPerfInfrastructure_PowerConfig_t *rpcPollingConfig =
-              new QnnHtpPerfInfrastructure_PowerConfig_t();
-          memset(rpcPollingConfig, 0,
-                 sizeof(QnnHtpPerfInfrastructure_PowerConfig_t));
-          rpcPollingConfig->option =
-              QNN_HTP_PERF_INFRASTRUCTURE_POWER_CONFIGOPTION_RPC_POLLING_TIME;
-          rpcPollingConfig->rpcPollingTimeConfig = 1000;
-
-          // 创建电源配置数组
-          const QnnHtpPerfInfrastructure_PowerConfig_t **powerConfigs =
-              new const QnnHtpPerfInfrastructure_PowerConfig_t *[5];
-          powerConfigs[0] = dcvsConfig;
-          powerConfigs[1] = hmxConfig;
-          powerConfigs[2] = rpcLatencyConfig;
-          powerConfigs[3] = rpcPollingConfig;
-          powerConfigs[4] = nullptr;
-
-          // 应用电源配置
-          if (USE_CUSTOM_PARAMS) {
-            perfResult = perfInfra.setPowerConfig(powerConfigId, powerConfigs);
-            if (perfResult == QNN_SUCCESS) {
-              QNN_INFO("应用电源配置成功");
-            } else {
-              QNN_ERROR("应用电源配置失败: %d", perfResult);
-            }
-          }
-        }
+  if (m_isBinaryModel || m_loadedFromCache) {
+    m_startupStats.contextCreateMs = m_binaryLoadStats.contextCreateMs;
+  }
+
+  // 自动预热所有图，使第一次用户请求即达到稳态速度。
+  // 预热用的张量随后释放，之后仍可以调用 enableSharedMemory
+  if (warmupRuns > 0) {
+    phaseStart = Clock::now();
+    for (uint32_t graphIdx = 0; graphIdx < m_graphsCount; graphIdx++) {
+      WarmupStats warmupStats;
+      if (StatusCode::SUCCESS != warmup(warmupRuns, warmupStats, static_cast<int>(graphIdx))) {
+        QNN_WARN("Warm-up of graph %u failed", graphIdx);
       }
     }
-  }
+    tearDownAllTensors();
+    m_startupStats.warmupMs = elapsedMs(phaseStart);
+  }
+  m_startupStats.binary = m_binaryLoadStats;
+  m_startupStats.peakRssAfterKb = datautil::readPeakRssKb();
+  m_startupStats.totalMs = elapsedMs(startupStart);
+  m_startupComplete = true;
+  QNN_INFO("Startup: %s", m_startupStats.toJson().c_str());
 }
 
 sample_app::QnnSampleApp::~QnnSampleApp() {
 
-  m_ioTensor.tearDownInputAndOutputTensors(
-    m_storedInputs, m_storedOutputs,
-    (*m_graphsInfo)[0].numInputTensors,
-    (*m_graphsInfo)[0].numOutputTensors);
-  m_storedInputs = nullptr;
-  m_storedOutputs = nullptr;
-  m_currentGraphIndex = -1;
+  // backend 仍可能在写入在途组的输出，必须等其完成后再释放张量
+  waitForAsyncExecutions();
+  tearDownAllTensors();
 
   // Free Profiling object if it was created
   if (nullptr != m_profileBackendHandle) {
@@ -453,9 +299,11 @@ sample_app::QnnSampleApp::~QnnSampleApp() {
     }
   }
   m_isContextCreated = false;
-  // Terminate backend
-  if (m_isBackendInitialized &&
-      nullptr != m_qnnFunctionPointers.qnnInterface.backendFree) {
+  // Terminate backend；共享 backend 只释放本实例的引用
+  if (m_sharedBackend) {
+    m_sharedBackend.reset();
+  } else if (m_isBackendInitialized &&
+             nullptr != m_qnnFunctionPointers.qnnInterface.backendFree) {
     QNN_DEBUG("Freeing backend");
     if (QNN_BACKEND_NO_ERROR !=
         m_qnnFunctionPointers.qnnInterface.backendFree(m_backendHandle)) {
@@ -541,6 +389,13 @@ sample_app::StatusCode sample_app::QnnSampleApp::initializeBackend() {
 
 // Terminate the backend after done.
 sample_app::StatusCode sample_app::QnnSampleApp::terminateBackend() {
+  if (m_sharedBackend) {
+    m_sharedBackend.reset();
+    m_backendHandle        = nullptr;
+    m_deviceHandle         = nullptr;
+    m_isBackendInitialized = false;
+    return StatusCode::SUCCESS;
+  }
   if ((m_isBackendInitialized &&
        nullptr != m_qnnFunctionPointers.qnnInterface.backendFree) &&
       QNN_BACKEND_NO_ERROR !=
@@ -608,6 +463,9 @@ sample_app::StatusCode sample_app::QnnSampleApp::createContext() {
 
 // Free context after done.
 sample_app::StatusCode sample_app::QnnSampleApp::freeContext() {
+  // 注册过的共享内存属于该上下文，必须在释放上下文之前注销
+  waitForAsyncExecutions();
+  tearDownAllTensors();
   if (QNN_CONTEXT_NO_ERROR != m_qnnFunctionPointers.qnnInterface.contextFree(
                                   m_context, m_profileBackendHandle)) {
     QNN_ERROR("Could not free context");
@@ -657,108 +515,481 @@ sample_app::StatusCode sample_app::QnnSampleApp::createFromBinary() {
     QNN_ERROR("No name provided to read binary file from.");
     return StatusCode::FAILURE;
   }
-  if (nullptr == m_qnnFunctionPointers.qnnSystemInterface.systemContextCreate ||
-      nullptr ==
-          m_qnnFunctionPointers.qnnSystemInterface.systemContextGetBinaryInfo ||
-      nullptr == m_qnnFunctionPointers.qnnSystemInterface.systemContextFree) {
-    QNN_ERROR("QNN System function pointers are not populated.");
-    return StatusCode::FAILURE;
-  }
+  LoadedContext loaded;
+  auto returnStatus = loadContextBinary(m_cachedBinaryPath, loaded);
+  m_context          = loaded.context;
+  m_isContextCreated = nullptr != m_context;
+  m_graphsInfo       = loaded.graphsInfo;
+  m_graphsCount      = loaded.graphsCount;
+  m_graphInfoIndex   = std::move(loaded.graphInfoIndex);
+  m_binaryLoadStats  = loaded.stats;
+  return returnStatus;
+}
+
+sample_app::StatusCode
+sample_app::QnnSampleApp::loadContextBinary(const std::string &binaryPath,
+                                            LoadedContext &loaded) {
+  using Clock = std::chrono::steady_clock;
+  auto elapsedMs = [](Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  };
+  auto loadStart = Clock::now();
+  loaded.stats.peakRssBeforeKb = datautil::readPeakRssKb();
+
   uint64_t bufferSize{0};
+  uint8_t *binaryData{nullptr};
+  // 优先映射文件，binary 直接交给 system/context API，不在堆上复制一份
+  datautil::MappedFile mappedBinary;
   std::shared_ptr<uint8_t> buffer{nullptr};
-  // read serialized binary into a byte buffer
-  tools::datautil::StatusCode status{tools::datautil::StatusCode::SUCCESS};
-  std::tie(status, bufferSize) =
-      tools::datautil::getFileSize(m_cachedBinaryPath);
-  if (0 == bufferSize) {
-    QNN_ERROR("Received path to an empty file. Nothing to deserialize.");
-    return StatusCode::FAILURE;
-  }
-  buffer = std::shared_ptr<uint8_t>(new uint8_t[bufferSize],
-                                    std::default_delete<uint8_t[]>());
-  if (!buffer) {
-    QNN_ERROR("Failed to allocate memory.");
-    return StatusCode::FAILURE;
-  }
+  if (mappedBinary.map(binaryPath)) {
+    binaryData = mappedBinary.data();
+    bufferSize = mappedBinary.size();
+    loaded.stats.mapped = true;
+    loaded.stats.heapBytesAvoided = bufferSize;
+  } else {
+    QNN_WARN("Falling back to reading context binary into memory");
+    // read serialized binary into a byte buffer
+    tools::datautil::StatusCode status{tools::datautil::StatusCode::SUCCESS};
+    std::tie(status, bufferSize) =
+        tools::datautil::getFileSize(binaryPath);
+    if (0 == bufferSize) {
+      QNN_ERROR("Received path to an empty file. Nothing to deserialize.");
+      return StatusCode::FAILURE;
+    }
+    buffer = std::shared_ptr<uint8_t>(new uint8_t[bufferSize],
+                                      std::default_delete<uint8_t[]>());
+    if (!buffer) {
+      QNN_ERROR("Failed to allocate memory.");
+      return StatusCode::FAILURE;
+    }
 
-  status = tools::datautil::readBinaryFromFile(
-      m_cachedBinaryPath, reinterpret_cast<uint8_t *>(buffer.get()),
-      bufferSize);
-  if (status != tools::datautil::StatusCode::SUCCESS) {
-    QNN_ERROR("Failed to read binary data.");
-    return StatusCode::FAILURE;
+    status = tools::datautil::readBinaryFromFile(
+        binaryPath, reinterpret_cast<uint8_t *>(buffer.get()),
+        bufferSize);
+    if (status != tools::datautil::StatusCode::SUCCESS) {
+      QNN_ERROR("Failed to read binary data.");
+      return StatusCode::FAILURE;
+    }
+    if (!m_startupComplete) {
+      m_startupStats.heapBytesAllocated += bufferSize;
+    }
+    binaryData = buffer.get();
   }
+  loaded.stats.fileSize = bufferSize;
+  loaded.stats.readMs = elapsedMs(loadStart);
 
-  // inspect binary info
   auto returnStatus = StatusCode::SUCCESS;
-  QnnSystemContext_Handle_t sysCtxHandle{nullptr};
-  if (QNN_SUCCESS !=
-      m_qnnFunctionPointers.qnnSystemInterface.systemContextCreate(
-          &sysCtxHandle)) {
-    QNN_ERROR("Could not create system handle.");
-    returnStatus = StatusCode::FAILURE;
-  }
-  const QnnSystemContext_BinaryInfo_t *binaryInfo{nullptr};
-  Qnn_ContextBinarySize_t binaryInfoSize{0};
-  if (StatusCode::SUCCESS == returnStatus &&
-      QNN_SUCCESS !=
-          m_qnnFunctionPointers.qnnSystemInterface.systemContextGetBinaryInfo(
-              sysCtxHandle, static_cast<void *>(buffer.get()), bufferSize,
-              &binaryInfo, &binaryInfoSize)) {
-    QNN_ERROR("Failed to get context binary info");
-    returnStatus = StatusCode::FAILURE;
-  }
+  auto infoStart = Clock::now();
+  // 优先使用图元数据 sidecar，命中时不再创建 system context 解析 binary info
+  loaded.graphInfoIndex = graphindex::GraphInfoIndex::load(binaryPath,
+                                                      binaryData, bufferSize);
+  if (loaded.graphInfoIndex) {
+    loaded.graphsInfo  = loaded.graphInfoIndex->graphsInfo();
+    loaded.graphsCount = loaded.graphInfoIndex->graphsCount();
+    loaded.stats.metadataFromSidecar = true;
+  } else {
+    if (nullptr == m_qnnFunctionPointers.qnnSystemInterface.systemContextCreate ||
+        nullptr ==
+            m_qnnFunctionPointers.qnnSystemInterface.systemContextGetBinaryInfo ||
+        nullptr == m_qnnFunctionPointers.qnnSystemInterface.systemContextFree) {
+      QNN_ERROR("QNN System function pointers are not populated.");
+      return StatusCode::FAILURE;
+    }
+    // inspect binary info
+    QnnSystemContext_Handle_t sysCtxHandle{nullptr};
+    if (QNN_SUCCESS !=
+        m_qnnFunctionPointers.qnnSystemInterface.systemContextCreate(
+            &sysCtxHandle)) {
+      QNN_ERROR("Could not create system handle.");
+      returnStatus = StatusCode::FAILURE;
+    }
+    const QnnSystemContext_BinaryInfo_t *binaryInfo{nullptr};
+    Qnn_ContextBinarySize_t binaryInfoSize{0};
+    if (StatusCode::SUCCESS == returnStatus &&
+        QNN_SUCCESS !=
+            m_qnnFunctionPointers.qnnSystemInterface.systemContextGetBinaryInfo(
+                sysCtxHandle, static_cast<void *>(binaryData), bufferSize,
+                &binaryInfo, &binaryInfoSize)) {
+      QNN_ERROR("Failed to get context binary info");
+      returnStatus = StatusCode::FAILURE;
+    }
 
-  // fill GraphInfo_t based on binary info
-  if (StatusCode::SUCCESS == returnStatus &&
-      !copyMetadataToGraphsInfo(binaryInfo, m_graphsInfo, m_graphsCount)) {
-    QNN_ERROR("Failed to copy metadata.");
-    returnStatus = StatusCode::FAILURE;
+    // fill GraphInfo_t based on binary info
+    auto copyStart = Clock::now();
+    if (StatusCode::SUCCESS == returnStatus &&
+        !copyMetadataToGraphsInfo(binaryInfo, loaded.graphsInfo, loaded.graphsCount)) {
+      QNN_ERROR("Failed to copy metadata.");
+      returnStatus = StatusCode::FAILURE;
+    }
+    loaded.stats.copyMetadataMs = elapsedMs(copyStart);
+    m_qnnFunctionPointers.qnnSystemInterface.systemContextFree(sysCtxHandle);
+    sysCtxHandle = nullptr;
+    // 写出 sidecar 供下次加载使用，目录只读时静默跳过
+    if (StatusCode::SUCCESS == returnStatus) {
+      graphindex::GraphInfoIndex::write(binaryPath, binaryData,
+                                        bufferSize, loaded.graphsInfo, loaded.graphsCount);
+    }
   }
-  m_qnnFunctionPointers.qnnSystemInterface.systemContextFree(sysCtxHandle);
-  sysCtxHandle = nullptr;
+  loaded.stats.binaryInfoMs = elapsedMs(infoStart);
 
   if (StatusCode::SUCCESS == returnStatus &&
       nullptr == m_qnnFunctionPointers.qnnInterface.contextCreateFromBinary) {
     QNN_ERROR("contextCreateFromBinaryFnHandle is nullptr.");
     returnStatus = StatusCode::FAILURE;
   }
+  auto createStart = Clock::now();
   if (StatusCode::SUCCESS == returnStatus &&
       m_qnnFunctionPointers.qnnInterface.contextCreateFromBinary(
           m_backendHandle, m_deviceHandle,
           (const QnnContext_Config_t **)m_contextConfig,
-          static_cast<void *>(buffer.get()), bufferSize, &m_context,
+          static_cast<void *>(binaryData), bufferSize, &loaded.context,
           m_profileBackendHandle)) {
     QNN_ERROR("Could not create context from binary.");
     returnStatus = StatusCode::FAILURE;
   }
+  loaded.stats.contextCreateMs = elapsedMs(createStart);
+  // 上下文创建后 backend 不再需要 binary，立即释放映射/缓冲区
+  mappedBinary.unmap();
+  buffer.reset();
+  loaded.stats.totalMs = elapsedMs(loadStart);
+  loaded.stats.peakRssAfterKb = datautil::readPeakRssKb();
+  QNN_INFO("Context binary %s (%.1f MB): read %.1f ms, binary info %.1f ms, "
+           "context create %.1f ms, total %.1f ms, peak RSS %llu -> %llu KB, "
+           "heap copy avoided %.1f MB",
+           loaded.stats.mapped ? "mapped" : "read",
+           bufferSize / (1024.0 * 1024.0), loaded.stats.readMs,
+           loaded.stats.binaryInfoMs, loaded.stats.contextCreateMs,
+           loaded.stats.totalMs,
+           static_cast<unsigned long long>(loaded.stats.peakRssBeforeKb),
+           static_cast<unsigned long long>(loaded.stats.peakRssAfterKb),
+           loaded.stats.heapBytesAvoided / (1024.0 * 1024.0));
   if (ProfilingLevel::OFF != m_profilingLevel) {
     extractBackendProfilingInfo(m_profileBackendHandle);
   }
-  m_isContextCreated = true;
+  auto retrieveStart = Clock::now();
   if (StatusCode::SUCCESS == returnStatus) {
-    for (size_t graphIdx = 0; graphIdx < m_graphsCount; graphIdx++) {
+    for (size_t graphIdx = 0; graphIdx < loaded.graphsCount; graphIdx++) {
       if (nullptr == m_qnnFunctionPointers.qnnInterface.graphRetrieve) {
         QNN_ERROR("graphRetrieveFnHandle is nullptr.");
         returnStatus = StatusCode::FAILURE;
         break;
       }
       if (QNN_SUCCESS != m_qnnFunctionPointers.qnnInterface.graphRetrieve(
-                             m_context, (*m_graphsInfo)[graphIdx].graphName,
-                             &((*m_graphsInfo)[graphIdx].graph))) {
+                             loaded.context, (*loaded.graphsInfo)[graphIdx].graphName,
+                             &((*loaded.graphsInfo)[graphIdx].graph))) {
         QNN_ERROR("Unable to retrieve graph handle for graph Idx: %d",
                   graphIdx);
         returnStatus = StatusCode::FAILURE;
       }
     }
   }
+  loaded.stats.graphRetrieveMs = elapsedMs(retrieveStart);
   if (StatusCode::SUCCESS != returnStatus) {
     QNN_DEBUG("Cleaning up graph Info structures.");
-    qnn_wrapper_api::freeGraphsInfo(&m_graphsInfo, m_graphsCount);
+    freeGraphsInfo(loaded.graphInfoIndex, loaded.graphsInfo, loaded.graphsCount);
   }
   return returnStatus;
 }
 
+sample_app::StatusCode
+sample_app::QnnSampleApp::swapModel(const std::string &binaryPath) {
+  if (binaryPath.length() < 4 ||
+      binaryPath.rfind(".bin") != binaryPath.length() - 4) {
+    QNN_ERROR("Model swap requires a context binary (.bin), got %s",
+              binaryPath.c_str());
+    return StatusCode::FAILURE;
+  }
+  if (!m_isBackendInitialized) {
+    QNN_ERROR("Cannot swap model before the backend is initialized");
+    return StatusCode::FAILURE;
+  }
+  if (nullptr == m_qnnFunctionPointers.qnnSystemInterface.systemContextCreate &&
+      m_sharedBackend) {
+    // 原模型是 .so 时还没有加载 System 库
+    std::string backendDir =
+        std::filesystem::path(m_sharedBackend->backendPath).parent_path().string();
+    dynamicloadutil::getQnnSystemFunctionPointers(
+        backendDir + "/libQnnSystem.so", &m_qnnFunctionPointers);
+  }
+
+  using Clock = std::chrono::steady_clock;
+  auto swapStart = Clock::now();
+  // 先让在途的异步执行在旧图上完成，之后持有执行锁，新的执行都会等到切换结束
+  waitForAsyncExecutions();
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  std::lock_guard<std::mutex> ringLock(m_ringMutex);
+  if (m_inFlight > 0) {
+    QNN_ERROR("Cannot swap model while async executions are in flight");
+    return StatusCode::FAILURE;
+  }
+  for (auto &graph : m_graphTensors) {
+    for (auto &set : graph.ring) {
+      if (set.state != TensorSetState::FREE) {
+        QNN_ERROR("Cannot swap model while tensor sets are in use");
+        return StatusCode::FAILURE;
+      }
+    }
+  }
+
+  // 新模型先加载到局部变量，成功之后才替换旧模型；失败时旧模型保持可用
+  LoadedContext loaded;
+  if (StatusCode::SUCCESS != loadContextBinary(binaryPath, loaded)) {
+    QNN_ERROR("Failed to swap model to %s, keeping the current model",
+              binaryPath.c_str());
+    if (nullptr != loaded.context) {
+      m_qnnFunctionPointers.qnnInterface.contextFree(loaded.context, nullptr);
+    }
+    return StatusCode::FAILURE;
+  }
+
+  // 张量的个数来自旧图信息，且注册的共享内存属于旧 context，必须最先释放
+  tearDownAllTensors();
+  if (m_isContextCreated && nullptr != m_context &&
+      QNN_CONTEXT_NO_ERROR != m_qnnFunctionPointers.qnnInterface.contextFree(
+                                  m_context, m_profileBackendHandle)) {
+    QNN_WARN("Could not free previous context");
+  }
+  releaseGraphsInfo();
+  // 旧模型是 .so 时，其 context 释放后模型库不再需要
+  if (m_ownedModelHandle) {
+    pal::dynamicloading::dlClose(m_ownedModelHandle);
+    m_ownedModelHandle = nullptr;
+    m_qnnFunctionPointers.composeGraphsFnHandle = nullptr;
+    m_qnnFunctionPointers.freeGraphInfoFnHandle = nullptr;
+  }
+
+  m_context          = loaded.context;
+  m_isContextCreated = true;
+  m_graphsInfo       = loaded.graphsInfo;
+  m_graphsCount      = loaded.graphsCount;
+  m_graphInfoIndex   = std::move(loaded.graphInfoIndex);
+  m_binaryLoadStats  = loaded.stats;
+  m_cachedBinaryPath = binaryPath;
+  m_isBinaryModel    = true;
+  m_loadedFromCache  = false;
+  m_warmupStats.clear();
+  // 异步执行能力与 context 有关，切换后重新检测
+  m_asyncSupported   = -1;
+  QNN_INFO("Swapped model to %s in %.1f ms (context create %.1f ms)",
+           binaryPath.c_str(),
+           std::chrono::duration<double, std::milli>(Clock::now() - swapStart).count(),
+           m_binaryLoadStats.contextCreateMs);
+  return StatusCode::SUCCESS;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::applyHtpGraphConfig() {
+  const auto &htpConfig = m_backendCfg.htpConfig;
+  if (htpConfig.optimizationLevel < 1 || htpConfig.optimizationLevel > 3) {
+    QNN_ERROR("HTP optimization level must be within [1, 3], got %d",
+              htpConfig.optimizationLevel);
+    return StatusCode::FAILURE;
+  }
+  using PrecisionMode = BackendConfig::HtpConfig::PrecisionMode;
+  if (htpConfig.precisionMode != PrecisionMode::FLOAT32 &&
+      htpConfig.precisionMode != PrecisionMode::FLOAT16 &&
+      htpConfig.precisionMode != PrecisionMode::DEFAULT) {
+    QNN_ERROR("Invalid HTP precision mode %d",
+              static_cast<int>(htpConfig.precisionMode));
+    return StatusCode::FAILURE;
+  }
+  // 设备信息来自共享 backend，不可用时跳过与设备相关的检查
+  if (m_sharedBackend && m_sharedBackend->vtcmSizeMb > 0 &&
+      htpConfig.vtcmSizeMb > m_sharedBackend->vtcmSizeMb) {
+    QNN_ERROR("Requested VTCM size %u MB exceeds the %u MB available on SoC %u",
+              htpConfig.vtcmSizeMb, m_sharedBackend->vtcmSizeMb,
+              m_sharedBackend->socModel);
+    return StatusCode::FAILURE;
+  }
+  // 自动模式只在设备明确报告支持时启用 DLBC，显式启用而设备不支持时才算错误
+  bool dlbcKnown     = m_sharedBackend && m_sharedBackend->socModel != 0;
+  bool dlbcSupported = dlbcKnown && m_sharedBackend->dlbcSupported;
+  bool enableDlbc    = htpConfig.enableDlbc < 0 ? dlbcSupported : htpConfig.enableDlbc != 0;
+  if (htpConfig.enableDlbc < 0 && !dlbcSupported) {
+    QNN_WARN("DLBC %s on this device, leaving it disabled",
+             dlbcKnown ? "is not supported" : "support is unknown");
+  }
+  if (dlbcKnown && !dlbcSupported &&
+      (htpConfig.enableDlbc > 0 || htpConfig.enableDlbcWeights)) {
+    QNN_ERROR("DLBC is not supported on SoC %u", m_sharedBackend->socModel);
+    return StatusCode::FAILURE;
+  }
+  if (nullptr == m_qnnFunctionPointers.qnnInterface.graphSetConfig) {
+    if (htpConfig.explicitConfig) {
+      QNN_ERROR("graphSetConfig is not available");
+      return StatusCode::FAILURE;
+    }
+    QNN_WARN("graphSetConfig is not available, using backend default graph config");
+    return StatusCode::SUCCESS;
+  }
+
+  std::vector<QnnHtpGraph_CustomConfig_t> customConfigs;
+  customConfigs.reserve(6);
+  QnnHtpGraph_CustomConfig_t customConfig{};
+
+  customConfig.option = QNN_HTP_GRAPH_CONFIG_OPTION_VTCM_SIZE;
+  customConfig.vtcmSizeInMB =
+      htpConfig.vtcmSizeMb > 0 ? htpConfig.vtcmSizeMb : QNN_HTP_GRAPH_CONFIG_OPTION_MAX;
+  customConfigs.push_back(customConfig);
+
+  if (htpConfig.precisionMode != PrecisionMode::DEFAULT) {
+    customConfig = QnnHtpGraph_CustomConfig_t{};
+    customConfig.option = QNN_HTP_GRAPH_CONFIG_OPTION_PRECISION;
+    customConfig.precision = static_cast<Qnn_Precision_t>(htpConfig.precisionMode);
+    customConfigs.push_back(customConfig);
+  }
+
+  customConfig = QnnHtpGraph_CustomConfig_t{};
+  customConfig.option = QNN_HTP_GRAPH_CONFIG_OPTION_OPTIMIZATION;
+  customConfig.optimizationOption.type =
+      QNN_HTP_GRAPH_OPTIMIZATION_TYPE_FINALIZE_OPTIMIZATION_FLAG;
+  customConfig.optimizationOption.floatValue =
+      static_cast<float>(htpConfig.optimizationLevel);
+  customConfigs.push_back(customConfig);
+
+  customConfig = QnnHtpGraph_CustomConfig_t{};
+  customConfig.option = QNN_HTP_GRAPH_CONFIG_OPTION_NUM_HVX_THREADS;
+  customConfig.numHvxThreads =
+      htpConfig.numHvxThreads > 0 ? htpConfig.numHvxThreads : UINT64_MAX;
+  customConfigs.push_back(customConfig);
+
+  if (enableDlbc) {
+    customConfig = QnnHtpGraph_CustomConfig_t{};
+    customConfig.option = QNN_HTP_GRAPH_CONFIG_OPTION_OPTIMIZATION;
+    customConfig.optimizationOption.type = QNN_HTP_GRAPH_OPTIMIZATION_TYPE_ENABLE_DLBC;
+    customConfig.optimizationOption.floatValue = 1.0f;
+    customConfigs.push_back(customConfig);
+  }
+  if (htpConfig.enableDlbcWeights) {
+    customConfig = QnnHtpGraph_CustomConfig_t{};
+    customConfig.option = QNN_HTP_GRAPH_CONFIG_OPTION_OPTIMIZATION;
+    customConfig.optimizationOption.type =
+        QNN_HTP_GRAPH_OPTIMIZATION_TYPE_ENABLE_DLBC_WEIGHTS;
+    customConfig.optimizationOption.floatValue = 1.0f;
+    customConfigs.push_back(customConfig);
+  }
+
+  std::vector<QnnGraph_Config_t> graphConfigs(customConfigs.size());
+  std::vector<const QnnGraph_Config_t *> graphConfigPtrs;
+  for (size_t i = 0; i < customConfigs.size(); i++) {
+    graphConfigs[i].option = QNN_GRAPH_CONFIG_OPTION_CUSTOM;
+    graphConfigs[i].customConfig = &customConfigs[i];
+    graphConfigPtrs.push_back(&graphConfigs[i]);
+  }
+  graphConfigPtrs.push_back(nullptr);
+
+  for (uint32_t graphIdx = 0; graphIdx < m_graphsCount; graphIdx++) {
+    Qnn_ErrorHandle_t result = m_qnnFunctionPointers.qnnInterface.graphSetConfig(
+        (*m_graphsInfo)[graphIdx].graph, graphConfigPtrs.data());
+    if (QNN_SUCCESS != result) {
+      if (htpConfig.explicitConfig) {
+        QNN_ERROR("graphSetConfig failed for graph %s: %lu",
+                  (*m_graphsInfo)[graphIdx].graphName,
+                  static_cast<unsigned long>(result));
+        return StatusCode::FAILURE;
+      }
+      QNN_WARN("graphSetConfig failed for graph %s: %lu, using backend default graph config",
+               (*m_graphsInfo)[graphIdx].graphName, static_cast<unsigned long>(result));
+    }
+  }
+  QNN_INFO("Applied HTP graph config: O%d, precision %d, VTCM %u MB, HVX threads %llu, "
+           "DLBC %d, DLBC weights %d",
+           htpConfig.optimizationLevel, static_cast<int>(htpConfig.precisionMode),
+           htpConfig.vtcmSizeMb, static_cast<unsigned long long>(htpConfig.numHvxThreads),
+           enableDlbc ? 1 : 0, htpConfig.enableDlbcWeights ? 1 : 0);
+  return StatusCode::SUCCESS;
+}
+
+std::string
+sample_app::QnnSampleApp::contextCacheFingerprint(const std::string &backendPath) {
+  // 格式版本，缓存布局或 key 的组成变化时递增，使旧缓存全部失效
+  std::string fingerprint = "qnn-context-cache-v1";
+  fingerprint += "|" + std::filesystem::path(backendPath).filename().string();
+  fingerprint += "|" + getBackendBuildId();
+
+  std::string platform = "unknown";
+  if (backendPath.find("Htp") != std::string::npos &&
+      nullptr != m_qnnFunctionPointers.qnnInterface.deviceGetPlatformInfo) {
+    const QnnDevice_PlatformInfo_t *platformInfo = nullptr;
+    if (QNN_SUCCESS ==
+            m_qnnFunctionPointers.qnnInterface.deviceGetPlatformInfo(
+                nullptr, &platformInfo) &&
+        nullptr != platformInfo && platformInfo->v1.numHwDevices > 0 &&
+        nullptr != platformInfo->v1.hwDevices[0].v1.deviceInfoExtension) {
+      auto &onChipDevice =
+          platformInfo->v1.hwDevices[0].v1.deviceInfoExtension->onChipDevice;
+      platform = "soc" + std::to_string(onChipDevice.socModel) + "-arch" +
+                 std::to_string(static_cast<int>(onChipDevice.arch));
+    }
+    if (nullptr != platformInfo &&
+        nullptr != m_qnnFunctionPointers.qnnInterface.deviceFreePlatformInfo) {
+      m_qnnFunctionPointers.qnnInterface.deviceFreePlatformInfo(nullptr,
+                                                                platformInfo);
+    }
+  }
+  fingerprint += "|" + platform;
+  const auto &htpConfig = m_backendCfg.htpConfig;
+  fingerprint += "|opt" + std::to_string(htpConfig.optimizationLevel) + "|prec" +
+                 std::to_string(static_cast<int>(htpConfig.precisionMode)) + "|vtcm" +
+                 std::to_string(htpConfig.vtcmSizeMb) + "|hvx" +
+                 std::to_string(htpConfig.numHvxThreads) + "|dlbc" +
+                 std::to_string(htpConfig.enableDlbc) +
+                 std::to_string(htpConfig.enableDlbcWeights ? 1 : 0);
+  fingerprint += USE_CUSTOM_PARAMS ? "|custom" : "|default";
+  QNN_DEBUG("Context cache fingerprint: %s", fingerprint.c_str());
+  return fingerprint;
+}
+
+bool sample_app::QnnSampleApp::loadFromContextCache(
+    const std::string &backendPath, const std::string &cachedPath) {
+  if (nullptr == m_qnnFunctionPointers.qnnSystemInterface.systemContextCreate) {
+    std::string backendDir =
+        std::filesystem::path(backendPath).parent_path().string();
+    if (dynamicloadutil::StatusCode::SUCCESS !=
+        dynamicloadutil::getQnnSystemFunctionPointers(
+            backendDir + "/libQnnSystem.so", &m_qnnFunctionPointers)) {
+      QNN_WARN("QNN system library unavailable, context cache disabled");
+      return false;
+    }
+  }
+  m_cachedBinaryPath = cachedPath;
+  if (StatusCode::SUCCESS == createFromBinary()) {
+    QNN_INFO("Loaded compiled context from cache %s", cachedPath.c_str());
+    return true;
+  }
+
+  // 缓存可能已损坏或与当前 backend 不兼容，清理后回退到正常编译
+  QNN_WARN("Failed to load cached context %s, recompiling", cachedPath.c_str());
+  releaseGraphsInfo();
+  if (m_context != nullptr) {
+    freeContext();
+  }
+  m_context          = nullptr;
+  m_isContextCreated = false;
+  m_cachedBinaryPath.clear();
+  m_binaryLoadStats = BinaryLoadStats();
+  return false;
+}
+
+void sample_app::QnnSampleApp::storeToContextCache(
+    const contextcache::ContextCache &cache, const std::string &key) {
+  if (!cache.prepare()) {
+    return;
+  }
+  // 写缓存失败不影响本次运行，只是下次启动仍需编译
+  std::string stagingPath = cache.stagingPath(key);
+  if (StatusCode::SUCCESS != writeContextBinary(stagingPath)) {
+    QNN_WARN("Failed to store compiled context in cache");
+    cache.discardStaging(stagingPath);
+    return;
+  }
+  if (!cache.commit(stagingPath, key)) {
+    QNN_WARN("Failed to store compiled context in cache");
+    return;
+  }
+  QNN_INFO("Stored compiled context in cache as %s", key.c_str());
+  cache.evict(key);
+}
+
 sample_app::StatusCode
 sample_app::QnnSampleApp::saveBinary(std::string outputPath,
                                      std::string saveBinaryName) {
@@ -766,6 +997,11 @@ sample_app::QnnSampleApp::saveBinary(std::string outputPath,
     QNN_ERROR("No name provided to save binary file.");
     return StatusCode::FAILURE;
   }
+  return writeContextBinary((std::filesystem::path(outputPath) / (saveBinaryName + ".bin")).string());
+}
+
+// 把当前 context 序列化写到 filePath，所在目录不存在时会创建
+sample_app::StatusCode sample_app::QnnSampleApp::writeContextBinary(const std::string &filePath) {
   if (nullptr == m_qnnFunctionPointers.qnnInterface.contextGetBinarySize ||
       nullptr == m_qnnFunctionPointers.qnnInterface.contextGetBinary) {
     QNN_ERROR(
@@ -799,19 +1035,24 @@ sample_app::QnnSampleApp::saveBinary(std::string outputPath,
     return StatusCode::FAILURE;
   }
 
+  std::filesystem::path path(filePath);
   auto dataUtilStatus = tools::datautil::writeBinaryToFile(
-      outputPath, saveBinaryName + ".bin", (uint8_t *)saveBuffer.get(),
+      path.parent_path().string(), path.filename().string(), (uint8_t *)saveBuffer.get(),
       writtenBufferSize);
   if (tools::datautil::StatusCode::SUCCESS != dataUtilStatus) {
     QNN_ERROR("Error while writing binary to file.");
     return StatusCode::FAILURE;
   }
+  // 只统计构造期间（写编译缓存）的分配，之后显式保存不计入启动统计
+  if (!m_startupComplete) {
+    m_startupStats.heapBytesAllocated += requiredBufferSize;
+  }
 
   return StatusCode::SUCCESS;
 }
 
 sample_app::StatusCode sample_app::QnnSampleApp::extractBackendProfilingInfo(
-    Qnn_ProfileHandle_t profileHandle) {
+    Qnn_ProfileHandle_t profileHandle, std::vector<ProfileEvent> *events) {
   if (nullptr == m_profileBackendHandle) {
     QNN_ERROR("Backend Profile handle is nullptr; may not be initialized.");
     return StatusCode::FAILURE;
@@ -826,14 +1067,17 @@ sample_app::StatusCode sample_app::QnnSampleApp::extractBackendProfilingInfo(
   }
   QNN_DEBUG("ProfileEvents: [%p], numEvents: [%d]", profileEvents, numEvents);
   for (size_t event = 0; event < numEvents; event++) {
-    extractProfilingEvent(*(profileEvents + event));
-    extractProfilingSubEvents(*(profileEvents + event));
+    if (StatusCode::SUCCESS != extractProfilingEvent(*(profileEvents + event), events)) {
+      continue;
+    }
+    int32_t index = events ? static_cast<int32_t>(events->size()) - 1 : -1;
+    extractProfilingSubEvents(*(profileEvents + event), events, index);
   }
   return StatusCode::SUCCESS;
 }
 
 sample_app::StatusCode sample_app::QnnSampleApp::extractProfilingSubEvents(
-    QnnProfile_EventId_t profileEventId) {
+    QnnProfile_EventId_t profileEventId, std::vector<ProfileEvent> *events, int32_t parent) {
   const QnnProfile_EventId_t *profileSubEvents{nullptr};
   uint32_t numSubEvents{0};
   if (QNN_PROFILE_NO_ERROR !=
@@ -845,14 +1089,18 @@ sample_app::StatusCode sample_app::QnnSampleApp::extractProfilingSubEvents(
   QNN_DEBUG("ProfileSubEvents: [%p], numSubEvents: [%d]", profileSubEvents,
             numSubEvents);
   for (size_t subEvent = 0; subEvent < numSubEvents; subEvent++) {
-    extractProfilingEvent(*(profileSubEvents + subEvent));
-    extractProfilingSubEvents(*(profileSubEvents + subEvent));
+    if (StatusCode::SUCCESS !=
+        extractProfilingEvent(*(profileSubEvents + subEvent), events, parent)) {
+      continue;
+    }
+    int32_t index = events ? static_cast<int32_t>(events->size()) - 1 : -1;
+    extractProfilingSubEvents(*(profileSubEvents + subEvent), events, index);
   }
   return StatusCode::SUCCESS;
 }
 
 sample_app::StatusCode sample_app::QnnSampleApp::extractProfilingEvent(
-    QnnProfile_EventId_t profileEventId) {
+    QnnProfile_EventId_t profileEventId, std::vector<ProfileEvent> *events, int32_t parent) {
   QnnProfile_EventData_t eventData;
   if (QNN_PROFILE_NO_ERROR !=
       m_qnnFunctionPointers.qnnInterface.profileGetEventData(profileEventId,
@@ -864,9 +1112,167 @@ sample_app::StatusCode sample_app::QnnSampleApp::extractProfilingEvent(
             "], Event Identifier: [%s], Event Unit: [%d]",
             eventData.type, eventData.value, eventData.identifier,
             eventData.unit);
+  if (events) {
+    ProfileEvent event;
+    event.eventId    = static_cast<uint64_t>(profileEventId);
+    event.identifier = eventData.identifier ? eventData.identifier : "";
+    event.type       = static_cast<uint32_t>(eventData.type);
+    event.unit       = static_cast<uint32_t>(eventData.unit);
+    event.value      = eventData.value;
+    event.parent     = parent;
+    event.depth      = parent >= 0 ? (*events)[parent].depth + 1 : 0;
+    events->push_back(std::move(event));
+  }
+  return StatusCode::SUCCESS;
+}
+
+// backend 事件没有时间戳，按层级放进执行区间：顶层事件（QNN/RPC/加速器耗时等）本身相互包含，
+// 都从执行开始处对齐；子事件在父区间内按先序依次排列，微秒单位直接使用，
+// cycles 单位按兄弟事件的占比分摊父区间。其它单位（字节、计数）只出现在 JSON 结果中
+static void traceProfileEvents(const sample_app::ExecutionProfile &profile,
+                               const std::vector<std::vector<size_t>> &children,
+                               const std::vector<size_t> &siblings,
+                               bool sequential,
+                               uint64_t startUs,
+                               uint64_t spanUs,
+                               uint32_t tid) {
+  uint64_t cycleTotal = 0;
+  for (size_t idx : siblings) {
+    if (QNN_PROFILE_EVENTUNIT_CYCLES == profile.events[idx].unit) {
+      cycleTotal += profile.events[idx].value;
+    }
+  }
+  uint64_t cursor = startUs;
+  uint64_t endUs  = startUs + spanUs;
+  for (size_t idx : siblings) {
+    const sample_app::ProfileEvent &event = profile.events[idx];
+    uint64_t durationUs;
+    if (QNN_PROFILE_EVENTUNIT_MICROSEC == event.unit) {
+      durationUs = event.value;
+    } else if (QNN_PROFILE_EVENTUNIT_CYCLES == event.unit && cycleTotal > 0) {
+      durationUs = static_cast<uint64_t>(static_cast<double>(spanUs) * event.value / cycleTotal);
+    } else {
+      continue;
+    }
+    uint64_t eventStart = sequential ? cursor : startUs;
+    durationUs          = std::min(durationUs, endUs - eventStart);
+    tracing::Tracer::instance().addComplete(
+        event.identifier, "backend", eventStart, durationUs, tid,
+        "\"unit\":" + std::to_string(event.unit) + ",\"value\":" + std::to_string(event.value) +
+            ",\"sequence\":" + std::to_string(profile.sequence));
+    traceProfileEvents(profile, children, children[idx], true, eventStart, durationUs, tid);
+    if (sequential) {
+      cursor += durationUs;
+    }
+  }
+}
+
+void sample_app::QnnSampleApp::recordExecutionProfile(int graphIdx,
+                                                      bool async,
+                                                      std::chrono::steady_clock::time_point start,
+                                                      std::chrono::steady_clock::time_point end) {
+  ExecutionProfile profile;
+  profile.graphIdx = graphIdx;
+  profile.async    = async;
+  profile.startUs  = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(start.time_since_epoch()).count());
+  profile.wallMs = std::chrono::duration<double, std::milli>(end - start).count();
+  if (StatusCode::SUCCESS != extractBackendProfilingInfo(m_profileBackendHandle, &profile.events)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_profileMutex);
+  profile.sequence = m_profileSequence++;
+  if (tracing::Tracer::instance().enabled()) {
+    std::vector<std::vector<size_t>> children(profile.events.size());
+    std::vector<size_t> roots;
+    for (size_t i = 0; i < profile.events.size(); i++) {
+      if (profile.events[i].parent < 0) {
+        roots.push_back(i);
+      } else {
+        children[profile.events[i].parent].push_back(i);
+      }
+    }
+    uint64_t wallUs = static_cast<uint64_t>(profile.wallMs * 1000.0);
+    traceProfileEvents(profile, children, roots, false, profile.startUs, wallUs,
+                       tracing::currentThreadId());
+  }
+  m_profileHistory.push_back(std::move(profile));
+  while (m_profileHistory.size() > m_profileHistorySize) {
+    m_profileHistory.pop_front();
+  }
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::setProfiling(ProfilingLevel level,
+                                                              uint32_t historySize) {
+  if (level == ProfilingLevel::INVALID || historySize == 0) {
+    QNN_ERROR("Invalid profiling level or history size %u", historySize);
+    return StatusCode::FAILURE;
+  }
+  // 等待在途的原生异步执行完成，之后持有执行锁，不会有执行在使用 profile 句柄
+  waitForAsyncExecutions();
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  bool active = nullptr != m_profileBackendHandle;
+  if (level != m_profilingLevel || active != (ProfilingLevel::OFF != level)) {
+    if (nullptr != m_profileBackendHandle) {
+      if (QNN_PROFILE_NO_ERROR !=
+          m_qnnFunctionPointers.qnnInterface.profileFree(m_profileBackendHandle)) {
+        QNN_ERROR("Could not free backend profile handle.");
+      }
+      m_profileBackendHandle = nullptr;
+    }
+    m_profilingLevel = level;
+    if (ProfilingLevel::OFF != level &&
+        StatusCode::SUCCESS != initializeProfiling()) {
+      m_profileBackendHandle = nullptr;
+      m_profilingLevel       = ProfilingLevel::OFF;
+      return StatusCode::FAILURE;
+    }
+    clearProfiles();
+  }
+  std::lock_guard<std::mutex> lock(m_profileMutex);
+  m_profileHistorySize = historySize;
+  while (m_profileHistory.size() > m_profileHistorySize) {
+    m_profileHistory.pop_front();
+  }
   return StatusCode::SUCCESS;
 }
 
+size_t sample_app::QnnSampleApp::getProfileCount() {
+  std::lock_guard<std::mutex> lock(m_profileMutex);
+  return m_profileHistory.size();
+}
+
+bool sample_app::QnnSampleApp::getProfile(size_t back, ExecutionProfile &profile) {
+  std::lock_guard<std::mutex> lock(m_profileMutex);
+  if (back >= m_profileHistory.size()) {
+    return false;
+  }
+  profile = m_profileHistory[m_profileHistory.size() - 1 - back];
+  return true;
+}
+
+std::string sample_app::QnnSampleApp::getProfilesJson(size_t maxCount) {
+  std::lock_guard<std::mutex> lock(m_profileMutex);
+  size_t count = m_profileHistory.size();
+  if (maxCount > 0 && maxCount < count) {
+    count = maxCount;
+  }
+  std::string json = "[";
+  for (size_t i = m_profileHistory.size() - count; i < m_profileHistory.size(); i++) {
+    if (json.size() > 1) {
+      json += ",";
+    }
+    json += m_profileHistory[i].toJson();
+  }
+  json += "]";
+  return json;
+}
+
+void sample_app::QnnSampleApp::clearProfiles() {
+  std::lock_guard<std::mutex> lock(m_profileMutex);
+  m_profileHistory.clear();
+}
+
 sample_app::StatusCode
 sample_app::QnnSampleApp::verifyFailReturnStatus(Qnn_ErrorHandle_t errCode) {
   auto returnStatus = sample_app::StatusCode::FAILURE;
@@ -916,6 +1322,10 @@ sample_app::StatusCode sample_app::QnnSampleApp::createDevice() {
 }
 
 sample_app::StatusCode sample_app::QnnSampleApp::freeDevice() {
+  if (m_sharedBackend) {
+    // device 归共享 backend 所有，随最后一个引用释放
+    return StatusCode::SUCCESS;
+  }
   if (nullptr != m_qnnFunctionPointers.qnnInterface.deviceFree) {
     auto qnnStatus =
         m_qnnFunctionPointers.qnnInterface.deviceFree(m_deviceHandle);
@@ -928,39 +1338,79 @@ sample_app::StatusCode sample_app::QnnSampleApp::freeDevice() {
   return StatusCode::SUCCESS;
 }
 
+// 绑定了共享内存的张量组执行时使用 memHandle 类型的张量
+static Qnn_Tensor_t *execTensors(Qnn_Tensor_t *tensors,
+                                 const std::unique_ptr<sharedmem::TensorBinding> &binding) {
+  return binding ? binding->execTensors() : tensors;
+}
+
 // executeGraphs() that is currently used by qnn-sample-app's main.cpp.
-// This function runs all the graphs present in model.so by reading
-// inputs from input_list based files and writes output to .raw files.
+// 执行当前图；尚未准备过任何图时执行图 0
 sample_app::StatusCode sample_app::QnnSampleApp::executeGraphs() {
-  // 目前仅支持单图模式，添加断言保证只有一张图
-  if (m_graphsCount != 1) {
-    QNN_ERROR("Only single graph is supported in executeGraphs for now.");
+  return executeGraph(m_currentGraphIndex >= 0 ? m_currentGraphIndex : 0);
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::executeGraph(int graphIdx) {
+  // 先持执行锁再检查索引、取张量指针，swapModel 无法在两者之间替换模型
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (graphIdx < 0 || static_cast<size_t>(graphIdx) >= m_graphsCount) {
+    QNN_ERROR("Invalid graph index %d for execution.", graphIdx);
     return StatusCode::FAILURE;
   }
 
-  m_currentGraphIndex = 0;
-
   // 检查持久化张量的初始化状态
-  if (m_currentGraphIndex != 0 || m_storedInputs == nullptr ||
-      m_storedOutputs == nullptr) {
-    QNN_ERROR(
-        "Persistent tensors are not properly initialized for graph index 0. "
-        "m_currentGraphIndex: %d, m_storedInputs: %p, m_storedOutputs: %p",
-        m_currentGraphIndex, m_storedInputs, m_storedOutputs);
+  if (!tensorsReady(graphIdx)) {
+    QNN_ERROR("Persistent tensors are not initialized for graph index %d.",
+              graphIdx);
     return StatusCode::FAILURE;
   }
+  m_currentGraphIndex = graphIdx;
+  auto &primary = m_graphTensors[graphIdx].primary;
+  return executeWithTensors(graphIdx, execTensors(primary.inputs, primary.inputBinding),
+                            execTensors(primary.outputs, primary.outputBinding));
+}
 
+// 用给定的一组输入/输出张量执行图，同一实例上的执行互斥
+sample_app::StatusCode sample_app::QnnSampleApp::executeWithTensors(
+    int graphIdx, Qnn_Tensor_t *inputs, Qnn_Tensor_t *outputs) {
   auto returnStatus = StatusCode::SUCCESS;
-  QNN_DEBUG("Starting execution for graph index 0");
+  QNN_DEBUG("Starting execution for graph index %d", graphIdx);
 
+  std::lock_guard<std::recursive_mutex> lock(m_executeMutex);
+  // 调用者可能在持锁前取得索引，这里再检查一次
+  if (graphIdx < 0 || static_cast<size_t>(graphIdx) >= m_graphsCount) {
+    QNN_ERROR("Invalid graph index %d for execution.", graphIdx);
+    return StatusCode::FAILURE;
+  }
   // 不再使用循环执行多次推理，只执行一次
-  Qnn_ErrorHandle_t executeStatus =
-      m_qnnFunctionPointers.qnnInterface.graphExecute(
-          (*m_graphsInfo)[0].graph, m_storedInputs,
-          (*m_graphsInfo)[0].numInputTensors, m_storedOutputs,
-          (*m_graphsInfo)[0].numOutputTensors, m_profileBackendHandle, nullptr);
+  const auto &graphInfo = (*m_graphsInfo)[graphIdx];
+  PowerManager *powerManager = getPowerManager();
+  if (powerManager) {
+    powerManager->beginExecute();
+  }
+  auto executeStart = std::chrono::steady_clock::now();
+  Qnn_ErrorHandle_t executeStatus;
+  {
+    tracing::TraceSpan span("graphExecute", "qnn");
+    executeStatus = m_qnnFunctionPointers.qnnInterface.graphExecute(
+        graphInfo.graph, inputs, graphInfo.numInputTensors, outputs,
+        graphInfo.numOutputTensors, m_profileBackendHandle, nullptr);
+  }
+  auto executeEnd = std::chrono::steady_clock::now();
+  if (powerManager) {
+    powerManager->endExecute();
+  }
+  m_executions.fetch_add(1, std::memory_order_relaxed);
+  if (QNN_GRAPH_NO_ERROR == executeStatus) {
+    m_executeHistogram.record(executeEnd - executeStart);
+  } else {
+    m_executionFailures.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (nullptr != m_profileBackendHandle && QNN_GRAPH_NO_ERROR == executeStatus) {
+    recordExecutionProfile(graphIdx, false, executeStart, executeEnd);
+  }
   if (QNN_GRAPH_NO_ERROR != executeStatus) {
-    QNN_ERROR("Execution of graph failed");
+    QNN_ERROR("Execution of graph %s failed", graphInfo.graphName);
     returnStatus = StatusCode::FAILURE;
   }
 
@@ -968,91 +1418,155 @@ sample_app::StatusCode sample_app::QnnSampleApp::executeGraphs() {
   return returnStatus;
 }
 
+sample_app::StatusCode
+sample_app::QnnSampleApp::executeGraph(const std::string &graphName) {
+  int graphIdx = getGraphIndex(graphName);
+  if (graphIdx < 0) {
+    QNN_ERROR("Graph %s not found.", graphName.c_str());
+    return StatusCode::FAILURE;
+  }
+  return executeGraph(graphIdx);
+}
+
+int sample_app::QnnSampleApp::getGraphIndex(const std::string &graphName) const {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  for (uint32_t i = 0; i < m_graphsCount; i++) {
+    const char *name = (*m_graphsInfo)[i].graphName;
+    if (name != nullptr && graphName == name) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+const char *sample_app::QnnSampleApp::getGraphName(int graphIdx) const {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (graphIdx < 0 || static_cast<size_t>(graphIdx) >= m_graphsCount) {
+    return nullptr;
+  }
+  return (*m_graphsInfo)[graphIdx].graphName;
+}
+
 // 修改 loadFloatInputs：不再内部初始化持久化张量，要求在调用前已完成初始化
 sample_app::StatusCode sample_app::QnnSampleApp::loadFloatInputs(
     const std::vector<std::vector<float>> &inputData, int graphIdx) {
+  std::vector<const float *> inputs(inputData.size());
+  std::vector<size_t> sizes(inputData.size());
+  for (size_t i = 0; i < inputData.size(); i++) {
+    inputs[i] = inputData[i].data();
+    sizes[i] = inputData[i].size();
+  }
+  return loadFloatInputs(inputs.data(), sizes.data(), inputs.size(), graphIdx);
+}
+
+// 指针版本：直接从调用者数组量化到持久化输入张量，不经过中间 vector
+sample_app::StatusCode sample_app::QnnSampleApp::loadFloatInputs(
+    const float *const *inputs, const size_t *sizes, size_t numInputs,
+    int graphIdx) {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
   if (static_cast<size_t>(graphIdx) >= m_graphsCount) {
     QNN_ERROR("Invalid graph index %d for loading float inputs.", graphIdx);
     return StatusCode::FAILURE;
   }
 
-  QNN_INFO("numInputTensors: %d", (*m_graphsInfo)[graphIdx].numInputTensors);
-  QNN_INFO("numOutputTensors: %d", (*m_graphsInfo)[graphIdx].numOutputTensors);
-  QNN_INFO("graphName: %s", (*m_graphsInfo)[graphIdx].graphName);
+  QNN_DEBUG("numInputTensors: %d", (*m_graphsInfo)[graphIdx].numInputTensors);
+  QNN_DEBUG("numOutputTensors: %d", (*m_graphsInfo)[graphIdx].numOutputTensors);
+  QNN_DEBUG("graphName: %s", (*m_graphsInfo)[graphIdx].graphName);
 
-  // 如果持久化张量未初始化或者图索引不匹配，则进行初始化
-  if (m_storedInputs == nullptr || m_storedOutputs == nullptr ||
-      m_currentGraphIndex != graphIdx) {
-    QNN_INFO(
-        "Persistent tensors not initialized for graphIdx: %d, initializing...",
-        graphIdx);
-    if (iotensor::StatusCode::SUCCESS !=
-        m_ioTensor.setupInputAndOutputTensors(&m_storedInputs, &m_storedOutputs,
-                                              (*m_graphsInfo)[graphIdx])) {
-      QNN_ERROR("Error in setting up Input and output Tensors for graphIdx: %d",
-                graphIdx);
-      return StatusCode::FAILURE;
-    }
+  if (prepareTensors(graphIdx) != StatusCode::SUCCESS) {
+    return StatusCode::FAILURE;
   }
-  QNN_INFO("m_storedInputs: %p", m_storedInputs);
-  QNN_INFO("m_storedOutputs: %p", m_storedOutputs);
 
-  uint32_t numInputs = (*m_graphsInfo)[graphIdx].numInputTensors;
-  if (inputData.size() < numInputs) {
+  QNN_DEBUG("Loading float inputs for graphIdx: %d", graphIdx);
+  if (copyFloatsToTensors(m_graphTensors[graphIdx].primary.inputs,
+                          (*m_graphsInfo)[graphIdx].numInputTensors, inputs,
+                          sizes, numInputs) != StatusCode::SUCCESS) {
+    return StatusCode::FAILURE;
+  }
+
+  QNN_DEBUG("All float inputs loaded for graphIdx: %d", graphIdx);
+  return StatusCode::SUCCESS;
+}
+
+// 将调用者的 float 数组量化写入一组输入张量
+sample_app::StatusCode sample_app::QnnSampleApp::copyFloatsToTensors(
+    Qnn_Tensor_t *tensors, uint32_t numTensors, const float *const *inputs,
+    const size_t *sizes, size_t numInputs) {
+  tracing::TraceSpan span("copyFloatsToTensors", "qnn");
+  auto stagingStart = std::chrono::steady_clock::now();
+  uint64_t bytes    = 0;
+  if (m_inputDataType == iotensor::InputDataType::NATIVE) {
+    QNN_ERROR("Input data type is NATIVE, use loadNativeInputs instead.");
+    return StatusCode::FAILURE;
+  }
+  if (inputs == nullptr || sizes == nullptr || numInputs < numTensors) {
     QNN_ERROR("Provided input data count (%zu) is less than required input "
               "tensors (%d).",
-              inputData.size(), numInputs);
+              numInputs, numTensors);
     return StatusCode::FAILURE;
   }
 
-  QNN_DEBUG("Loading float inputs for graphIdx: %d", graphIdx);
-  for (uint32_t i = 0; i < numInputs; i++) {
+  for (uint32_t i = 0; i < numTensors; i++) {
+    const uint32_t *dims = QNN_TENSOR_GET_DIMENSIONS(tensors[i]);
+    uint32_t rank        = QNN_TENSOR_GET_RANK(tensors[i]);
+    if (dims == nullptr) {
+      QNN_ERROR("Could not retrieve dimensions for input tensor %d", i);
+      return StatusCode::FAILURE;
+    }
+    size_t numElements = datautil::calculateElementCount(dims, rank);
+    if (inputs[i] == nullptr || sizes[i] < numElements) {
+      QNN_ERROR("Input %d too small: %zu < %zu elements", i, sizes[i],
+                numElements);
+      return StatusCode::FAILURE;
+    }
     // 将 float 数据复制到持久化输入张量
-    if (m_ioTensor.copyFromFloatToNative(
-            const_cast<float *>(inputData[i].data()), &m_storedInputs[i]) !=
+    if (m_ioTensor.copyFromFloatToNative(const_cast<float *>(inputs[i]),
+                                         &tensors[i]) !=
         iotensor::StatusCode::SUCCESS) {
       QNN_ERROR("Failed to copy float data to input tensor %d", i);
       return StatusCode::FAILURE;
     }
-    // Debug：打印张量维度和部分数据
-    std::vector<size_t> dims;
-    if (m_ioTensor.fillDims(dims, QNN_TENSOR_GET_DIMENSIONS(m_storedInputs[i]),
-                            QNN_TENSOR_GET_RANK(m_storedInputs[i])) ==
-        iotensor::StatusCode::SUCCESS) {
-      size_t numElements = datautil::calculateElementCount(dims);
+    bytes += numElements * sizeof(float);
+    // Debug：打印张量维度和部分数据，只在 DEBUG 级别拼接字符串
+    if (log::isLogInitialized() && log::getLogLevel() >= QNN_LOG_LEVEL_DEBUG) {
       std::string dimsStr;
-      for (size_t d : dims) {
-        dimsStr += std::to_string(d) + " ";
+      for (uint32_t d = 0; d < rank; d++) {
+        dimsStr += std::to_string(dims[d]) + " ";
       }
       QNN_DEBUG("Input tensor %d dimensions: %s", i, dimsStr.c_str());
       std::string sampleStr;
       for (size_t j = 0; j < std::min(numElements, (size_t)5); j++) {
-        sampleStr += std::to_string(inputData[i][j]) + " ";
+        sampleStr += std::to_string(inputs[i][j]) + " ";
       }
       QNN_DEBUG("Input tensor %d first 5 elements: %s", i, sampleStr.c_str());
-    } else {
-      QNN_WARN("Could not retrieve dimensions for input tensor %d", i);
     }
   }
-
-  QNN_INFO("All float inputs loaded for graphIdx: %d", graphIdx);
+  m_inputStagingHistogram.record(std::chrono::steady_clock::now() - stagingStart);
+  m_bytesConverted.fetch_add(bytes, std::memory_order_relaxed);
   return StatusCode::SUCCESS;
 }
 
 // 修改 getFloatOutputs：不再做懒初始化，而是直接使用持久化张量
 sample_app::StatusCode sample_app::QnnSampleApp::getFloatOutputs(
     std::vector<std::vector<float>> &outputData, int graphIdx) {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
   if (static_cast<size_t>(graphIdx) >= m_graphsCount) {
     QNN_ERROR("Invalid graph index %d for getting float outputs.", graphIdx);
     return StatusCode::FAILURE;
   }
+  if (m_outputDataType == iotensor::OutputDataType::NATIVE_ONLY) {
+    QNN_ERROR("Output data type is NATIVE_ONLY, use getNativeOutputs instead.");
+    return StatusCode::FAILURE;
+  }
 
-  if (m_storedInputs == nullptr || m_storedOutputs == nullptr ||
-      m_currentGraphIndex != graphIdx) {
+  if (!tensorsReady(graphIdx)) {
     QNN_ERROR("Persistent tensors are not initialized for graphIdx: %d",
               graphIdx);
     return StatusCode::FAILURE;
   }
+  Qnn_Tensor_t *storedOutputs = m_graphTensors[graphIdx].primary.outputs;
+  auto conversionStart        = std::chrono::steady_clock::now();
+  uint64_t bytes              = 0;
 
   uint32_t numOutputs = (*m_graphsInfo)[graphIdx].numOutputTensors;
   outputData.clear();
@@ -1060,58 +1574,948 @@ sample_app::StatusCode sample_app::QnnSampleApp::getFloatOutputs(
 
   QNN_DEBUG("Retrieving float outputs for graphIdx: %d", graphIdx);
   for (uint32_t i = 0; i < numOutputs; i++) {
-    float *floatBuffer = nullptr;
-    if (m_ioTensor.convertToFloat(&floatBuffer, &m_storedOutputs[i]) !=
-        iotensor::StatusCode::SUCCESS) {
-      QNN_ERROR("Failed to convert output tensor %d to float", i);
+    // 获取输出张量的维度信息，计算元素总数
+    const uint32_t *dims = QNN_TENSOR_GET_DIMENSIONS(storedOutputs[i]);
+    uint32_t rank        = QNN_TENSOR_GET_RANK(storedOutputs[i]);
+    if (dims == nullptr) {
+      QNN_ERROR("Failed to get dimensions for output tensor %d", i);
       return StatusCode::FAILURE;
     }
+    size_t numElements = datautil::calculateElementCount(dims, rank);
 
-    // 获取输出张量的维度信息，计算元素总数
-    std::vector<size_t> dims;
-    if (m_ioTensor.fillDims(dims, QNN_TENSOR_GET_DIMENSIONS(m_storedOutputs[i]),
-                            QNN_TENSOR_GET_RANK(m_storedOutputs[i])) !=
+    // 直接反量化到结果 vector 中，不再经过中间 malloc 缓冲区
+    outputData[i].resize(numElements);
+    float *floatBuffer = outputData[i].data();
+    if (m_ioTensor.copyFromNativeToFloat(floatBuffer, &storedOutputs[i]) !=
         iotensor::StatusCode::SUCCESS) {
-      QNN_ERROR("Failed to get dimensions for output tensor %d", i);
+      QNN_ERROR("Failed to convert output tensor %d to float", i);
       return StatusCode::FAILURE;
     }
-    size_t numElements = datautil::calculateElementCount(dims);
+    bytes += numElements * sizeof(float);
 
-    std::string dimsStr;
-    for (size_t d : dims) {
-      dimsStr += std::to_string(d) + " ";
-    }
-    QNN_DEBUG("Output tensor %d dimensions: %s", i, dimsStr.c_str());
+    if (log::isLogInitialized() && log::getLogLevel() >= QNN_LOG_LEVEL_DEBUG) {
+      std::string dimsStr;
+      for (uint32_t d = 0; d < rank; d++) {
+        dimsStr += std::to_string(dims[d]) + " ";
+      }
+      QNN_DEBUG("Output tensor %d dimensions: %s", i, dimsStr.c_str());
 
-    std::string sampleStr;
-    for (size_t j = 0; j < std::min(numElements, (size_t)5); j++) {
-      sampleStr += std::to_string(floatBuffer[j]) + " ";
+      std::string sampleStr;
+      for (size_t j = 0; j < std::min(numElements, (size_t)5); j++) {
+        sampleStr += std::to_string(floatBuffer[j]) + " ";
+      }
+      QNN_DEBUG("Output tensor %d first 5 elements: %s", i, sampleStr.c_str());
     }
-    QNN_DEBUG("Output tensor %d first 5 elements: %s", i, sampleStr.c_str());
-
-    std::vector<float> tensorData(floatBuffer, floatBuffer + numElements);
-    outputData[i] = tensorData;
-    free(floatBuffer); // 假设 convertToFloat 分配的内存需要释放
   }
 
-  QNN_INFO("Float outputs retrieved for graphIdx: %d", graphIdx);
-
-  // // 新增：释放持久化输入/输出张量，供后续重新初始化使用
-  // m_ioTensor.tearDownInputAndOutputTensors(
-  //     m_storedInputs, m_storedOutputs,
-  //     (*m_graphsInfo)[graphIdx].numInputTensors,
-  //     (*m_graphsInfo)[graphIdx].numOutputTensors);
-  // m_storedInputs = nullptr;
-  // m_storedOutputs = nullptr;
-  // m_currentGraphIndex = -1;
+  m_outputConversionHistogram.record(std::chrono::steady_clock::now() - conversionStart);
+  m_bytesConverted.fetch_add(bytes, std::memory_order_relaxed);
+  QNN_DEBUG("Float outputs retrieved for graphIdx: %d", graphIdx);
 
   return StatusCode::SUCCESS;
 }
 
-// 添加缺失的initialize()方法实现
-sample_app::StatusCode sample_app::QnnSampleApp::initialize() {
-  throw std::runtime_error("initialize is deprecated!!!");
-  // initialize是一个顶层接口，它组合了整个初始化流程
+// 反量化到调用者提供的缓冲区，每个缓冲区容量以 float 元素个数计
+sample_app::StatusCode sample_app::QnnSampleApp::getFloatOutputsInto(
+    float *const *outputs, const size_t *capacities, size_t numBuffers,
+    int graphIdx) {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (static_cast<size_t>(graphIdx) >= m_graphsCount) {
+    QNN_ERROR("Invalid graph index %d for getting float outputs.", graphIdx);
+    return StatusCode::FAILURE;
+  }
+  if (!tensorsReady(graphIdx)) {
+    QNN_ERROR("Persistent tensors are not initialized for graphIdx: %d",
+              graphIdx);
+    return StatusCode::FAILURE;
+  }
+  return copyTensorsToFloats(m_graphTensors[graphIdx].primary.outputs,
+                             (*m_graphsInfo)[graphIdx].numOutputTensors,
+                             outputs, capacities, numBuffers);
+}
+
+// 将一组输出张量反量化到调用者提供的 float 缓冲区
+sample_app::StatusCode sample_app::QnnSampleApp::copyTensorsToFloats(
+    Qnn_Tensor_t *tensors, uint32_t numTensors, float *const *outputs,
+    const size_t *capacities, size_t numBuffers) {
+  tracing::TraceSpan span("copyTensorsToFloats", "qnn");
+  auto conversionStart = std::chrono::steady_clock::now();
+  uint64_t bytes       = 0;
+  if (m_outputDataType == iotensor::OutputDataType::NATIVE_ONLY) {
+    QNN_ERROR("Output data type is NATIVE_ONLY, use getNativeOutputs instead.");
+    return StatusCode::FAILURE;
+  }
+  if (outputs == nullptr || capacities == nullptr || numBuffers < numTensors) {
+    QNN_ERROR("Provided output buffer count (%zu) is less than output "
+              "tensors (%d).",
+              numBuffers, numTensors);
+    return StatusCode::FAILURE;
+  }
+
+  for (uint32_t i = 0; i < numTensors; i++) {
+    size_t numElements = datautil::calculateElementCount(QNN_TENSOR_GET_DIMENSIONS(tensors[i]),
+                                                         QNN_TENSOR_GET_RANK(tensors[i]));
+    if (outputs[i] == nullptr || capacities[i] < numElements) {
+      QNN_ERROR("Output buffer %d too small: %zu < %zu elements", i,
+                capacities[i], numElements);
+      return StatusCode::FAILURE;
+    }
+    if (m_ioTensor.copyFromNativeToFloat(outputs[i], &tensors[i]) !=
+        iotensor::StatusCode::SUCCESS) {
+      QNN_ERROR("Failed to convert output tensor %d to float", i);
+      return StatusCode::FAILURE;
+    }
+    bytes += numElements * sizeof(float);
+  }
+  m_outputConversionHistogram.record(std::chrono::steady_clock::now() - conversionStart);
+  m_bytesConverted.fetch_add(bytes, std::memory_order_relaxed);
+  return StatusCode::SUCCESS;
+}
+
+// 计算张量原生数据的字节数
+static sample_app::StatusCode nativeTensorLength(const Qnn_Tensor_t &tensor, size_t &length) {
+  datautil::StatusCode status;
+  std::tie(status, length) =
+      datautil::calculateLength(QNN_TENSOR_GET_DIMENSIONS(tensor), QNN_TENSOR_GET_RANK(tensor),
+                                QNN_TENSOR_GET_DATA_TYPE(tensor));
+  return status == datautil::StatusCode::SUCCESS
+             ? sample_app::StatusCode::SUCCESS
+             : sample_app::StatusCode::FAILURE;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::loadNativeInputs(
+    const void *const *inputs, const size_t *sizes, size_t numInputs,
+    int graphIdx) {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (prepareTensors(graphIdx) != StatusCode::SUCCESS) {
+    return StatusCode::FAILURE;
+  }
+  Qnn_Tensor_t *storedInputs = m_graphTensors[graphIdx].primary.inputs;
+  uint32_t numInputTensors = (*m_graphsInfo)[graphIdx].numInputTensors;
+  if (inputs == nullptr || sizes == nullptr || numInputs < numInputTensors) {
+    QNN_ERROR("Provided input data count (%zu) is less than required input "
+              "tensors (%d).",
+              numInputs, numInputTensors);
+    return StatusCode::FAILURE;
+  }
+  for (uint32_t i = 0; i < numInputTensors; i++) {
+    size_t length = 0;
+    if (nativeTensorLength(storedInputs[i], length) !=
+        StatusCode::SUCCESS) {
+      QNN_ERROR("Failed to calculate length of input tensor %d", i);
+      return StatusCode::FAILURE;
+    }
+    if (inputs[i] == nullptr || sizes[i] != length) {
+      QNN_ERROR("Input %d size mismatch: got %zu bytes, expected %zu bytes", i,
+                sizes[i], length);
+      return StatusCode::FAILURE;
+    }
+    void *dst = QNN_TENSOR_GET_CLIENT_BUF(storedInputs[i]).data;
+    // 调用者直接写入了视图缓冲区时无需拷贝
+    if (dst != inputs[i]) {
+      memcpy(dst, inputs[i], length);
+    }
+  }
+  return StatusCode::SUCCESS;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::getNativeOutputs(
+    void *const *outputs, const size_t *capacities, size_t numBuffers,
+    size_t *writtenSizes, int graphIdx) {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (static_cast<size_t>(graphIdx) >= m_graphsCount) {
+    QNN_ERROR("Invalid graph index %d for getting native outputs.", graphIdx);
+    return StatusCode::FAILURE;
+  }
+  if (!tensorsReady(graphIdx)) {
+    QNN_ERROR("Persistent tensors are not initialized for graphIdx: %d",
+              graphIdx);
+    return StatusCode::FAILURE;
+  }
+  Qnn_Tensor_t *storedOutputs = m_graphTensors[graphIdx].primary.outputs;
+  uint32_t numOutputs = (*m_graphsInfo)[graphIdx].numOutputTensors;
+  if (outputs == nullptr || capacities == nullptr || numBuffers < numOutputs) {
+    QNN_ERROR("Provided output buffer count (%zu) is less than output "
+              "tensors (%d).",
+              numBuffers, numOutputs);
+    return StatusCode::FAILURE;
+  }
+  for (uint32_t i = 0; i < numOutputs; i++) {
+    size_t length = 0;
+    if (nativeTensorLength(storedOutputs[i], length) !=
+        StatusCode::SUCCESS) {
+      QNN_ERROR("Failed to calculate length of output tensor %d", i);
+      return StatusCode::FAILURE;
+    }
+    if (outputs[i] == nullptr || capacities[i] < length) {
+      QNN_ERROR("Output buffer %d too small: %zu < %zu bytes", i,
+                capacities[i], length);
+      return StatusCode::FAILURE;
+    }
+    memcpy(outputs[i], QNN_TENSOR_GET_CLIENT_BUF(storedOutputs[i]).data,
+           length);
+    if (writtenSizes != nullptr) {
+      writtenSizes[i] = length;
+    }
+  }
+  return StatusCode::SUCCESS;
+}
+
+// 一次调用完成 输入量化 + 执行 + 输出反量化
+// inputs 为 nullptr 时认为调用者已经通过输入视图写好了数据；
+// outputs 为 nullptr 时跳过输出转换，由调用者通过输出视图读取
+sample_app::StatusCode sample_app::QnnSampleApp::infer(
+    const float *const *inputs, const size_t *sizes, size_t numInputs,
+    float *const *outputs, const size_t *capacities, size_t numOutputs,
+    int graphIdx) {
+  auto inferStart   = std::chrono::steady_clock::now();
+  // 写输入、执行、读输出期间持有执行锁，两次调用的数据不会交错
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  StatusCode status = StatusCode::SUCCESS;
+  if (inputs != nullptr) {
+    status = loadFloatInputs(inputs, sizes, numInputs, graphIdx);
+  } else {
+    status = prepareTensors(graphIdx);
+  }
+  if (status != StatusCode::SUCCESS) {
+    return status;
+  }
+  status = executeGraph(graphIdx);
+  if (status != StatusCode::SUCCESS) {
+    return status;
+  }
+  if (outputs != nullptr) {
+    status = getFloatOutputsInto(outputs, capacities, numOutputs, graphIdx);
+  }
+  if (status == StatusCode::SUCCESS) {
+    m_inferHistogram.record(std::chrono::steady_clock::now() - inferStart);
+  }
+  return status;
+}
+
+// 固定种子，预热结果可复现
+static void fillRandomInputs(Qnn_Tensor_t *inputs, uint32_t numInputs) {
+  std::mt19937 rng(0x5eed);
+  std::uniform_real_distribution<float> floatDist(-1.0f, 1.0f);
+  for (uint32_t i = 0; i < numInputs; i++) {
+    Qnn_ClientBuffer_t buffer = QNN_TENSOR_GET_CLIENT_BUF(inputs[i]);
+    if (buffer.data == nullptr) {
+      continue;
+    }
+    switch (QNN_TENSOR_GET_DATA_TYPE(inputs[i])) {
+      case QNN_DATATYPE_FLOAT_32: {
+        auto *data = static_cast<float *>(buffer.data);
+        for (size_t j = 0; j < buffer.dataSize / sizeof(float); j++) {
+          data[j] = floatDist(rng);
+        }
+        break;
+      }
+      case QNN_DATATYPE_FLOAT_16: {
+        // 直接构造 |x| < 1 的 half 位模式：指数 0..14，尾数随机
+        auto *data = static_cast<uint16_t *>(buffer.data);
+        for (size_t j = 0; j < buffer.dataSize / sizeof(uint16_t); j++) {
+          uint32_t bits = rng();
+          data[j] = static_cast<uint16_t>(((bits >> 31) << 15) | (((bits >> 16) % 15) << 10) |
+                                          (bits & 0x3FF));
+        }
+        break;
+      }
+      case QNN_DATATYPE_BOOL_8: {
+        auto *data = static_cast<uint8_t *>(buffer.data);
+        for (size_t j = 0; j < buffer.dataSize; j++) {
+          data[j] = rng() & 1;
+        }
+        break;
+      }
+      default: {
+        // 定点/整数类型，任意字节都是合法值
+        auto *data = static_cast<uint8_t *>(buffer.data);
+        for (size_t j = 0; j < buffer.dataSize; j++) {
+          data[j] = static_cast<uint8_t>(rng());
+        }
+        break;
+      }
+    }
+  }
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::warmup(uint32_t runs,
+                                                        WarmupStats &stats,
+                                                        int graphIdx,
+                                                        WarmupInput input) {
+  if (runs == 0) {
+    QNN_ERROR("Warm-up needs at least one run");
+    return StatusCode::FAILURE;
+  }
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (StatusCode::SUCCESS != prepareTensors(graphIdx)) {
+    return StatusCode::FAILURE;
+  }
+  auto &primary = m_graphTensors[graphIdx].primary;
+  uint32_t numInputs = (*m_graphsInfo)[graphIdx].numInputTensors;
+  if (WarmupInput::RANDOM == input) {
+    fillRandomInputs(primary.inputs, numInputs);
+  } else if (iotensor::StatusCode::SUCCESS !=
+             std::get<0>(m_ioTensor.populateInputTensorsWithZeros(primary.inputs,
+                                                                  numInputs))) {
+    return StatusCode::FAILURE;
+  }
+
+  using Clock = std::chrono::steady_clock;
+  std::vector<double> latencies;
+  latencies.reserve(runs);
+  for (uint32_t i = 0; i < runs; i++) {
+    auto start = Clock::now();
+    if (StatusCode::SUCCESS != executeGraph(graphIdx)) {
+      QNN_ERROR("Warm-up run %u of graph %d failed", i, graphIdx);
+      return StatusCode::FAILURE;
+    }
+    latencies.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+  }
+
+  stats = WarmupStats();
+  stats.runs = runs;
+  stats.firstRunMs = latencies.front();
+  stats.minMs = *std::min_element(latencies.begin(), latencies.end());
+  stats.maxMs = *std::max_element(latencies.begin(), latencies.end());
+  for (double latency : latencies) {
+    stats.totalMs += latency;
+  }
+  std::vector<double> steady(latencies.size() > 1 ? latencies.begin() + 1 : latencies.begin(),
+                             latencies.end());
+  std::nth_element(steady.begin(), steady.begin() + steady.size() / 2, steady.end());
+  stats.steadyStateMs = steady[steady.size() / 2];
+
+  if (m_warmupStats.size() < m_graphsCount) {
+    m_warmupStats.resize(m_graphsCount);
+  }
+  m_warmupStats[graphIdx] = stats;
+  QNN_INFO("Warm-up of graph %d: %u runs, first %.2f ms, steady state %.2f ms",
+           graphIdx, runs, stats.firstRunMs, stats.steadyStateMs);
+  return StatusCode::SUCCESS;
+}
+
+bool sample_app::QnnSampleApp::getWarmupStats(int graphIdx, WarmupStats &stats) const {
+  // warmup 与 swapModel 在执行锁下修改 m_warmupStats
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (graphIdx < 0 || static_cast<size_t>(graphIdx) >= m_warmupStats.size() ||
+      m_warmupStats[graphIdx].runs == 0) {
+    return false;
+  }
+  stats = m_warmupStats[graphIdx];
+  return true;
+}
+
+sample_app::PowerManager *sample_app::QnnSampleApp::getPowerManager() const {
+  return m_sharedBackend ? m_sharedBackend->powerManager.get() : nullptr;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::setPowerPolicy(
+    PowerProfile active, PowerProfile idle, std::chrono::milliseconds idleTimeout) {
+  PowerManager *powerManager = getPowerManager();
+  if (!powerManager) {
+    QNN_WARN("Power profiles are only available on HTP with custom device config");
+    return StatusCode::QNN_FEATURE_UNSUPPORTED;
+  }
+  powerManager->setPolicy(active, idle, idleTimeout);
+  QNN_INFO("Power policy: active %s, idle %s after %lld ms",
+           PowerManager::profileName(active), PowerManager::profileName(idle),
+           static_cast<long long>(idleTimeout.count()));
+  return StatusCode::SUCCESS;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::pinPowerProfile(PowerProfile profile) {
+  PowerManager *powerManager = getPowerManager();
+  if (!powerManager) {
+    QNN_WARN("Power profiles are only available on HTP with custom device config");
+    return StatusCode::QNN_FEATURE_UNSUPPORTED;
+  }
+  return powerManager->pin(profile) ? StatusCode::SUCCESS : StatusCode::FAILURE;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::unpinPowerProfile() {
+  PowerManager *powerManager = getPowerManager();
+  if (!powerManager) {
+    return StatusCode::QNN_FEATURE_UNSUPPORTED;
+  }
+  powerManager->unpin();
+  return StatusCode::SUCCESS;
+}
+
+bool sample_app::QnnSampleApp::getPowerProfile(PowerProfile &profile) const {
+  PowerManager *powerManager = getPowerManager();
+  if (!powerManager) {
+    return false;
+  }
+  profile = powerManager->currentProfile();
+  return true;
+}
+
+void sample_app::QnnSampleApp::getMetrics(Metrics &metrics, bool reset) {
+  metrics.inputStaging     = m_inputStagingHistogram.summarize(reset);
+  metrics.execute          = m_executeHistogram.summarize(reset);
+  metrics.outputConversion = m_outputConversionHistogram.summarize(reset);
+  metrics.infer            = m_inferHistogram.summarize(reset);
+  if (reset) {
+    metrics.executions     = m_executions.exchange(0, std::memory_order_relaxed);
+    metrics.failures       = m_executionFailures.exchange(0, std::memory_order_relaxed);
+    metrics.bytesConverted = m_bytesConverted.exchange(0, std::memory_order_relaxed);
+  } else {
+    metrics.executions     = m_executions.load(std::memory_order_relaxed);
+    metrics.failures       = m_executionFailures.load(std::memory_order_relaxed);
+    metrics.bytesConverted = m_bytesConverted.load(std::memory_order_relaxed);
+  }
+}
+
+// 持久化张量的懒初始化：每张图首次使用时分配，之后切换图直接复用
+sample_app::StatusCode sample_app::QnnSampleApp::prepareTensors(int graphIdx) {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (graphIdx < 0 || static_cast<size_t>(graphIdx) >= m_graphsCount) {
+    QNN_ERROR("Invalid graph index %d for preparing tensors.", graphIdx);
+    return StatusCode::FAILURE;
+  }
+  if (m_graphTensors.size() < m_graphsCount) {
+    // findTensorSet 只持 m_ringMutex 访问 m_graphTensors，扩容时两把锁都要持有
+    std::lock_guard<std::mutex> ringLock(m_ringMutex);
+    m_graphTensors.resize(m_graphsCount);
+  }
+  if (tensorsReady(graphIdx)) {
+    m_currentGraphIndex = graphIdx;
+    return StatusCode::SUCCESS;
+  }
+
+  QNN_INFO(
+      "Persistent tensors not initialized for graphIdx: %d, initializing...",
+      graphIdx);
+  auto &tensors = m_graphTensors[graphIdx].primary;
+  if (iotensor::StatusCode::SUCCESS !=
+      m_ioTensor.setupInputAndOutputTensors(&tensors.inputs, &tensors.outputs,
+                                            (*m_graphsInfo)[graphIdx])) {
+    QNN_ERROR("Error in setting up Input and output Tensors for graphIdx: %d",
+              graphIdx);
+    tensors.inputs = nullptr;
+    tensors.outputs = nullptr;
+    return StatusCode::FAILURE;
+  }
+  bindSharedMemory(graphIdx, tensors);
+  m_currentGraphIndex = graphIdx;
+  return StatusCode::SUCCESS;
+}
+
+bool sample_app::QnnSampleApp::tensorsReady(int graphIdx) const {
+  return graphIdx >= 0 &&
+         static_cast<size_t>(graphIdx) < m_graphTensors.size() &&
+         m_graphTensors[graphIdx].primary.inputs != nullptr &&
+         m_graphTensors[graphIdx].primary.outputs != nullptr;
+}
+
+// 释放所有图的持久化张量，必须在释放 m_graphsInfo 之前调用
+void sample_app::QnnSampleApp::tearDownAllTensors() {
+  for (size_t i = 0; i < m_graphTensors.size(); i++) {
+    tearDownRing(static_cast<int>(i));
+    auto &tensors = m_graphTensors[i].primary;
+    // 先注销共享内存，IOTensor 只负责释放 RAW 缓冲区
+    tensors.inputBinding.reset();
+    tensors.outputBinding.reset();
+    if (tensors.inputs == nullptr && tensors.outputs == nullptr) {
+      continue;
+    }
+    if (m_graphsInfo != nullptr && i < m_graphsCount) {
+      m_ioTensor.tearDownInputAndOutputTensors(
+          tensors.inputs, tensors.outputs,
+          (*m_graphsInfo)[i].numInputTensors,
+          (*m_graphsInfo)[i].numOutputTensors);
+    }
+    tensors.inputs = nullptr;
+    tensors.outputs = nullptr;
+  }
+  m_graphTensors.clear();
+  m_currentGraphIndex = -1;
+}
+
+static void fillTensorView(const Qnn_Tensor_t &tensor,
+                           sample_app::TensorView &view) {
+  view.name = QNN_TENSOR_GET_NAME(tensor);
+  view.data = QNN_TENSOR_GET_CLIENT_BUF(tensor).data;
+  view.dataSize = QNN_TENSOR_GET_CLIENT_BUF(tensor).dataSize;
+  view.dataType = QNN_TENSOR_GET_DATA_TYPE(tensor);
+  view.rank = QNN_TENSOR_GET_RANK(tensor);
+  view.dims = QNN_TENSOR_GET_DIMENSIONS(tensor);
+  auto quantParams = QNN_TENSOR_GET_QUANT_PARAMS(tensor);
+  if (quantParams.quantizationEncoding ==
+      QNN_QUANTIZATION_ENCODING_SCALE_OFFSET) {
+    view.scale = quantParams.scaleOffsetEncoding.scale;
+    view.offset = quantParams.scaleOffsetEncoding.offset;
+  } else {
+    view.scale = 0.0f;
+    view.offset = 0;
+  }
+}
+
+uint32_t sample_app::QnnSampleApp::getNumInputTensors(int graphIdx) const {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (graphIdx < 0 || static_cast<size_t>(graphIdx) >= m_graphsCount) {
+    return 0;
+  }
+  return (*m_graphsInfo)[graphIdx].numInputTensors;
+}
+
+sample_app::StatusCode
+sample_app::QnnSampleApp::getInputTensorView(uint32_t inputIdx,
+                                             TensorView &view, int graphIdx) {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (prepareTensors(graphIdx) != StatusCode::SUCCESS) {
+    return StatusCode::FAILURE;
+  }
+  if (inputIdx >= (*m_graphsInfo)[graphIdx].numInputTensors) {
+    QNN_ERROR("Invalid input index %u for graphIdx: %d", inputIdx, graphIdx);
+    return StatusCode::FAILURE;
+  }
+  fillTensorView(m_graphTensors[graphIdx].primary.inputs[inputIdx], view);
+  return StatusCode::SUCCESS;
+}
+
+uint32_t sample_app::QnnSampleApp::getNumOutputTensors(int graphIdx) const {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (graphIdx < 0 || static_cast<size_t>(graphIdx) >= m_graphsCount) {
+    return 0;
+  }
+  return (*m_graphsInfo)[graphIdx].numOutputTensors;
+}
+
+sample_app::StatusCode
+sample_app::QnnSampleApp::getOutputTensorView(uint32_t outputIdx,
+                                              TensorView &view, int graphIdx) {
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (prepareTensors(graphIdx) != StatusCode::SUCCESS) {
+    return StatusCode::FAILURE;
+  }
+  if (outputIdx >= (*m_graphsInfo)[graphIdx].numOutputTensors) {
+    QNN_ERROR("Invalid output index %u for graphIdx: %d", outputIdx, graphIdx);
+    return StatusCode::FAILURE;
+  }
+  fillTensorView(m_graphTensors[graphIdx].primary.outputs[outputIdx], view);
+  return StatusCode::SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// 张量组环：每张图额外持有 m_tensorRingSize 组输入/输出张量，供流水线使用。
+// 状态流转：FREE -acquire-> ACQUIRED -submit-> SUBMITTED -> COMPLETED -release-> FREE
+// 状态切换在 m_ringMutex 下进行，填充/读取各组数据时不持锁，因此生产者、执行者、
+// 消费者可以在不同线程上同时操作不同的组。
+// ---------------------------------------------------------------------------
+
+sample_app::StatusCode sample_app::QnnSampleApp::setTensorRingSize(uint32_t size) {
+  if (size < MIN_TENSOR_RING_SIZE || size > MAX_TENSOR_RING_SIZE) {
+    QNN_ERROR("Tensor ring size must be within [%u, %u], got %u",
+              MIN_TENSOR_RING_SIZE, MAX_TENSOR_RING_SIZE, size);
+    return StatusCode::FAILURE;
+  }
+  std::lock_guard<std::mutex> lock(m_ringMutex);
+  for (auto &graph : m_graphTensors) {
+    for (auto &set : graph.ring) {
+      if (set.state != TensorSetState::FREE) {
+        QNN_ERROR("Cannot resize tensor ring while tensor sets are in use");
+        return StatusCode::FAILURE;
+      }
+    }
+  }
+  // 旧的环全部释放，下次 acquire 时按新大小重新分配
+  for (size_t i = 0; i < m_graphTensors.size(); i++) {
+    tearDownRing(static_cast<int>(i));
+  }
+  m_tensorRingSize = size;
+  return StatusCode::SUCCESS;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::acquireTensorSet(int graphIdx,
+                                                                  uint32_t &setIdx) {
+  // 锁顺序与 swapModel 一致：先执行锁再环锁，准备张量和分配环期间模型不会被替换
+  std::lock_guard<std::recursive_mutex> executeLock(m_executeMutex);
+  if (prepareTensors(graphIdx) != StatusCode::SUCCESS) {
+    return StatusCode::FAILURE;
+  }
+  std::lock_guard<std::mutex> lock(m_ringMutex);
+  auto &ring = m_graphTensors[graphIdx].ring;
+  if (ring.empty()) {
+    ring.resize(m_tensorRingSize);
+    for (uint32_t i = 0; i < m_tensorRingSize; i++) {
+      if (iotensor::StatusCode::SUCCESS !=
+          m_ioTensor.setupInputAndOutputTensors(&ring[i].inputs, &ring[i].outputs,
+                                                (*m_graphsInfo)[graphIdx])) {
+        QNN_ERROR("Error in setting up tensor set %u for graphIdx: %d", i,
+                  graphIdx);
+        ring[i].inputs = nullptr;
+        ring[i].outputs = nullptr;
+        tearDownRing(graphIdx);
+        return StatusCode::FAILURE;
+      }
+      bindSharedMemory(graphIdx, ring[i]);
+    }
+  }
+  // 按轮转顺序选择下一组空闲的张量
+  auto &next = m_graphTensors[graphIdx].ringNext;
+  for (size_t n = 0; n < ring.size(); n++) {
+    uint32_t idx = static_cast<uint32_t>((next + n) % ring.size());
+    if (ring[idx].state == TensorSetState::FREE) {
+      ring[idx].state = TensorSetState::ACQUIRED;
+      next = (idx + 1) % ring.size();
+      setIdx = idx;
+      return StatusCode::SUCCESS;
+    }
+  }
+  QNN_WARN("No free tensor set for graphIdx: %d", graphIdx);
+  return StatusCode::FAILURE;
+}
+
+sample_app::TensorSet *sample_app::QnnSampleApp::findTensorSet(int graphIdx,
+                                                               uint32_t setIdx) {
+  if (graphIdx < 0 || static_cast<size_t>(graphIdx) >= m_graphTensors.size() ||
+      setIdx >= m_graphTensors[graphIdx].ring.size()) {
+    QNN_ERROR("Invalid tensor set %u for graphIdx: %d", setIdx, graphIdx);
+    return nullptr;
+  }
+  return &m_graphTensors[graphIdx].ring[setIdx];
+}
+
+// 检查张量组处于期望状态，返回该组；持有 m_ringMutex 时调用
+sample_app::TensorSet *sample_app::QnnSampleApp::checkTensorSet(int graphIdx,
+                                                                uint32_t setIdx,
+                                                                TensorSetState expected) {
+  TensorSet *set = findTensorSet(graphIdx, setIdx);
+  if (set != nullptr && set->state != expected) {
+    QNN_ERROR("Tensor set %u of graphIdx %d is in state %d, expected %d", setIdx,
+              graphIdx, static_cast<int>(set->state), static_cast<int>(expected));
+    return nullptr;
+  }
+  return set;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::loadFloatInputsToSet(
+    int graphIdx, uint32_t setIdx, const float *const *inputs,
+    const size_t *sizes, size_t numInputs) {
+  TensorSet *set = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    set = checkTensorSet(graphIdx, setIdx, TensorSetState::ACQUIRED);
+  }
+  if (set == nullptr) {
+    return StatusCode::FAILURE;
+  }
+  return copyFloatsToTensors(set->inputs,
+                             (*m_graphsInfo)[graphIdx].numInputTensors, inputs,
+                             sizes, numInputs);
+}
+
+sample_app::StatusCode
+sample_app::QnnSampleApp::getTensorSetInputView(int graphIdx, uint32_t setIdx,
+                                                uint32_t inputIdx,
+                                                TensorView &view) {
+  std::lock_guard<std::mutex> lock(m_ringMutex);
+  TensorSet *set = findTensorSet(graphIdx, setIdx);
+  if (set == nullptr) {
+    return StatusCode::FAILURE;
+  }
+  if (inputIdx >= (*m_graphsInfo)[graphIdx].numInputTensors) {
+    QNN_ERROR("Invalid input index %u for graphIdx: %d", inputIdx, graphIdx);
+    return StatusCode::FAILURE;
+  }
+  fillTensorView(set->inputs[inputIdx], view);
+  return StatusCode::SUCCESS;
+}
+
+sample_app::StatusCode
+sample_app::QnnSampleApp::getTensorSetOutputView(int graphIdx, uint32_t setIdx,
+                                                 uint32_t outputIdx,
+                                                 TensorView &view) {
+  std::lock_guard<std::mutex> lock(m_ringMutex);
+  TensorSet *set = findTensorSet(graphIdx, setIdx);
+  if (set == nullptr) {
+    return StatusCode::FAILURE;
+  }
+  if (outputIdx >= (*m_graphsInfo)[graphIdx].numOutputTensors) {
+    QNN_ERROR("Invalid output index %u for graphIdx: %d", outputIdx, graphIdx);
+    return StatusCode::FAILURE;
+  }
+  fillTensorView(set->outputs[outputIdx], view);
+  return StatusCode::SUCCESS;
+}
+
+// 同步执行该组张量，返回时输出已就绪（COMPLETED）；失败时回到 ACQUIRED 以便重试或释放
+sample_app::StatusCode sample_app::QnnSampleApp::submitTensorSet(int graphIdx,
+                                                                 uint32_t setIdx) {
+  TensorSet *set = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    set = checkTensorSet(graphIdx, setIdx, TensorSetState::ACQUIRED);
+    if (set == nullptr) {
+      return StatusCode::FAILURE;
+    }
+    set->state = TensorSetState::SUBMITTED;
+  }
+  StatusCode status =
+      executeWithTensors(graphIdx, execTensors(set->inputs, set->inputBinding),
+                         execTensors(set->outputs, set->outputBinding));
+  {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    set->state = status == StatusCode::SUCCESS ? TensorSetState::COMPLETED
+                                               : TensorSetState::ACQUIRED;
+  }
+  return status;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::getFloatOutputsFromSet(
+    int graphIdx, uint32_t setIdx, float *const *outputs,
+    const size_t *capacities, size_t numBuffers) {
+  TensorSet *set = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    set = checkTensorSet(graphIdx, setIdx, TensorSetState::COMPLETED);
+  }
+  if (set == nullptr) {
+    return StatusCode::FAILURE;
+  }
+  return copyTensorsToFloats(set->outputs,
+                             (*m_graphsInfo)[graphIdx].numOutputTensors,
+                             outputs, capacities, numBuffers);
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::releaseTensorSet(int graphIdx,
+                                                                  uint32_t setIdx) {
+  std::lock_guard<std::mutex> lock(m_ringMutex);
+  TensorSet *set = findTensorSet(graphIdx, setIdx);
+  if (set == nullptr) {
+    return StatusCode::FAILURE;
+  }
+  if (set->state == TensorSetState::SUBMITTED) {
+    QNN_ERROR("Cannot release tensor set %u of graphIdx %d while executing",
+              setIdx, graphIdx);
+    return StatusCode::FAILURE;
+  }
+  set->state = TensorSetState::FREE;
+  return StatusCode::SUCCESS;
+}
+
+sample_app::StatusCode
+sample_app::QnnSampleApp::enableSharedMemory(sharedmem::AllocatorType type) {
+  for (auto &graph : m_graphTensors) {
+    if (graph.primary.inputs != nullptr || !graph.ring.empty()) {
+      QNN_ERROR("Shared memory must be enabled before any tensor is allocated");
+      return StatusCode::FAILURE;
+    }
+  }
+  if (nullptr == m_qnnFunctionPointers.qnnInterface.memRegister ||
+      nullptr == m_qnnFunctionPointers.qnnInterface.memDeRegister) {
+    QNN_WARN("Backend does not provide memRegister, keeping raw buffers");
+    return StatusCode::QNN_FEATURE_UNSUPPORTED;
+  }
+  auto allocator = sharedmem::createAllocator(type);
+  if (!allocator) {
+    return StatusCode::FAILURE;
+  }
+  QNN_INFO("Tensor memory will be allocated with %s", allocator->name());
+  m_sharedAllocator = std::move(allocator);
+  return StatusCode::SUCCESS;
+}
+
+// 把一组新分配的张量搬到共享内存上；任一侧失败时整组保留 RAW 缓冲区，不影响正确性
+void sample_app::QnnSampleApp::bindSharedMemory(int graphIdx, TensorSet &set) {
+  if (!m_sharedAllocator) {
+    return;
+  }
+  const auto &graphInfo = (*m_graphsInfo)[graphIdx];
+  set.inputBinding = sharedmem::TensorBinding::bind(
+      *m_sharedAllocator, m_qnnFunctionPointers.qnnInterface, m_context, set.inputs,
+      graphInfo.numInputTensors);
+  set.outputBinding = sharedmem::TensorBinding::bind(
+      *m_sharedAllocator, m_qnnFunctionPointers.qnnInterface, m_context, set.outputs,
+      graphInfo.numOutputTensors);
+  if (!set.inputBinding || !set.outputBinding) {
+    // 整组回退：不留下一半在共享内存、一半在 RAW 缓冲区的组。这里至多一侧绑定成功，
+    // 搬不回堆上时保留该侧绑定，execTensors 对每一侧分别处理，执行仍然正确
+    if ((set.inputBinding && !set.inputBinding->unbindToHeap()) ||
+        (set.outputBinding && !set.outputBinding->unbindToHeap())) {
+      QNN_WARN("Could not move tensors of graph %s back to raw buffers", graphInfo.graphName);
+      return;
+    }
+    set.inputBinding.reset();
+    set.outputBinding.reset();
+    QNN_WARN("Falling back to raw buffers for graph %s", graphInfo.graphName);
+  }
+}
+
+// 异步执行的上下文，由 graphExecuteAsync 的通知回调负责释放
+struct sample_app::QnnSampleApp::AsyncExecution {
+  QnnSampleApp *app;
+  TensorSet *set;
+  AsyncDoneCallback callback;
+  int graphIdx;
+  std::chrono::steady_clock::time_point submitTime;
+};
+
+bool sample_app::QnnSampleApp::supportsAsyncExecution() {
+  std::lock_guard<std::mutex> lock(m_ringMutex);
+  if (m_asyncSupported < 0) {
+    bool supported = nullptr != m_qnnFunctionPointers.qnnInterface.graphExecuteAsync;
+    if (supported && nullptr != m_qnnFunctionPointers.qnnInterface.propertyHasCapability) {
+      supported = QNN_PROPERTY_SUPPORTED ==
+                  m_qnnFunctionPointers.qnnInterface.propertyHasCapability(
+                      QNN_PROPERTY_GRAPH_SUPPORT_ASYNC_EXECUTION);
+    }
+    m_asyncSupported = supported ? 1 : 0;
+    QNN_INFO("Async graph execution %s", supported ? "supported" : "not supported");
+  }
+  return m_asyncSupported == 1;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::setMaxInFlight(uint32_t maxInFlight) {
+  if (maxInFlight == 0) {
+    QNN_ERROR("Max in-flight executions must be at least 1");
+    return StatusCode::FAILURE;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    m_maxInFlight = maxInFlight;
+  }
+  m_inFlightCv.notify_all();
+  return StatusCode::SUCCESS;
+}
+
+sample_app::StatusCode sample_app::QnnSampleApp::submitTensorSetAsync(
+    int graphIdx, uint32_t setIdx, AsyncDoneCallback callback) {
+  if (!supportsAsyncExecution()) {
+    return StatusCode::QNN_FEATURE_UNSUPPORTED;
+  }
+  TensorSet *set = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    set = checkTensorSet(graphIdx, setIdx, TensorSetState::ACQUIRED);
+    if (set == nullptr) {
+      return StatusCode::FAILURE;
+    }
+    // 不阻塞调用线程，由调用者决定稍后重试还是改走同步路径
+    if (m_inFlight >= m_maxInFlight) {
+      return StatusCode::BUSY;
+    }
+    set->state = TensorSetState::SUBMITTED;
+    m_inFlight++;
+  }
+
+  auto execution = new AsyncExecution{this, set, std::move(callback), graphIdx,
+                                      std::chrono::steady_clock::now()};
+  const auto &graphInfo = (*m_graphsInfo)[graphIdx];
+  Qnn_ErrorHandle_t executeStatus;
+  PowerManager *powerManager = getPowerManager();
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_executeMutex);
+    if (powerManager) {
+      powerManager->beginExecute();
+    }
+    executeStatus = m_qnnFunctionPointers.qnnInterface.graphExecuteAsync(
+        graphInfo.graph, execTensors(set->inputs, set->inputBinding),
+        graphInfo.numInputTensors, execTensors(set->outputs, set->outputBinding),
+        graphInfo.numOutputTensors, m_profileBackendHandle, nullptr,
+        onAsyncExecutionDone, execution);
+  }
+  if (QNN_GRAPH_NO_ERROR == executeStatus) {
+    return StatusCode::SUCCESS;
+  }
+
+  // 入队失败时通知回调不会被调用，在这里回滚
+  delete execution;
+  if (powerManager) {
+    powerManager->endExecute();
+  }
+  StatusCode status = StatusCode::FAILURE;
+  {
+    std::lock_guard<std::mutex> lock(m_ringMutex);
+    set->state = TensorSetState::ACQUIRED;
+    m_inFlight--;
+    if (QNN_GRAPH_ERROR_UNSUPPORTED_FEATURE == executeStatus ||
+        QNN_COMMON_ERROR_NOT_SUPPORTED == executeStatus) {
+      // 例如上下文未配置异步队列，之后都走同步路径
+      QNN_WARN("graphExecuteAsync not supported by this context, disabling async path");
+      m_asyncSupported = 0;
+      status = StatusCode::QNN_FEATURE_UNSUPPORTED;
+    } else {
+      QNN_ERROR("graphExecuteAsync of graph %s failed: %lu", graphInfo.graphName,
+                static_cast<unsigned long>(executeStatus));
+    }
+  }
+  m_inFlightCv.notify_all();
+  return status;
+}
+
+void sample_app::QnnSampleApp::onAsyncExecutionDone(void *notifyParam,
+                                                    Qnn_NotifyStatus_t notifyStatus) {
+  std::unique_ptr<AsyncExecution> execution(static_cast<AsyncExecution *>(notifyParam));
+  QnnSampleApp *app = execution->app;
+  StatusCode status = QNN_GRAPH_NO_ERROR == notifyStatus.error ? StatusCode::SUCCESS
+                                                                : StatusCode::FAILURE;
+  if (status != StatusCode::SUCCESS) {
+    QNN_ERROR("Async graph execution failed: %lu",
+              static_cast<unsigned long>(notifyStatus.error));
+  }
+  // 在途期间 app 持有 shared backend，PowerManager 此时必然存活
+  if (PowerManager *powerManager = app->getPowerManager()) {
+    powerManager->endExecute();
+  }
+  auto completeTime = std::chrono::steady_clock::now();
+  app->m_executions.fetch_add(1, std::memory_order_relaxed);
+  if (status == StatusCode::SUCCESS) {
+    app->m_executeHistogram.record(completeTime - execution->submitTime);
+  } else {
+    app->m_executionFailures.fetch_add(1, std::memory_order_relaxed);
+  }
+  // profile 句柄在多个在途执行间共享，同时在途多个时事件可能归到先完成的那一次
+  if (nullptr != app->m_profileBackendHandle && status == StatusCode::SUCCESS) {
+    app->recordExecutionProfile(execution->graphIdx, true, execution->submitTime, completeTime);
+  }
+  {
+    std::lock_guard<std::mutex> lock(app->m_ringMutex);
+    execution->set->state = status == StatusCode::SUCCESS ? TensorSetState::COMPLETED
+                                                          : TensorSetState::ACQUIRED;
+  }
+  if (execution->callback) {
+    try {
+      execution->callback(status);
+    } catch (...) {
+      QNN_ERROR("Unhandled exception in async execution callback");
+    }
+  }
+  // 回调结束后才减少在途计数，保证析构等待时回调已经返回；
+  // 持锁通知，解锁后不再访问 app（析构可能随即发生）
+  std::lock_guard<std::mutex> lock(app->m_ringMutex);
+  app->m_inFlight--;
+  app->m_inFlightCv.notify_all();
+}
+
+void sample_app::QnnSampleApp::waitForAsyncExecutions() {
+  std::unique_lock<std::mutex> lock(m_ringMutex);
+  m_inFlightCv.wait(lock, [this] { return m_inFlight == 0; });
+}
+
+// 释放指定图的张量组环；持有 m_ringMutex 或单线程清理时调用
+void sample_app::QnnSampleApp::tearDownRing(int graphIdx) {
+  auto &graph = m_graphTensors[graphIdx];
+  for (auto &set : graph.ring) {
+    set.inputBinding.reset();
+    set.outputBinding.reset();
+    if ((set.inputs != nullptr || set.outputs != nullptr) &&
+        m_graphsInfo != nullptr && static_cast<size_t>(graphIdx) < m_graphsCount) {
+      m_ioTensor.tearDownInputAndOutputTensors(
+          set.inputs, set.outputs, (*m_graphsInfo)[graphIdx].numInputTensors,
+          (*m_graphsInfo)[graphIdx].numOutputTensors);
+    }
+  }
+  graph.ring.clear();
+  graph.ringNext = 0;
+}
+
+// 添加缺失的initialize()方法实现
+sample_app::StatusCode sample_app::QnnSampleApp::initialize() {
+  throw std::runtime_error("initialize is deprecated!!!");
+  // initialize是一个顶层接口，它组合了整个初始化流程
   auto returnStatus = StatusCode::SUCCESS;
 
   // 首先初始化后端
@@ -1180,16 +2584,96 @@ sample_app::StatusCode sample_app::QnnSampleApp::initialize() {
 sample_app::StatusCode sample_app::QnnSampleApp::freeGraphs() {
   auto returnStatus = StatusCode::SUCCESS;
 
+  // 张量数量来自图信息，先释放张量再释放图信息
+  tearDownAllTensors();
+
   // 释放图信息
-  if (m_graphsInfo != nullptr) {
-    qnn_wrapper_api::freeGraphsInfo(&m_graphsInfo, m_graphsCount);
-    m_graphsInfo = nullptr;
-    m_graphsCount = 0;
+  releaseGraphsInfo();
+
+  return returnStatus;
+}
+
+// 图信息可能来自 copyMetadataToGraphsInfo / composeGraphs 的堆分配，
+// 也可能指向 sidecar 索引的数据块，两者释放方式不同
+void sample_app::QnnSampleApp::releaseGraphsInfo() {
+  freeGraphsInfo(m_graphInfoIndex, m_graphsInfo, m_graphsCount);
+}
+
+void sample_app::QnnSampleApp::freeGraphsInfo(
+    std::unique_ptr<graphindex::GraphInfoIndex> &graphInfoIndex,
+    qnn_wrapper_api::GraphInfo_t **&graphsInfo, uint32_t &graphsCount) {
+  if (graphInfoIndex) {
+    graphInfoIndex.reset();
+  } else if (graphsInfo != nullptr) {
+    qnn_wrapper_api::freeGraphsInfo(&graphsInfo, graphsCount);
   }
+  graphsInfo  = nullptr;
+  graphsCount = 0;
+}
 
-  m_currentGraphIndex = -1;
+std::shared_ptr<sample_app::SharedBackend>
+sample_app::QnnSampleApp::acquireSharedBackend(const std::string &backendPath,
+                                               bool *created) {
+  return BackendRegistry::instance().acquire(backendPath, USE_CUSTOM_PARAMS,
+                                             created);
+}
 
-  return returnStatus;
+std::string sample_app::StartupStats::toJson() const {
+  std::ostringstream json;
+  json << std::fixed << std::setprecision(3) << "{"
+       << "\"backendShared\":" << (backendShared ? "true" : "false")
+       << ",\"backendAcquireMs\":" << backendAcquireMs
+       << ",\"backendLoadMs\":" << backend.loadMs
+       << ",\"backendCreateMs\":" << backend.createMs
+       << ",\"deviceCreateMs\":" << backend.deviceCreateMs
+       << ",\"powerConfigMs\":" << backend.powerConfigMs
+       << ",\"modelLoadMs\":" << modelLoadMs
+       << ",\"opPackagesMs\":" << opPackagesMs
+       << ",\"cacheLookupMs\":" << cacheLookupMs
+       << ",\"contextCreateMs\":" << contextCreateMs
+       << ",\"composeGraphsMs\":" << composeGraphsMs
+       << ",\"graphConfigMs\":" << graphConfigMs
+       << ",\"finalizeGraphsMs\":" << finalizeGraphsMs
+       << ",\"cacheStoreMs\":" << cacheStoreMs
+       << ",\"warmupMs\":" << warmupMs
+       << ",\"binaryMapped\":" << (binary.mapped ? "true" : "false")
+       << ",\"binarySize\":" << binary.fileSize
+       << ",\"binaryReadMs\":" << binary.readMs
+       << ",\"binaryInfoMs\":" << binary.binaryInfoMs
+       << ",\"copyMetadataMs\":" << binary.copyMetadataMs
+       << ",\"metadataFromSidecar\":" << (binary.metadataFromSidecar ? "true" : "false")
+       << ",\"graphRetrieveMs\":" << binary.graphRetrieveMs
+       << ",\"heapBytesAllocated\":" << heapBytesAllocated
+       << ",\"peakRssBeforeKb\":" << peakRssBeforeKb
+       << ",\"peakRssAfterKb\":" << peakRssAfterKb
+       << ",\"totalMs\":" << totalMs << "}";
+  return json.str();
+}
+
+std::string sample_app::ExecutionProfile::toJson() const {
+  std::ostringstream json;
+  json << std::fixed << std::setprecision(3) << "{"
+       << "\"sequence\":" << sequence
+       << ",\"graphIdx\":" << graphIdx
+       << ",\"async\":" << (async ? "true" : "false")
+       << ",\"startUs\":" << startUs
+       << ",\"wallMs\":" << wallMs
+       << ",\"events\":[";
+  for (size_t i = 0; i < events.size(); i++) {
+    const ProfileEvent &event = events[i];
+    // 节点名来自模型，可能包含需要转义的字符
+    std::string identifier;
+    tracing::appendJsonString(identifier, event.identifier);
+    json << (i > 0 ? "," : "") << "{\"eventId\":" << event.eventId
+         << ",\"identifier\":" << identifier
+         << ",\"type\":" << event.type
+         << ",\"unit\":" << event.unit
+         << ",\"value\":" << event.value
+         << ",\"parent\":" << event.parent
+         << ",\"depth\":" << event.depth << "}";
+  }
+  json << "]}";
+  return json.str();
 }
 
 QnnDevice_PlatformInfo_t
@@ -7,12 +7,22 @@
 //==============================================================================
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <queue>
 
+#include "BackendRegistry.hpp"
+#include "ContextCache.hpp"
+#include "GraphInfoIndex.hpp"
 #include "IOTensor.hpp"
+#include "LatencyHistogram.hpp"
 #include "QnnDevice.h"
 #include "SampleApp.hpp"
+#include "SharedMemAllocator.hpp"
 
 namespace qnn {
 namespace tools {
@@ -24,26 +34,165 @@ enum class StatusCode {
   FAILURE_INPUT_LIST_EXHAUSTED,
   FAILURE_SYSTEM_ERROR,
   FAILURE_SYSTEM_COMMUNICATION_ERROR,
-  QNN_FEATURE_UNSUPPORTED
+  QNN_FEATURE_UNSUPPORTED,
+  BUSY  // 资源暂时用尽（如在途异步执行已达上限），状态未改变，可稍后重试
 };
 
 // 图优化配置结构体
 union BackendConfig {
+  // HTP 图配置，在 finalize 之前校验并通过 graphSetConfig 应用到每张图；
+  // .bin 模型和编译缓存命中时图已编译完成，不再生效
   struct HtpConfig {
-    // 优化级别 (0-3)，3为最佳性能但可能增加编译时间
+    // 优化级别 (1-3)，3为最佳性能但可能增加编译时间
     int optimizationLevel = 2;
-    // 优先使用的精度模式
+    // 优先使用的精度模式，DEFAULT 表示不设置，由 backend 决定
     enum class PrecisionMode {
       FLOAT32 = 0,
       FLOAT16 = 1,
       DEFAULT = 0x7FFFFFFF
     } precisionMode = PrecisionMode::FLOAT16;
+    // VTCM 大小（MB），0 表示使用设备支持的最大值
+    uint32_t vtcmSizeMb = 0;
+    // HVX 线程数，0 表示不限制
+    uint64_t numHvxThreads = 0;
+    // 深度学习带宽压缩（DLBC）：-1 自动，仅在设备报告支持时启用；0 关闭；1 启用，需要设备支持
+    int enableDlbc = -1;
+    bool enableDlbcWeights = false;
+    // 配置由调用者显式给出时，取值无效、设备不支持或 graphSetConfig 失败都会使创建失败；
+    // 使用默认配置时只给出警告，图按 backend 默认配置编译
+    bool explicitConfig = false;
   } htpConfig;
   
   // 显式默认构造函数
   BackendConfig() : htpConfig() {}
 };
 
+// 张量视图：借用持久化张量的客户端缓冲区，不拥有内存
+// data 在下一次重新初始化张量（切换图或销毁实例）之前一直有效
+struct TensorView {
+  const char *name = nullptr;
+  void *data = nullptr;
+  size_t dataSize = 0; // 字节数
+  Qnn_DataType_t dataType = QNN_DATATYPE_UNDEFINED;
+  uint32_t rank = 0;
+  const uint32_t *dims = nullptr;
+  // 量化参数，仅对 (U)FIXED_POINT 类型有意义
+  float scale = 0.0f;
+  int32_t offset = 0;
+};
+
+// 张量组环中单组张量的状态
+enum class TensorSetState { FREE, ACQUIRED, SUBMITTED, COMPLETED };
+
+struct TensorSet {
+  Qnn_Tensor_t *inputs  = nullptr;
+  Qnn_Tensor_t *outputs = nullptr;
+  TensorSetState state  = TensorSetState::FREE;
+  // 启用共享内存时的注册信息，为空表示使用 RAW 缓冲区
+  std::unique_ptr<sharedmem::TensorBinding> inputBinding;
+  std::unique_ptr<sharedmem::TensorBinding> outputBinding;
+};
+
+// 每张图的张量组环大小范围
+constexpr uint32_t MIN_TENSOR_RING_SIZE     = 2;
+constexpr uint32_t MAX_TENSOR_RING_SIZE     = 4;
+constexpr uint32_t DEFAULT_TENSOR_RING_SIZE = 2;
+
+// graphExecuteAsync 同时在途的执行数默认上限
+constexpr uint32_t DEFAULT_MAX_IN_FLIGHT = 2;
+
+// context binary 加载过程的耗时与内存统计
+struct BinaryLoadStats {
+  bool mapped               = false;  // 是否走了 mmap 路径
+  uint64_t fileSize         = 0;
+  double readMs             = 0.0;    // 映射或读取文件
+  double binaryInfoMs       = 0.0;    // systemContextGetBinaryInfo 及元数据拷贝
+  double copyMetadataMs     = 0.0;    // 其中 copyMetadataToGraphsInfo 的部分
+  bool metadataFromSidecar  = false;  // 图信息来自 sidecar 索引，跳过了 binary info 解析
+  double contextCreateMs    = 0.0;    // contextCreateFromBinary
+  double totalMs            = 0.0;
+  double graphRetrieveMs    = 0.0;    // graphRetrieve，不计入 totalMs
+  uint64_t peakRssBeforeKb  = 0;      // 加载前后的进程峰值 RSS (VmHWM)
+  uint64_t peakRssAfterKb   = 0;
+  uint64_t heapBytesAvoided = 0;      // 映射路径下省去的堆上整文件拷贝
+};
+
+// 预热得到的单次执行耗时（毫秒）
+struct WarmupStats {
+  uint32_t runs        = 0;
+  double firstRunMs    = 0.0;  // 第一次执行，包含 backend 懒分配、缓存未命中和升频
+  double steadyStateMs = 0.0;  // 其余各次的中位数，只执行一次时等于 firstRunMs
+  double minMs         = 0.0;
+  double maxMs         = 0.0;
+  double totalMs       = 0.0;
+};
+
+// 预热时输入的填充方式
+enum class WarmupInput {
+  ZEROS,  // IOTensor::populateInputTensorsWithZeros
+  RANDOM  // 固定种子的伪随机数据，浮点输入取 [-1, 1)，避免全零输入走到特殊的快路径
+};
+
+// backend 性能分析事件，ExecutionProfile::events 中按先序遍历展开的事件树
+struct ProfileEvent {
+  uint64_t eventId = 0;  // QnnProfile_EventId_t，只在该次执行内有意义
+  std::string identifier;
+  uint32_t type  = 0;  // QnnProfile_EventType_t
+  uint32_t unit  = 0;  // QnnProfile_EventUnit_t
+  uint64_t value = 0;
+  int32_t parent = -1;  // 父事件在 events 中的下标，顶层事件为 -1
+  uint32_t depth = 0;   // 顶层为 0，DETAILED 级别下逐节点事件通常为 1
+};
+
+// 一次执行的性能分析结果
+struct ExecutionProfile {
+  uint64_t sequence = 0;  // 实例内递增的执行序号
+  int graphIdx      = -1;
+  bool async        = false;  // graphExecuteAsync 执行
+  uint64_t startUs  = 0;      // steady_clock 时间戳（微秒），同步执行为调用 graphExecute 时刻
+  double wallMs     = 0.0;    // 同步执行为 graphExecute 耗时，异步执行为提交到完成通知
+  std::vector<ProfileEvent> events;
+
+  std::string toJson() const;
+};
+
+// 常开的运行时指标，耗时单位微秒
+struct Metrics {
+  metrics::LatencySummary inputStaging;      // float 输入量化写入张量
+  metrics::LatencySummary execute;           // graphExecute，异步执行为提交到完成
+  metrics::LatencySummary outputConversion;  // 输出张量反量化为 float
+  metrics::LatencySummary infer;             // infer() 端到端
+  uint64_t executions     = 0;               // 同步与异步执行次数，含失败
+  uint64_t failures       = 0;
+  uint64_t bytesConverted = 0;  // 输入/输出 float 数据的字节数
+};
+
+// 默认保留最近多少次执行的性能分析结果
+constexpr uint32_t DEFAULT_PROFILE_HISTORY = 16;
+
+// path 构造函数各阶段的单调时钟耗时（毫秒）与内存统计，用于跟踪冷启动回归
+struct StartupStats {
+  bool backendShared        = false;  // 复用了已有的共享 backend，backend 各项为 0
+  double backendAcquireMs   = 0.0;    // 获取共享 backend 的总耗时（含等待其它实例）
+  BackendTimings backend;
+  double modelLoadMs        = 0.0;    // model.so 或 System 库加载
+  double opPackagesMs       = 0.0;
+  double cacheLookupMs      = 0.0;    // 编译缓存 key 计算与查找
+  double contextCreateMs    = 0.0;    // contextCreate 或 contextCreateFromBinary
+  double composeGraphsMs    = 0.0;
+  double graphConfigMs      = 0.0;    // HTP graphSetConfig
+  double finalizeGraphsMs   = 0.0;
+  double cacheStoreMs       = 0.0;    // 序列化 context 写入编译缓存
+  double warmupMs           = 0.0;    // 构造时自动预热（所有图）
+  BinaryLoadStats binary;             // 走二进制路径（.bin 或缓存命中）时有效
+  uint64_t heapBytesAllocated = 0;    // 构造期间成功使用的堆缓冲区（binary 读取、写编译缓存）
+  uint64_t peakRssBeforeKb  = 0;
+  uint64_t peakRssAfterKb   = 0;
+  double totalMs            = 0.0;
+
+  std::string toJson() const;
+};
+
 class QnnSampleApp {
  public:
   QnnSampleApp(QnnFunctionPointers qnnFunctionPointers,
@@ -59,7 +208,9 @@ class QnnSampleApp {
                const std::string& modelPath,
                iotensor::OutputDataType outputDataType = iotensor::OutputDataType::FLOAT_ONLY,
                iotensor::InputDataType inputDataType = iotensor::InputDataType::FLOAT,
-               const BackendConfig& backendCfg = BackendConfig());
+               const BackendConfig& backendCfg = BackendConfig(),
+               const contextcache::Config& cacheConfig = contextcache::Config(),
+               uint32_t warmupRuns = 0);
 
   // @brief Print a message to STDERR then return a nonzero
   //  exit status.
@@ -75,12 +226,33 @@ class QnnSampleApp {
 
   StatusCode finalizeGraphs();
 
+  // 执行当前图（最近一次准备张量的图，默认 0）
   StatusCode executeGraphs();
 
+  // 按索引或名称执行指定的图，各图的持久化张量互相独立
+  StatusCode executeGraph(int graphIdx);
+
+  StatusCode executeGraph(const std::string &graphName);
+
+  uint32_t getGraphCount() const { return m_graphsCount; }
+
+  // 找不到时返回 -1
+  int getGraphIndex(const std::string &graphName) const;
+
+  // 指向图信息内部，下一次 swapModel 或实例析构后失效
+  const char *getGraphName(int graphIdx) const;
+
   StatusCode registerOpPackages();
 
   StatusCode createFromBinary();
 
+  // 热切换模型：保留 backend、device 和 HTP 性能投票，只释放旧 context 并从新的 context binary 创建。
+  // 先等待在途的异步执行完成，切换期间持有执行锁，同步执行会阻塞到切换结束后在新图上运行；
+  // 执行路径在执行锁下检查图索引，索引在新模型中无效时返回 FAILURE。
+  // 流水线张量组必须全部释放，否则返回 FAILURE 且不做任何改动；调用前应销毁该实例上的 BatchScheduler。
+  // 新模型先完整加载再替换旧模型，加载失败时返回 FAILURE，旧模型和张量保持不变
+  StatusCode swapModel(const std::string &binaryPath);
+
   StatusCode saveBinary(std::string outputPath, std::string saveBinaryName);
 
   StatusCode freeContext();
@@ -105,23 +277,233 @@ class QnnSampleApp {
 
   bool isBinaryModel() const { return m_isBinaryModel; }
 
+  const BinaryLoadStats &getBinaryLoadStats() const { return m_binaryLoadStats; }
+
+  const StartupStats &getStartupStats() const { return m_startupStats; }
+
+  // .so 模型是否命中了编译缓存，直接从缓存的 context binary 加载
+  bool isLoadedFromCache() const { return m_loadedFromCache; }
+
   // 新增接口：加载 float 输入数据
   StatusCode loadFloatInputs(const std::vector<std::vector<float>>& inputData, int graphIdx = 0);
 
+  // sizes 为各输入的 float 元素个数
+  StatusCode loadFloatInputs(const float *const *inputs, const size_t *sizes,
+                             size_t numInputs, int graphIdx = 0);
+
   // 新增接口：获取 float 输出数据
   StatusCode getFloatOutputs(std::vector<std::vector<float>>& outputData, int graphIdx = 0);
 
+  // 预热：按 input 填充指定图默认张量组的输入并执行 runs 次，统计首次与稳态耗时。
+  // 会覆盖该图默认张量组中已有的输入/输出数据
+  StatusCode warmup(uint32_t runs, WarmupStats &stats, int graphIdx = 0,
+                    WarmupInput input = WarmupInput::ZEROS);
+
+  // 构造时自动预热的结果，该图没有预热过时返回 false
+  bool getWarmupStats(int graphIdx, WarmupStats &stats) const;
+
+  // 运行时开启/关闭 backend 性能分析。开启后每次执行结束收集一次事件树，
+  // 只保留最近 historySize 次；切换级别会重建 profile 句柄并清空已有结果
+  StatusCode setProfiling(ProfilingLevel level, uint32_t historySize = DEFAULT_PROFILE_HISTORY);
+
+  size_t getProfileCount();
+
+  // back 为 0 表示最近一次执行，越界时返回 false
+  bool getProfile(size_t back, ExecutionProfile &profile);
+
+  // 最近 maxCount 次（0 为全部）执行的 JSON 数组，从旧到新
+  std::string getProfilesJson(size_t maxCount = 0);
+
+  void clearProfiles();
+
+  // HTP 性能档位，作用于共享同一 backend 的所有实例。
+  // 没有 PowerManager（非 HTP 或未启用 customDeviceConfig）时返回 QNN_FEATURE_UNSUPPORTED
+  StatusCode setPowerPolicy(PowerProfile active,
+                            PowerProfile idle,
+                            std::chrono::milliseconds idleTimeout = DEFAULT_POWER_IDLE_TIMEOUT);
+
+  // 批量任务期间固定档位，结束后 unpin 恢复自动切换
+  StatusCode pinPowerProfile(PowerProfile profile);
+
+  StatusCode unpinPowerProfile();
+
+  bool getPowerProfile(PowerProfile &profile) const;
+
+  // 读取运行时指标，reset 为 true 时同时清零。热路径只做 relaxed 原子操作，
+  // 与并发执行同时读取时各项之间不保证一致
+  void getMetrics(Metrics &metrics, bool reset = false);
+
+  // 确保指定图的持久化输入/输出张量已经分配，并将其设为当前图
+  StatusCode prepareTensors(int graphIdx = 0);
+
+  // 零拷贝输入：返回持久化输入张量缓冲区的视图，调用者直接写入后执行即可
+  StatusCode getInputTensorView(uint32_t inputIdx, TensorView &view, int graphIdx = 0);
+
+  uint32_t getNumInputTensors(int graphIdx = 0) const;
+
+  // 反量化输出到调用者预先分配的缓冲区，capacities 为各缓冲区的 float 个数
+  StatusCode getFloatOutputsInto(float *const *outputs, const size_t *capacities,
+                                 size_t numBuffers, int graphIdx = 0);
+
+  // 只读输出视图：直接暴露原生输出缓冲区及其量化参数
+  StatusCode getOutputTensorView(uint32_t outputIdx, TensorView &view, int graphIdx = 0);
+
+  uint32_t getNumOutputTensors(int graphIdx = 0) const;
+
+  // 原生数据类型直通：按张量自身的 dtype 拷贝原始字节，不做量化/反量化
+  // sizes/capacities 均以字节计，必须与 datautil::calculateLength 一致
+  StatusCode loadNativeInputs(const void *const *inputs, const size_t *sizes,
+                              size_t numInputs, int graphIdx = 0);
+
+  StatusCode getNativeOutputs(void *const *outputs, const size_t *capacities,
+                              size_t numBuffers, size_t *writtenSizes,
+                              int graphIdx = 0);
+
+  // 单次调用完成加载、执行和输出获取，缓冲区约定与上面的接口一致
+  StatusCode infer(const float *const *inputs, const size_t *sizes, size_t numInputs,
+                   float *const *outputs, const size_t *capacities, size_t numOutputs,
+                   int graphIdx = 0);
+
+  // 流水线接口：每张图持有一个张量组环，与上面接口使用的默认张量组相互独立。
+  // 生产者 acquire 一组并写入输入，submit 执行，消费者读取输出后 release；
+  // 不同的组可以在不同线程上同时处于不同阶段，图执行本身在实例内串行。
+  // 环大小只能在没有组被占用时修改，默认 DEFAULT_TENSOR_RING_SIZE
+  StatusCode setTensorRingSize(uint32_t size);
+
+  uint32_t getTensorRingSize() const { return m_tensorRingSize; }
+
+  // 没有空闲组时返回 FAILURE，调用者应先 release 已完成的组
+  StatusCode acquireTensorSet(int graphIdx, uint32_t &setIdx);
+
+  StatusCode loadFloatInputsToSet(int graphIdx, uint32_t setIdx, const float *const *inputs,
+                                  const size_t *sizes, size_t numInputs);
+
+  StatusCode getTensorSetInputView(int graphIdx, uint32_t setIdx, uint32_t inputIdx,
+                                   TensorView &view);
+
+  StatusCode getTensorSetOutputView(int graphIdx, uint32_t setIdx, uint32_t outputIdx,
+                                    TensorView &view);
+
+  StatusCode submitTensorSet(int graphIdx, uint32_t setIdx);
+
+  StatusCode getFloatOutputsFromSet(int graphIdx, uint32_t setIdx, float *const *outputs,
+                                    const size_t *capacities, size_t numBuffers);
+
+  StatusCode releaseTensorSet(int graphIdx, uint32_t setIdx);
+
+  // 张量内存改为从可共享的 fd 内存分配并通过 memRegister 注册，执行时按 memHandle 绑定，
+  // 省去每次执行时 backend 的输入/输出拷贝。必须在任何张量分配之前（首次加载输入前）调用；
+  // 某组张量注册失败时该组自动退回 RAW 缓冲区
+  StatusCode enableSharedMemory(sharedmem::AllocatorType type = sharedmem::AllocatorType::AUTO);
+
+  bool isSharedMemoryEnabled() const { return m_sharedAllocator != nullptr; }
+
+  using AsyncDoneCallback = std::function<void(StatusCode status)>;
+
+  // backend 是否提供 graphExecuteAsync 并声明支持异步执行，结果会被缓存
+  bool supportsAsyncExecution();
+
+  // 在途异步执行数上限，达到上限时 submitTensorSetAsync 返回 BUSY
+  StatusCode setMaxInFlight(uint32_t maxInFlight);
+
+  // 通过 graphExecuteAsync 执行一个已 acquire 的组，不占用调用线程。
+  // 完成后组进入 COMPLETED（失败回到 ACQUIRED），并在 backend 的通知线程上调用 callback。
+  // backend 不支持时返回 QNN_FEATURE_UNSUPPORTED 且组状态不变，调用者应改走同步 submit。
+  // 在途数已达上限时不等待，直接返回 BUSY 且组保持 ACQUIRED，callback 不会被调用。
+  StatusCode submitTensorSetAsync(int graphIdx, uint32_t setIdx, AsyncDoneCallback callback);
+
+  // 阻塞直到所有在途的异步执行完成
+  void waitForAsyncExecutions();
+
   static QnnDevice_PlatformInfo_t getPlatformInfo(const std::string& backendPath);
 
+  // 获取（必要时创建）该 backend 的进程内共享资源，配置与 path 构造函数一致
+  static std::shared_ptr<SharedBackend> acquireSharedBackend(const std::string& backendPath,
+                                                             bool* created = nullptr);
+
 
   virtual ~QnnSampleApp();
 
  private:
-  StatusCode extractBackendProfilingInfo(Qnn_ProfileHandle_t profileHandle);
+  // events 非空时除了打印日志，还把事件树按先序追加到 events
+  StatusCode extractBackendProfilingInfo(Qnn_ProfileHandle_t profileHandle,
+                                         std::vector<ProfileEvent> *events = nullptr);
+
+  StatusCode extractProfilingSubEvents(QnnProfile_EventId_t profileEventId,
+                                       std::vector<ProfileEvent> *events = nullptr,
+                                       int32_t parent                    = -1);
+
+  StatusCode extractProfilingEvent(QnnProfile_EventId_t profileEventId,
+                                   std::vector<ProfileEvent> *events = nullptr,
+                                   int32_t parent                    = -1);
+
+  // 执行结束后收集本次的事件树并放入环形缓冲；调用者保证 profile 句柄不被并发使用
+  void recordExecutionProfile(int graphIdx,
+                              bool async,
+                              std::chrono::steady_clock::time_point start,
+                              std::chrono::steady_clock::time_point end);
+
+  bool tensorsReady(int graphIdx) const;
+
+  void tearDownAllTensors();
+
+  void tearDownRing(int graphIdx);
+
+  TensorSet *findTensorSet(int graphIdx, uint32_t setIdx);
+
+  TensorSet *checkTensorSet(int graphIdx, uint32_t setIdx, TensorSetState expected);
+
+  StatusCode executeWithTensors(int graphIdx, Qnn_Tensor_t *inputs, Qnn_Tensor_t *outputs);
+
+  void bindSharedMemory(int graphIdx, TensorSet &set);
+
+  struct AsyncExecution;
+
+  static void onAsyncExecutionDone(void *notifyParam, Qnn_NotifyStatus_t notifyStatus);
+
+  // 校验 m_backendCfg.htpConfig 并应用到所有图，必须在 finalizeGraphs 之前调用
+  StatusCode applyHtpGraphConfig();
+
+  // 共享 backend 的 PowerManager，不存在时为 nullptr
+  PowerManager *getPowerManager() const;
+
+  // 编译缓存 key 中除模型文件外的部分：backend、build id、SoC/arch 以及 BackendConfig
+  std::string contextCacheFingerprint(const std::string &backendPath);
+
+  // 从缓存的 context binary 加载，失败时清理掉已创建的上下文/图信息
+  bool loadFromContextCache(const std::string &backendPath, const std::string &cachedPath);
+
+  // 一次 context binary 加载的结果，swapModel 在加载成功后才替换成员
+  struct LoadedContext {
+    Qnn_ContextHandle_t context               = nullptr;
+    qnn_wrapper_api::GraphInfo_t **graphsInfo = nullptr;
+    uint32_t graphsCount                      = 0;
+    std::unique_ptr<graphindex::GraphInfoIndex> graphInfoIndex;
+    BinaryLoadStats stats;
+  };
+
+  // 从 binaryPath 创建 context 并取回其中的图，结果只写入 loaded；
+  // 失败时图信息已释放，已创建的 context 由调用方释放
+  StatusCode loadContextBinary(const std::string &binaryPath, LoadedContext &loaded);
+
+  // 释放图信息，区分 sidecar 索引与堆分配两种来源
+  void releaseGraphsInfo();
+
+  static void freeGraphsInfo(std::unique_ptr<graphindex::GraphInfoIndex> &graphInfoIndex,
+                             qnn_wrapper_api::GraphInfo_t **&graphsInfo,
+                             uint32_t &graphsCount);
+
+  void storeToContextCache(const contextcache::ContextCache &cache, const std::string &key);
+
+  StatusCode writeContextBinary(const std::string &filePath);
 
-  StatusCode extractProfilingSubEvents(QnnProfile_EventId_t profileEventId);
+  StatusCode copyFloatsToTensors(Qnn_Tensor_t *tensors, uint32_t numTensors,
+                                 const float *const *inputs, const size_t *sizes,
+                                 size_t numInputs);
 
-  StatusCode extractProfilingEvent(QnnProfile_EventId_t profileEventId);
+  StatusCode copyTensorsToFloats(Qnn_Tensor_t *tensors, uint32_t numTensors,
+                                 float *const *outputs, const size_t *capacities,
+                                 size_t numBuffers);
 
   QnnFunctionPointers m_qnnFunctionPointers;
   std::vector<std::string> m_opPackagePaths;
@@ -134,13 +516,28 @@ class QnnSampleApp {
   iotensor::OutputDataType m_outputDataType;
   iotensor::InputDataType m_inputDataType;
   ProfilingLevel m_profilingLevel;
-  qnn_wrapper_api::GraphInfo_t **m_graphsInfo;
-  uint32_t m_graphsCount;
+  qnn_wrapper_api::GraphInfo_t **m_graphsInfo = nullptr;
+  // 非空时 m_graphsInfo 指向其内部数据，由 releaseGraphsInfo 释放
+  std::unique_ptr<graphindex::GraphInfoIndex> m_graphInfoIndex;
+  uint32_t m_graphsCount = 0;
   void *m_backendLibraryHandle;
   iotensor::IOTensor m_ioTensor;
   bool m_isBackendInitialized;
   bool m_isContextCreated;
   Qnn_ProfileHandle_t m_profileBackendHandle              = nullptr;
+  // 最近若干次执行的性能分析结果，由 m_profileMutex 保护
+  std::mutex m_profileMutex;
+  std::deque<ExecutionProfile> m_profileHistory;
+  uint32_t m_profileHistorySize = DEFAULT_PROFILE_HISTORY;
+  uint64_t m_profileSequence    = 0;
+
+  metrics::LatencyHistogram m_inputStagingHistogram;
+  metrics::LatencyHistogram m_executeHistogram;
+  metrics::LatencyHistogram m_outputConversionHistogram;
+  metrics::LatencyHistogram m_inferHistogram;
+  std::atomic<uint64_t> m_executions{0};
+  std::atomic<uint64_t> m_executionFailures{0};
+  std::atomic<uint64_t> m_bytesConverted{0};
   qnn_wrapper_api::GraphConfigInfo_t **m_graphConfigsInfo = nullptr;
   uint32_t m_graphConfigsInfoCount;
   Qnn_LogHandle_t m_logHandle         = nullptr;
@@ -148,14 +545,40 @@ class QnnSampleApp {
   Qnn_DeviceHandle_t m_deviceHandle   = nullptr;
 
   // 新增：用于存储持久化的输入/输出张量，避免重复创建
-  int m_currentGraphIndex = -1; // 当前保存张量对应的图索引
-  Qnn_Tensor_t* m_storedInputs = nullptr;
-  Qnn_Tensor_t* m_storedOutputs = nullptr;
+  // 每张图一组，首次使用时分配，之后切换图不再重新分配
+  struct GraphTensors {
+    TensorSet primary;            // 默认张量组，state 不使用
+    std::vector<TensorSet> ring;  // 流水线张量组，首次 acquire 时分配
+    size_t ringNext = 0;
+  };
+  std::vector<GraphTensors> m_graphTensors;
+  int m_currentGraphIndex = -1; // 当前图索引，executeGraphs() 执行该图
+  uint32_t m_tensorRingSize = DEFAULT_TENSOR_RING_SIZE;
+  std::mutex m_ringMutex;     // 保护张量组状态
+  // 串行化 graphExecute，并保护默认张量组和 m_graphsInfo 不被 swapModel 替换；
+  // 锁顺序固定为先 m_executeMutex 后 m_ringMutex。可重入，便于 infer 等组合调用
+  mutable std::recursive_mutex m_executeMutex;
+  // graphExecuteAsync 在途计数，由 m_ringMutex 保护
+  std::condition_variable m_inFlightCv;
+  uint32_t m_inFlight    = 0;
+  uint32_t m_maxInFlight = DEFAULT_MAX_IN_FLIGHT;
+  int m_asyncSupported   = -1;  // -1 未检测，0 不支持，1 支持
+
+  // 共享内存分配器，为空表示使用 RAW 缓冲区；必须比所有张量绑定活得更久
+  std::unique_ptr<sharedmem::SharedMemAllocator> m_sharedAllocator;
+
+  // 进程内共享的 backend/device，path 构造函数创建的实例才会持有
+  std::shared_ptr<SharedBackend> m_sharedBackend;
 
   // 新增：存储动态库句柄，以便在析构函数中关闭
   void* m_ownedBackendHandle = nullptr;
   void* m_ownedModelHandle = nullptr;
   bool m_isBinaryModel = false;
+  BinaryLoadStats m_binaryLoadStats;
+  StartupStats m_startupStats;
+  bool m_startupComplete = false;  // 构造完成后不再累加 m_startupStats
+  bool m_loadedFromCache = false;
+  std::vector<WarmupStats> m_warmupStats;  // 按图索引，runs 为 0 表示未预热
   
   // 后端配置
   BackendConfig m_backendCfg;
@@ -0,0 +1,892 @@
+// 桩 QNN backend：导出 QnnInterface_getProviders，实现本库用到的 context/graph/tensor/profile/mem 接口，
+// 不做任何真实计算。用于在没有设备的 Linux 主机上测试封装层、测量封装层自身开销。
+//
+// - 执行时把第 i 个输入原样拷贝到第 i 个输出（输入不足时循环使用），长度不同时截断或补零；
+// - 每次执行额外等待 QNN_STUB_LATENCY_US 微秒（默认 0）模拟设备耗时，
+//   同一 backend 的执行串行进行，与真实加速器一样排队；
+// - 支持 graphExecuteAsync（单个工作线程，FIFO 深度 STUB_ASYNC_QUEUE_DEPTH）与 ION 共享内存注册；
+// - context binary 为 StubBinary.hpp 描述的桩格式，可由 qnn-stub-gen 生成，
+//   也可由 model .so 在桩 backend 上 composeGraphs 后经 contextGetBinary 保存。
+
+#include <sys/mman.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "QnnInterface.h"
+#include "QnnTypeMacros.hpp"
+#include "StubBinary.hpp"
+
+using namespace qnn::tools;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// 与官方 backend ID 不冲突即可
+constexpr uint32_t STUB_BACKEND_ID = 0x5354;
+
+constexpr size_t STUB_ASYNC_QUEUE_DEPTH = 16;
+
+const char *STUB_BUILD_ID = "qnn-stub-backend-1.0";
+
+struct StubLog {
+  QnnLog_Callback_t callback;
+  QnnLog_Level_t maxLevel;
+};
+
+struct StubContext;
+struct StubBackend;
+
+struct StubGraph {
+  StubContext *context = nullptr;
+  stub::StubGraphSpec spec;
+  bool finalized    = false;
+  uint32_t numNodes = 0;
+  uint32_t nextTensorId = 1;
+};
+
+struct StubContext {
+  StubBackend *backend = nullptr;
+  std::vector<std::unique_ptr<StubGraph>> graphs;
+};
+
+struct StubMem {
+  StubContext *context;
+  void *addr;
+  size_t size;
+};
+
+struct AsyncJob {
+  StubGraph *graph;
+  std::vector<Qnn_Tensor_t> inputs;
+  std::vector<Qnn_Tensor_t> outputs;
+  Qnn_ProfileHandle_t profile;
+  Qnn_NotifyFn_t notifyFn;
+  void *notifyParam;
+};
+
+struct StubBackend {
+  StubLog *log = nullptr;
+  std::chrono::microseconds latency{0};
+
+  // 模拟单个加速器：同一 backend 上的执行串行
+  std::mutex deviceMutex;
+
+  std::mutex queueMutex;
+  std::condition_variable queueCv;
+  std::condition_variable idleCv;
+  std::deque<AsyncJob> queue;
+  bool busy     = false;
+  bool stopping = false;
+  std::thread worker;
+};
+
+struct StubProfile {
+  QnnProfile_Level_t level;
+  std::mutex mutex;
+  std::vector<QnnProfile_EventId_t> events;
+};
+
+struct StubEvent {
+  QnnProfile_EventData_t data;
+  std::string identifier;
+  std::vector<QnnProfile_EventId_t> subEvents;
+};
+
+// 事件 ID 在 profileGetSubEvents/profileGetEventData 中不带 profile 句柄，只能全局登记
+std::mutex g_eventMutex;
+std::unordered_map<QnnProfile_EventId_t, StubEvent> g_events;
+QnnProfile_EventId_t g_nextEventId = 1;
+
+std::mutex g_memMutex;
+std::unordered_set<StubMem *> g_mems;
+
+void stubLog(StubBackend *backend, QnnLog_Level_t level, const char *fmt, ...) {
+  if (nullptr == backend || nullptr == backend->log || nullptr == backend->log->callback ||
+      level > backend->log->maxLevel) {
+    return;
+  }
+  uint64_t timestamp = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch())
+          .count());
+  va_list args;
+  va_start(args, fmt);
+  backend->log->callback(fmt, level, timestamp, args);
+  va_end(args);
+}
+
+uint64_t elapsedUs(Clock::time_point start, Clock::time_point end) {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
+
+// ---------------------------------------------------------------------------
+// profile
+// ---------------------------------------------------------------------------
+
+struct EventSpec {
+  QnnProfile_EventType_t type;
+  const char *identifier;
+  uint64_t valueUs;
+};
+
+QnnProfile_EventId_t addEventLocked(const EventSpec &spec) {
+  QnnProfile_EventId_t eventId = g_nextEventId++;
+  StubEvent &event             = g_events[eventId];
+  event.identifier             = spec.identifier;
+  event.data.type              = spec.type;
+  event.data.unit              = QNN_PROFILE_EVENTUNIT_MICROSEC;
+  event.data.value             = spec.valueUs;
+  event.data.identifier        = event.identifier.c_str();
+  return eventId;
+}
+
+void freeEventLocked(QnnProfile_EventId_t eventId) {
+  auto it = g_events.find(eventId);
+  if (it == g_events.end()) {
+    return;
+  }
+  std::vector<QnnProfile_EventId_t> subEvents = std::move(it->second.subEvents);
+  g_events.erase(it);
+  for (QnnProfile_EventId_t subEvent : subEvents) {
+    freeEventLocked(subEvent);
+  }
+}
+
+// 每次调用替换上一次的事件，profileGetEvents 只返回最近一次操作的结果；
+// 子事件仅在 DETAILED 级别下记录
+void recordProfile(Qnn_ProfileHandle_t profileHandle,
+                   const EventSpec &root,
+                   const std::vector<EventSpec> &children = {}) {
+  if (nullptr == profileHandle) {
+    return;
+  }
+  auto *profile = static_cast<StubProfile *>(profileHandle);
+  std::lock_guard<std::mutex> profileLock(profile->mutex);
+  std::lock_guard<std::mutex> eventLock(g_eventMutex);
+  for (QnnProfile_EventId_t eventId : profile->events) {
+    freeEventLocked(eventId);
+  }
+  profile->events.clear();
+  QnnProfile_EventId_t rootId = addEventLocked(root);
+  if (QNN_PROFILE_LEVEL_DETAILED == profile->level) {
+    for (const EventSpec &child : children) {
+      QnnProfile_EventId_t childId = addEventLocked(child);
+      g_events[rootId].subEvents.push_back(childId);
+    }
+  }
+  profile->events.push_back(rootId);
+}
+
+Qnn_ErrorHandle_t stubProfileCreate(Qnn_BackendHandle_t backend,
+                                    QnnProfile_Level_t level,
+                                    Qnn_ProfileHandle_t *profileHandle) {
+  if (nullptr == profileHandle) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  auto *profile  = new StubProfile();
+  profile->level = level;
+  *profileHandle = profile;
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubProfileGetEvents(Qnn_ProfileHandle_t profileHandle,
+                                       const QnnProfile_EventId_t **profileEventIds,
+                                       uint32_t *numEvents) {
+  if (nullptr == profileHandle || nullptr == profileEventIds || nullptr == numEvents) {
+    return QNN_PROFILE_ERROR_INVALID_HANDLE;
+  }
+  auto *profile = static_cast<StubProfile *>(profileHandle);
+  std::lock_guard<std::mutex> lock(profile->mutex);
+  *profileEventIds = profile->events.data();
+  *numEvents       = static_cast<uint32_t>(profile->events.size());
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubProfileGetSubEvents(QnnProfile_EventId_t eventId,
+                                          const QnnProfile_EventId_t **subEventIds,
+                                          uint32_t *numSubEvents) {
+  if (nullptr == subEventIds || nullptr == numSubEvents) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  std::lock_guard<std::mutex> lock(g_eventMutex);
+  auto it = g_events.find(eventId);
+  if (it == g_events.end()) {
+    return QNN_PROFILE_ERROR_INVALID_HANDLE;
+  }
+  *subEventIds  = it->second.subEvents.data();
+  *numSubEvents = static_cast<uint32_t>(it->second.subEvents.size());
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubProfileGetEventData(QnnProfile_EventId_t eventId,
+                                          QnnProfile_EventData_t *eventData) {
+  if (nullptr == eventData) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  std::lock_guard<std::mutex> lock(g_eventMutex);
+  auto it = g_events.find(eventId);
+  if (it == g_events.end()) {
+    return QNN_PROFILE_ERROR_INVALID_HANDLE;
+  }
+  *eventData = it->second.data;
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubProfileFree(Qnn_ProfileHandle_t profileHandle) {
+  if (nullptr == profileHandle) {
+    return QNN_PROFILE_ERROR_INVALID_HANDLE;
+  }
+  auto *profile = static_cast<StubProfile *>(profileHandle);
+  {
+    std::lock_guard<std::mutex> lock(g_eventMutex);
+    for (QnnProfile_EventId_t eventId : profile->events) {
+      freeEventLocked(eventId);
+    }
+  }
+  delete profile;
+  return QNN_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// 执行
+// ---------------------------------------------------------------------------
+
+bool tensorBuffer(const Qnn_Tensor_t &tensor, uint8_t *&data, size_t &size) {
+  if (QNN_TENSORMEMTYPE_MEMHANDLE == getQnnTensorMemType(tensor)) {
+    auto *mem = static_cast<StubMem *>(getQnnTensorMemHandle(tensor));
+    std::lock_guard<std::mutex> lock(g_memMutex);
+    if (0 == g_mems.count(mem)) {
+      return false;
+    }
+    data = static_cast<uint8_t *>(mem->addr);
+    size = mem->size;
+    return true;
+  }
+  Qnn_ClientBuffer_t clientBuf = getQnnTensorClientBuf(tensor);
+  data                         = static_cast<uint8_t *>(clientBuf.data);
+  size                         = clientBuf.dataSize;
+  return nullptr != data || 0 == size;
+}
+
+// sleep 的唤醒误差在几十微秒量级，最后一段自旋等待以保证延迟可复现
+void waitUntil(Clock::time_point deadline) {
+  const auto spinWindow = std::chrono::microseconds(200);
+  auto now              = Clock::now();
+  if (deadline - now > spinWindow) {
+    std::this_thread::sleep_until(deadline - spinWindow);
+  }
+  while (Clock::now() < deadline) {
+  }
+}
+
+Qnn_ErrorHandle_t executeGraph(StubGraph *graph,
+                               const Qnn_Tensor_t *inputs,
+                               uint32_t numInputs,
+                               Qnn_Tensor_t *outputs,
+                               uint32_t numOutputs,
+                               Qnn_ProfileHandle_t profile) {
+  StubBackend *backend = graph->context->backend;
+  if (numInputs != graph->spec.inputs.size() || numOutputs != graph->spec.outputs.size() ||
+      (numInputs > 0 && nullptr == inputs) || (numOutputs > 0 && nullptr == outputs)) {
+    stubLog(backend, QNN_LOG_LEVEL_ERROR, "Graph %s expects %zu inputs and %zu outputs, got %u/%u",
+            graph->spec.name.c_str(), graph->spec.inputs.size(), graph->spec.outputs.size(),
+            numInputs, numOutputs);
+    return QNN_GRAPH_ERROR_INVALID_ARGUMENT;
+  }
+
+  auto start = Clock::now();
+  std::vector<std::pair<uint8_t *, size_t>> inputBuffers(numInputs);
+  std::vector<std::pair<uint8_t *, size_t>> outputBuffers(numOutputs);
+  for (uint32_t i = 0; i < numInputs; i++) {
+    if (!tensorBuffer(inputs[i], inputBuffers[i].first, inputBuffers[i].second)) {
+      return QNN_GRAPH_ERROR_INVALID_ARGUMENT;
+    }
+  }
+  for (uint32_t i = 0; i < numOutputs; i++) {
+    if (!tensorBuffer(outputs[i], outputBuffers[i].first, outputBuffers[i].second)) {
+      return QNN_GRAPH_ERROR_INVALID_ARGUMENT;
+    }
+  }
+  auto prepared = Clock::now();
+
+  Clock::time_point deviceStart, deviceEnd, end;
+  {
+    std::lock_guard<std::mutex> lock(backend->deviceMutex);
+    deviceStart = Clock::now();
+    if (backend->latency.count() > 0) {
+      waitUntil(deviceStart + backend->latency);
+    }
+    deviceEnd = Clock::now();
+    for (uint32_t i = 0; i < numOutputs; i++) {
+      uint8_t *dst   = outputBuffers[i].first;
+      size_t dstSize = outputBuffers[i].second;
+      size_t copied  = 0;
+      if (numInputs > 0) {
+        const auto &src = inputBuffers[i % numInputs];
+        copied          = std::min(src.second, dstSize);
+        if (copied > 0 && src.first != dst) {
+          memmove(dst, src.first, copied);
+        }
+      }
+      if (dstSize > copied) {
+        memset(dst + copied, 0, dstSize - copied);
+      }
+    }
+    end = Clock::now();
+  }
+
+  recordProfile(profile,
+                {QNN_PROFILE_EVENTTYPE_EXECUTE, "QNN (execute) time", elapsedUs(start, end)},
+                {{QNN_PROFILE_EVENTTYPE_EXECUTE_PREPROCESS, "Stub: resolve tensor buffers",
+                  elapsedUs(start, prepared)},
+                 {QNN_PROFILE_EVENTTYPE_EXECUTE_QUEUE_WAIT, "Stub: wait for device",
+                  elapsedUs(prepared, deviceStart)},
+                 {QNN_PROFILE_EVENTTYPE_EXECUTE_DEVICE, "Stub: synthetic latency",
+                  elapsedUs(deviceStart, deviceEnd)},
+                 {QNN_PROFILE_EVENTTYPE_EXECUTE_POSTPROCESS, "Stub: echo outputs",
+                  elapsedUs(deviceEnd, end)}});
+  return QNN_SUCCESS;
+}
+
+void asyncWorkerLoop(StubBackend *backend) {
+  std::unique_lock<std::mutex> lock(backend->queueMutex);
+  while (true) {
+    backend->queueCv.wait(lock, [backend] { return backend->stopping || !backend->queue.empty(); });
+    if (backend->queue.empty()) {
+      return;
+    }
+    AsyncJob job = std::move(backend->queue.front());
+    backend->queue.pop_front();
+    backend->busy = true;
+    lock.unlock();
+
+    Qnn_NotifyStatus_t status;
+    status.error = executeGraph(job.graph, job.inputs.data(),
+                                static_cast<uint32_t>(job.inputs.size()), job.outputs.data(),
+                                static_cast<uint32_t>(job.outputs.size()), job.profile);
+    if (nullptr != job.notifyFn) {
+      job.notifyFn(job.notifyParam, status);
+    }
+
+    lock.lock();
+    backend->busy = false;
+    backend->idleCv.notify_all();
+  }
+}
+
+// 等待已提交的异步执行全部完成，释放 context 前调用
+void drainAsyncQueue(StubBackend *backend) {
+  std::unique_lock<std::mutex> lock(backend->queueMutex);
+  backend->idleCv.wait(lock, [backend] { return backend->queue.empty() && !backend->busy; });
+}
+
+// ---------------------------------------------------------------------------
+// backend / log / property
+// ---------------------------------------------------------------------------
+
+Qnn_ErrorHandle_t stubPropertyHasCapability(QnnProperty_Key_t key) {
+  if (QNN_PROPERTY_GRAPH_SUPPORT_ASYNC_EXECUTION == key) {
+    return QNN_PROPERTY_SUPPORTED;
+  }
+  return QNN_PROPERTY_NOT_SUPPORTED;
+}
+
+Qnn_ErrorHandle_t stubLogCreate(QnnLog_Callback_t callback,
+                                QnnLog_Level_t maxLogLevel,
+                                Qnn_LogHandle_t *logger) {
+  if (nullptr == logger) {
+    return QNN_LOG_ERROR_INVALID_ARGUMENT;
+  }
+  *logger = new StubLog{callback, maxLogLevel};
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubLogSetLogLevel(Qnn_LogHandle_t logger, QnnLog_Level_t maxLogLevel) {
+  if (nullptr == logger) {
+    return QNN_LOG_ERROR_INVALID_ARGUMENT;
+  }
+  static_cast<StubLog *>(logger)->maxLevel = maxLogLevel;
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubLogFree(Qnn_LogHandle_t logger) {
+  delete static_cast<StubLog *>(logger);
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubBackendCreate(Qnn_LogHandle_t logger,
+                                    const QnnBackend_Config_t **config,
+                                    Qnn_BackendHandle_t *backendHandle) {
+  if (nullptr == backendHandle) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  auto *backend = new StubBackend();
+  backend->log  = static_cast<StubLog *>(logger);
+  if (const char *latency = getenv("QNN_STUB_LATENCY_US")) {
+    backend->latency = std::chrono::microseconds(strtoull(latency, nullptr, 10));
+  }
+  backend->worker = std::thread(asyncWorkerLoop, backend);
+  stubLog(backend, QNN_LOG_LEVEL_INFO, "Stub backend created, synthetic latency %lld us",
+          static_cast<long long>(backend->latency.count()));
+  *backendHandle = backend;
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubBackendSetConfig(Qnn_BackendHandle_t backend,
+                                       const QnnBackend_Config_t **config) {
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubBackendGetApiVersion(Qnn_ApiVersion_t *pVersion) {
+  if (nullptr == pVersion) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  pVersion->coreApiVersion    = {QNN_API_VERSION_MAJOR, QNN_API_VERSION_MINOR,
+                                 QNN_API_VERSION_PATCH};
+  pVersion->backendApiVersion = {1, 0, 0};
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubBackendGetBuildId(const char **id) {
+  if (nullptr == id) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  *id = STUB_BUILD_ID;
+  return QNN_SUCCESS;
+}
+
+// 桩 backend 不执行算子，op package 只需登记成功
+Qnn_ErrorHandle_t stubBackendRegisterOpPackage(Qnn_BackendHandle_t backend,
+                                               const char *packagePath,
+                                               const char *interfaceProvider,
+                                               const char *target) {
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubBackendValidateOpConfig(Qnn_BackendHandle_t backend,
+                                              Qnn_OpConfig_t opConfig) {
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubBackendFree(Qnn_BackendHandle_t backendHandle) {
+  auto *backend = static_cast<StubBackend *>(backendHandle);
+  if (nullptr == backend) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  {
+    std::lock_guard<std::mutex> lock(backend->queueMutex);
+    backend->stopping = true;
+  }
+  backend->queueCv.notify_all();
+  if (backend->worker.joinable()) {
+    backend->worker.join();
+  }
+  delete backend;
+  return QNN_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// context
+// ---------------------------------------------------------------------------
+
+Qnn_ErrorHandle_t stubContextCreate(Qnn_BackendHandle_t backend,
+                                    Qnn_DeviceHandle_t device,
+                                    const QnnContext_Config_t **config,
+                                    Qnn_ContextHandle_t *contextHandle) {
+  if (nullptr == backend || nullptr == contextHandle) {
+    return QNN_CONTEXT_ERROR_INVALID_ARGUMENT;
+  }
+  auto *context    = new StubContext();
+  context->backend = static_cast<StubBackend *>(backend);
+  *contextHandle   = context;
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubContextSetConfig(Qnn_ContextHandle_t context,
+                                       const QnnContext_Config_t **config) {
+  return QNN_SUCCESS;
+}
+
+std::vector<uint8_t> serializeContext(StubContext *context) {
+  std::vector<stub::StubGraphSpec> specs;
+  specs.reserve(context->graphs.size());
+  for (const auto &graph : context->graphs) {
+    specs.push_back(graph->spec);
+  }
+  return stub::serialize(specs);
+}
+
+Qnn_ErrorHandle_t stubContextGetBinarySize(Qnn_ContextHandle_t contextHandle,
+                                           Qnn_ContextBinarySize_t *binaryBufferSize) {
+  if (nullptr == contextHandle || nullptr == binaryBufferSize) {
+    return QNN_CONTEXT_ERROR_INVALID_ARGUMENT;
+  }
+  *binaryBufferSize = serializeContext(static_cast<StubContext *>(contextHandle)).size();
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubContextGetBinary(Qnn_ContextHandle_t contextHandle,
+                                       void *binaryBuffer,
+                                       Qnn_ContextBinarySize_t binaryBufferSize,
+                                       Qnn_ContextBinarySize_t *writtenBufferSize) {
+  if (nullptr == contextHandle || nullptr == binaryBuffer || nullptr == writtenBufferSize) {
+    return QNN_CONTEXT_ERROR_INVALID_ARGUMENT;
+  }
+  std::vector<uint8_t> binary = serializeContext(static_cast<StubContext *>(contextHandle));
+  if (binary.size() > binaryBufferSize) {
+    return QNN_CONTEXT_ERROR_INVALID_ARGUMENT;
+  }
+  memcpy(binaryBuffer, binary.data(), binary.size());
+  *writtenBufferSize = binary.size();
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubContextCreateFromBinary(Qnn_BackendHandle_t backend,
+                                              Qnn_DeviceHandle_t device,
+                                              const QnnContext_Config_t **config,
+                                              const void *binaryBuffer,
+                                              Qnn_ContextBinarySize_t binaryBufferSize,
+                                              Qnn_ContextHandle_t *contextHandle,
+                                              Qnn_ProfileHandle_t profile) {
+  if (nullptr == backend || nullptr == contextHandle) {
+    return QNN_CONTEXT_ERROR_INVALID_ARGUMENT;
+  }
+  auto start = Clock::now();
+  std::vector<stub::StubGraphSpec> specs;
+  if (!stub::parse(binaryBuffer, binaryBufferSize, specs)) {
+    stubLog(static_cast<StubBackend *>(backend), QNN_LOG_LEVEL_ERROR,
+            "Context binary is not a stub backend binary");
+    return QNN_CONTEXT_ERROR_BINARY_VERSION;
+  }
+  auto *context    = new StubContext();
+  context->backend = static_cast<StubBackend *>(backend);
+  for (auto &spec : specs) {
+    auto graph       = std::make_unique<StubGraph>();
+    graph->context   = context;
+    graph->spec      = std::move(spec);
+    graph->finalized = true;
+    context->graphs.push_back(std::move(graph));
+  }
+  recordProfile(profile, {QNN_PROFILE_EVENTTYPE_INIT, "QNN (init) time",
+                          elapsedUs(start, Clock::now())});
+  *contextHandle = context;
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubContextFree(Qnn_ContextHandle_t contextHandle, Qnn_ProfileHandle_t profile) {
+  auto *context = static_cast<StubContext *>(contextHandle);
+  if (nullptr == context) {
+    return QNN_CONTEXT_ERROR_INVALID_ARGUMENT;
+  }
+  auto start = Clock::now();
+  drainAsyncQueue(context->backend);
+  {
+    // 未注销的共享内存随 context 一起释放
+    std::lock_guard<std::mutex> lock(g_memMutex);
+    for (auto it = g_mems.begin(); it != g_mems.end();) {
+      if ((*it)->context == context) {
+        munmap((*it)->addr, (*it)->size);
+        delete *it;
+        it = g_mems.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  delete context;
+  recordProfile(profile, {QNN_PROFILE_EVENTTYPE_DEINIT, "QNN (deinit) time",
+                          elapsedUs(start, Clock::now())});
+  return QNN_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// graph / tensor
+// ---------------------------------------------------------------------------
+
+Qnn_ErrorHandle_t stubGraphCreate(Qnn_ContextHandle_t contextHandle,
+                                  const char *graphName,
+                                  const QnnGraph_Config_t **config,
+                                  Qnn_GraphHandle_t *graphHandle) {
+  auto *context = static_cast<StubContext *>(contextHandle);
+  if (nullptr == context || nullptr == graphName || nullptr == graphHandle) {
+    return QNN_GRAPH_ERROR_INVALID_ARGUMENT;
+  }
+  for (const auto &graph : context->graphs) {
+    if (graph->spec.name == graphName) {
+      return QNN_GRAPH_ERROR_INVALID_NAME;
+    }
+  }
+  auto graph       = std::make_unique<StubGraph>();
+  graph->context   = context;
+  graph->spec.name = graphName;
+  *graphHandle     = graph.get();
+  context->graphs.push_back(std::move(graph));
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubGraphSetConfig(Qnn_GraphHandle_t graph, const QnnGraph_Config_t **config) {
+  return nullptr == graph ? QNN_GRAPH_ERROR_INVALID_HANDLE : QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubGraphAddNode(Qnn_GraphHandle_t graphHandle, Qnn_OpConfig_t opConfig) {
+  auto *graph = static_cast<StubGraph *>(graphHandle);
+  if (nullptr == graph) {
+    return QNN_GRAPH_ERROR_INVALID_HANDLE;
+  }
+  graph->numNodes++;
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubGraphFinalize(Qnn_GraphHandle_t graphHandle,
+                                    Qnn_ProfileHandle_t profile,
+                                    Qnn_SignalHandle_t signal) {
+  auto *graph = static_cast<StubGraph *>(graphHandle);
+  if (nullptr == graph) {
+    return QNN_GRAPH_ERROR_INVALID_HANDLE;
+  }
+  graph->finalized = true;
+  recordProfile(profile, {QNN_PROFILE_EVENTTYPE_FINALIZE, "QNN (finalize) time", 0});
+  stubLog(graph->context->backend, QNN_LOG_LEVEL_INFO,
+          "Finalized stub graph %s: %u nodes, %zu inputs, %zu outputs", graph->spec.name.c_str(),
+          graph->numNodes, graph->spec.inputs.size(), graph->spec.outputs.size());
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubGraphRetrieve(Qnn_ContextHandle_t contextHandle,
+                                    const char *graphName,
+                                    Qnn_GraphHandle_t *graphHandle) {
+  auto *context = static_cast<StubContext *>(contextHandle);
+  if (nullptr == context || nullptr == graphName || nullptr == graphHandle) {
+    return QNN_GRAPH_ERROR_INVALID_ARGUMENT;
+  }
+  for (const auto &graph : context->graphs) {
+    if (graph->spec.name == graphName) {
+      *graphHandle = graph.get();
+      return QNN_SUCCESS;
+    }
+  }
+  return QNN_GRAPH_ERROR_GRAPH_DOES_NOT_EXIST;
+}
+
+Qnn_ErrorHandle_t stubGraphExecute(Qnn_GraphHandle_t graphHandle,
+                                   const Qnn_Tensor_t *inputs,
+                                   uint32_t numInputs,
+                                   Qnn_Tensor_t *outputs,
+                                   uint32_t numOutputs,
+                                   Qnn_ProfileHandle_t profile,
+                                   Qnn_SignalHandle_t signal) {
+  auto *graph = static_cast<StubGraph *>(graphHandle);
+  if (nullptr == graph) {
+    return QNN_GRAPH_ERROR_INVALID_HANDLE;
+  }
+  return executeGraph(graph, inputs, numInputs, outputs, numOutputs, profile);
+}
+
+Qnn_ErrorHandle_t stubGraphExecuteAsync(Qnn_GraphHandle_t graphHandle,
+                                        const Qnn_Tensor_t *inputs,
+                                        uint32_t numInputs,
+                                        Qnn_Tensor_t *outputs,
+                                        uint32_t numOutputs,
+                                        Qnn_ProfileHandle_t profile,
+                                        Qnn_SignalHandle_t signal,
+                                        Qnn_NotifyFn_t notifyFn,
+                                        void *notifyParam) {
+  auto *graph = static_cast<StubGraph *>(graphHandle);
+  if (nullptr == graph) {
+    return QNN_GRAPH_ERROR_INVALID_HANDLE;
+  }
+  if ((numInputs > 0 && nullptr == inputs) || (numOutputs > 0 && nullptr == outputs)) {
+    return QNN_GRAPH_ERROR_INVALID_ARGUMENT;
+  }
+  StubBackend *backend = graph->context->backend;
+  {
+    std::lock_guard<std::mutex> lock(backend->queueMutex);
+    if (backend->queue.size() >= STUB_ASYNC_QUEUE_DEPTH) {
+      return QNN_GRAPH_ERROR_EXECUTION_ASYNC_FIFO_FULL;
+    }
+    // 张量描述按值拷贝，数据缓冲区仍由调用方在通知前保持有效
+    backend->queue.push_back(AsyncJob{graph,
+                                      std::vector<Qnn_Tensor_t>(inputs, inputs + numInputs),
+                                      std::vector<Qnn_Tensor_t>(outputs, outputs + numOutputs),
+                                      profile, notifyFn, notifyParam});
+  }
+  backend->queueCv.notify_one();
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubTensorCreateContextTensor(Qnn_ContextHandle_t context,
+                                                Qnn_Tensor_t *tensor) {
+  return nullptr == context || nullptr == tensor ? QNN_COMMON_ERROR_INVALID_ARGUMENT
+                                                 : QNN_SUCCESS;
+}
+
+// 只记录 APP_WRITE/APP_READ 张量作为图的输入/输出，按创建顺序排列
+Qnn_ErrorHandle_t stubTensorCreateGraphTensor(Qnn_GraphHandle_t graphHandle,
+                                              Qnn_Tensor_t *tensor) {
+  auto *graph = static_cast<StubGraph *>(graphHandle);
+  if (nullptr == graph || nullptr == tensor) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  setQnnTensorId(tensor, graph->nextTensorId++);
+  Qnn_TensorType_t type = getQnnTensorType(tensor);
+  if (QNN_TENSOR_TYPE_APP_WRITE != type && QNN_TENSOR_TYPE_APP_READ != type) {
+    return QNN_SUCCESS;
+  }
+  stub::StubTensorSpec spec;
+  spec.name     = nullptr != getQnnTensorName(tensor) ? getQnnTensorName(tensor) : "";
+  spec.dataType = getQnnTensorDataType(tensor);
+  Qnn_QuantizeParams_t quantizeParams = getQnnTensorQuantParams(tensor);
+  if (QNN_QUANTIZATION_ENCODING_SCALE_OFFSET == quantizeParams.quantizationEncoding) {
+    spec.scale  = quantizeParams.scaleOffsetEncoding.scale;
+    spec.offset = quantizeParams.scaleOffsetEncoding.offset;
+  }
+  const uint32_t *dims = getQnnTensorDimensions(tensor);
+  spec.dims.assign(dims, dims + (nullptr != dims ? getQnnTensorRank(tensor) : 0));
+  (QNN_TENSOR_TYPE_APP_WRITE == type ? graph->spec.inputs : graph->spec.outputs)
+      .push_back(std::move(spec));
+  return QNN_SUCCESS;
+}
+
+// ---------------------------------------------------------------------------
+// mem
+// ---------------------------------------------------------------------------
+
+Qnn_ErrorHandle_t stubMemDeRegister(const Qnn_MemHandle_t *memHandles, uint32_t numMemHandles) {
+  if (nullptr == memHandles) {
+    return QNN_MEM_ERROR_INVALID_ARGUMENT;
+  }
+  std::lock_guard<std::mutex> lock(g_memMutex);
+  for (uint32_t i = 0; i < numMemHandles; i++) {
+    auto *mem = static_cast<StubMem *>(memHandles[i]);
+    if (0 == g_mems.erase(mem)) {
+      return QNN_MEM_ERROR_INVALID_ARGUMENT;
+    }
+    munmap(mem->addr, mem->size);
+    delete mem;
+  }
+  return QNN_SUCCESS;
+}
+
+// 只支持 ION（fd）描述符：按 memShape 与 dataType 计算大小后映射同一块内存
+Qnn_ErrorHandle_t stubMemRegister(Qnn_ContextHandle_t contextHandle,
+                                  const Qnn_MemDescriptor_t *memDescriptors,
+                                  uint32_t numDescriptors,
+                                  Qnn_MemHandle_t *memHandles) {
+  if (nullptr == contextHandle || nullptr == memDescriptors || nullptr == memHandles) {
+    return QNN_MEM_ERROR_INVALID_ARGUMENT;
+  }
+  for (uint32_t i = 0; i < numDescriptors; i++) {
+    const Qnn_MemDescriptor_t &descriptor = memDescriptors[i];
+    Qnn_ErrorHandle_t error               = QNN_SUCCESS;
+    size_t size                           = stub::dataTypeSize(descriptor.dataType);
+    for (uint32_t d = 0; d < descriptor.memShape.numDim; d++) {
+      size *= descriptor.memShape.dimSize[d];
+    }
+    void *addr = MAP_FAILED;
+    if (QNN_MEM_TYPE_ION != descriptor.memType) {
+      error = QNN_MEM_ERROR_UNSUPPORTED_FEATURE;
+    } else if (0 == size) {
+      error = QNN_MEM_ERROR_INVALID_ARGUMENT;
+    } else {
+      addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor.ionInfo.fd, 0);
+      if (MAP_FAILED == addr) {
+        error = QNN_MEM_ERROR_INVALID_ARGUMENT;
+      }
+    }
+    if (QNN_SUCCESS != error) {
+      stubMemDeRegister(memHandles, i);
+      return error;
+    }
+    auto *mem = new StubMem{static_cast<StubContext *>(contextHandle), addr, size};
+    {
+      std::lock_guard<std::mutex> lock(g_memMutex);
+      g_mems.insert(mem);
+    }
+    memHandles[i] = mem;
+  }
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubErrorGetMessage(Qnn_ErrorHandle_t errorHandle, const char **errorMessage) {
+  if (nullptr == errorMessage) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  *errorMessage = "stub backend error";
+  return QNN_SUCCESS;
+}
+
+QnnInterface_t makeInterface() {
+  QnnInterface_t backendInterface;
+  memset(&backendInterface, 0, sizeof(backendInterface));
+  backendInterface.backendId                    = STUB_BACKEND_ID;
+  backendInterface.providerName                 = "STUB_QNN_BACKEND";
+  backendInterface.apiVersion.coreApiVersion    = {QNN_API_VERSION_MAJOR, QNN_API_VERSION_MINOR,
+                                                   QNN_API_VERSION_PATCH};
+  backendInterface.apiVersion.backendApiVersion = {1, 0, 0};
+
+  // 逐项赋值而不是按位置初始化，不同 SDK 版本的接口结构体字段顺序不同
+  auto &impl                       = backendInterface.QNN_INTERFACE_VER_NAME;
+  impl.propertyHasCapability       = stubPropertyHasCapability;
+  impl.backendCreate               = stubBackendCreate;
+  impl.backendSetConfig            = stubBackendSetConfig;
+  impl.backendGetApiVersion        = stubBackendGetApiVersion;
+  impl.backendGetBuildId           = stubBackendGetBuildId;
+  impl.backendRegisterOpPackage    = stubBackendRegisterOpPackage;
+  impl.backendValidateOpConfig     = stubBackendValidateOpConfig;
+  impl.backendFree                 = stubBackendFree;
+  impl.contextCreate               = stubContextCreate;
+  impl.contextSetConfig            = stubContextSetConfig;
+  impl.contextGetBinarySize        = stubContextGetBinarySize;
+  impl.contextGetBinary            = stubContextGetBinary;
+  impl.contextCreateFromBinary     = stubContextCreateFromBinary;
+  impl.contextFree                 = stubContextFree;
+  impl.graphCreate                 = stubGraphCreate;
+  impl.graphSetConfig              = stubGraphSetConfig;
+  impl.graphAddNode                = stubGraphAddNode;
+  impl.graphFinalize               = stubGraphFinalize;
+  impl.graphRetrieve               = stubGraphRetrieve;
+  impl.graphExecute                = stubGraphExecute;
+  impl.graphExecuteAsync           = stubGraphExecuteAsync;
+  impl.tensorCreateContextTensor   = stubTensorCreateContextTensor;
+  impl.tensorCreateGraphTensor     = stubTensorCreateGraphTensor;
+  impl.logCreate                   = stubLogCreate;
+  impl.logSetLogLevel              = stubLogSetLogLevel;
+  impl.logFree                     = stubLogFree;
+  impl.profileCreate               = stubProfileCreate;
+  impl.profileGetEvents            = stubProfileGetEvents;
+  impl.profileGetSubEvents         = stubProfileGetSubEvents;
+  impl.profileGetEventData         = stubProfileGetEventData;
+  impl.profileFree                 = stubProfileFree;
+  impl.memRegister                 = stubMemRegister;
+  impl.memDeRegister               = stubMemDeRegister;
+  impl.errorGetMessage             = stubErrorGetMessage;
+  // device 相关接口留空：本库在 deviceCreate 为空时跳过 device 创建与性能配置
+  return backendInterface;
+}
+
+}  // namespace
+
+extern "C" QNN_API Qnn_ErrorHandle_t QnnInterface_getProviders(const QnnInterface_t ***providerList,
+                                                                uint32_t *numProviders) {
+  if (nullptr == providerList || nullptr == numProviders) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  static const QnnInterface_t backendInterface = makeInterface();
+  static const QnnInterface_t *providers[]     = {&backendInterface};
+  *providerList = providers;
+  *numProviders = 1;
+  return QNN_SUCCESS;
+}
@@ -0,0 +1,140 @@
+// 桩 System 库：解析桩 backend 生成的 context binary，返回 binary info。
+// 编译为 libQnnSystem.so，与 libQnnStub.so 放在同一目录，加载 .bin 时按 backend 目录查找。
+
+#include <cstring>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "QnnTypeMacros.hpp"
+#include "StubBinary.hpp"
+#include "System/QnnSystemInterface.h"
+
+using namespace qnn::tools;
+
+namespace {
+
+// 一次 systemContextGetBinaryInfo 的结果，指针全部指向本对象内部，随 system context 释放
+struct BinaryInfoStorage {
+  std::vector<stub::StubGraphSpec> graphs;
+  std::vector<std::vector<Qnn_Tensor_t>> tensors;
+  std::vector<QnnSystemContext_GraphInfo_t> graphInfos;
+  QnnSystemContext_BinaryInfo_t binaryInfo;
+};
+
+struct SystemContext {
+  std::list<std::unique_ptr<BinaryInfoStorage>> infos;
+};
+
+std::vector<Qnn_Tensor_t> toQnnTensors(std::vector<stub::StubTensorSpec> &specs,
+                                       Qnn_TensorType_t type,
+                                       uint32_t firstId) {
+  std::vector<Qnn_Tensor_t> tensors;
+  tensors.reserve(specs.size());
+  for (auto &spec : specs) {
+    Qnn_Tensor_t tensor = createQnnTensor(QNN_TENSOR_VERSION_1);
+    Qnn_QuantizeParams_t quantizeParams = QNN_QUANTIZE_PARAMS_INIT;
+    if (spec.scale != 0.0f) {
+      quantizeParams.encodingDefinition          = QNN_DEFINITION_DEFINED;
+      quantizeParams.quantizationEncoding        = QNN_QUANTIZATION_ENCODING_SCALE_OFFSET;
+      quantizeParams.scaleOffsetEncoding.scale  = spec.scale;
+      quantizeParams.scaleOffsetEncoding.offset = spec.offset;
+    }
+    setQnnTensorId(tensor, firstId++);
+    setQnnTensorName(tensor, spec.name.c_str());
+    setQnnTensorType(tensor, type);
+    setQnnTensorDataFormat(tensor, QNN_TENSOR_DATA_FORMAT_FLAT_BUFFER);
+    setQnnTensorDataType(tensor, spec.dataType);
+    setQnnTensorQuantParams(tensor, quantizeParams);
+    setQnnTensorRank(tensor, static_cast<uint32_t>(spec.dims.size()));
+    setQnnTensorDimensions(tensor, spec.dims.data());
+    setQnnTensorMemType(tensor, QNN_TENSORMEMTYPE_RAW);
+    setQnnTensorClientBuf(tensor, Qnn_ClientBuffer_t{nullptr, 0});
+    tensors.push_back(tensor);
+  }
+  return tensors;
+}
+
+Qnn_ErrorHandle_t stubSystemContextCreate(QnnSystemContext_Handle_t *sysCtxHandle) {
+  if (nullptr == sysCtxHandle) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  *sysCtxHandle = new SystemContext();
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubSystemContextGetBinaryInfo(QnnSystemContext_Handle_t sysCtxHandle,
+                                                 void *binaryBuffer,
+                                                 uint64_t binaryBufferSize,
+                                                 const QnnSystemContext_BinaryInfo_t **binaryInfo,
+                                                 Qnn_ContextBinarySize_t *binaryInfoSize) {
+  if (nullptr == sysCtxHandle || nullptr == binaryInfo) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  auto storage = std::make_unique<BinaryInfoStorage>();
+  if (!stub::parse(binaryBuffer, binaryBufferSize, storage->graphs)) {
+    return QNN_COMMON_ERROR_INCOMPATIBLE_BINARIES;
+  }
+  // 先建好全部张量数组再取指针，之后不再改变 vector 大小
+  for (auto &graph : storage->graphs) {
+    uint32_t numInputs = static_cast<uint32_t>(graph.inputs.size());
+    storage->tensors.push_back(toQnnTensors(graph.inputs, QNN_TENSOR_TYPE_APP_WRITE, 1));
+    storage->tensors.push_back(
+        toQnnTensors(graph.outputs, QNN_TENSOR_TYPE_APP_READ, numInputs + 1));
+  }
+  storage->graphInfos.resize(storage->graphs.size());
+  for (size_t i = 0; i < storage->graphs.size(); i++) {
+    auto &graphInfo   = storage->graphInfos[i];
+    graphInfo.version = QNN_SYSTEM_CONTEXT_GRAPH_INFO_VERSION_1;
+    graphInfo.graphInfoV1.graphName       = storage->graphs[i].name.c_str();
+    graphInfo.graphInfoV1.numGraphInputs  = static_cast<uint32_t>(storage->tensors[2 * i].size());
+    graphInfo.graphInfoV1.graphInputs     = storage->tensors[2 * i].data();
+    graphInfo.graphInfoV1.numGraphOutputs =
+        static_cast<uint32_t>(storage->tensors[2 * i + 1].size());
+    graphInfo.graphInfoV1.graphOutputs = storage->tensors[2 * i + 1].data();
+  }
+  memset(&storage->binaryInfo, 0, sizeof(storage->binaryInfo));
+  storage->binaryInfo.version = QNN_SYSTEM_CONTEXT_BINARY_INFO_VERSION_1;
+  auto &infoV1                = storage->binaryInfo.contextBinaryInfoV1;
+  infoV1.numGraphs = static_cast<uint32_t>(storage->graphInfos.size());
+  infoV1.graphs    = storage->graphInfos.data();
+
+  *binaryInfo = &storage->binaryInfo;
+  if (nullptr != binaryInfoSize) {
+    *binaryInfoSize = sizeof(QnnSystemContext_BinaryInfo_t);
+  }
+  static_cast<SystemContext *>(sysCtxHandle)->infos.push_back(std::move(storage));
+  return QNN_SUCCESS;
+}
+
+Qnn_ErrorHandle_t stubSystemContextFree(QnnSystemContext_Handle_t sysCtxHandle) {
+  delete static_cast<SystemContext *>(sysCtxHandle);
+  return QNN_SUCCESS;
+}
+
+QnnSystemInterface_t makeSystemInterface() {
+  QnnSystemInterface_t systemInterface;
+  memset(&systemInterface, 0, sizeof(systemInterface));
+  systemInterface.providerName     = "STUB_QNN_SYSTEM";
+  systemInterface.systemApiVersion = {
+      QNN_SYSTEM_API_VERSION_MAJOR, QNN_SYSTEM_API_VERSION_MINOR, QNN_SYSTEM_API_VERSION_PATCH};
+  auto &impl                      = systemInterface.QNN_SYSTEM_INTERFACE_VER_NAME;
+  impl.systemContextCreate        = stubSystemContextCreate;
+  impl.systemContextGetBinaryInfo = stubSystemContextGetBinaryInfo;
+  impl.systemContextFree          = stubSystemContextFree;
+  return systemInterface;
+}
+
+}  // namespace
+
+extern "C" QNN_API Qnn_ErrorHandle_t QnnSystemInterface_getProviders(
+    const QnnSystemInterface_t ***providerList, uint32_t *numProviders) {
+  if (nullptr == providerList || nullptr == numProviders) {
+    return QNN_COMMON_ERROR_INVALID_ARGUMENT;
+  }
+  static const QnnSystemInterface_t systemInterface = makeSystemInterface();
+  static const QnnSystemInterface_t *providers[]    = {&systemInterface};
+  *providerList = providers;
+  *numProviders = 1;
+  return QNN_SUCCESS;
+}
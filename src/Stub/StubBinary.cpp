@@ -0,0 +1,184 @@
+#include "StubBinary.hpp"
+
+#include <cstring>
+
+using namespace qnn::tools;
+
+namespace {
+
+const char STUB_MAGIC[8] = {'Q', 'N', 'N', 'S', 'T', 'U', 'B', '\0'};
+
+// 每张图/每个张量的数量上限，防止损坏的文件触发超大分配
+constexpr uint32_t MAX_ENTRIES = 1u << 16;
+
+struct DataTypeName {
+  Qnn_DataType_t dataType;
+  const char *name;
+  size_t size;
+};
+
+const DataTypeName DATA_TYPE_NAMES[] = {
+    {QNN_DATATYPE_FLOAT_32, "float32", 4},      {QNN_DATATYPE_FLOAT_16, "float16", 2},
+    {QNN_DATATYPE_INT_8, "int8", 1},            {QNN_DATATYPE_INT_16, "int16", 2},
+    {QNN_DATATYPE_INT_32, "int32", 4},          {QNN_DATATYPE_INT_64, "int64", 8},
+    {QNN_DATATYPE_UINT_8, "uint8", 1},          {QNN_DATATYPE_UINT_16, "uint16", 2},
+    {QNN_DATATYPE_UINT_32, "uint32", 4},        {QNN_DATATYPE_UINT_64, "uint64", 8},
+    {QNN_DATATYPE_UFIXED_POINT_8, "ufixed8", 1}, {QNN_DATATYPE_UFIXED_POINT_16, "ufixed16", 2},
+    {QNN_DATATYPE_SFIXED_POINT_8, "sfixed8", 1}, {QNN_DATATYPE_SFIXED_POINT_16, "sfixed16", 2},
+    {QNN_DATATYPE_BOOL_8, "bool8", 1}};
+
+void putU32(std::vector<uint8_t> &out, uint32_t value) {
+  uint8_t bytes[4];
+  memcpy(bytes, &value, sizeof(bytes));
+  out.insert(out.end(), bytes, bytes + sizeof(bytes));
+}
+
+void putString(std::vector<uint8_t> &out, const std::string &value) {
+  putU32(out, static_cast<uint32_t>(value.size()));
+  out.insert(out.end(), value.begin(), value.end());
+}
+
+void putTensors(std::vector<uint8_t> &out, const std::vector<stub::StubTensorSpec> &tensors) {
+  putU32(out, static_cast<uint32_t>(tensors.size()));
+  for (const auto &tensor : tensors) {
+    putString(out, tensor.name);
+    putU32(out, static_cast<uint32_t>(tensor.dataType));
+    uint32_t scaleBits;
+    memcpy(&scaleBits, &tensor.scale, sizeof(scaleBits));
+    putU32(out, scaleBits);
+    putU32(out, static_cast<uint32_t>(tensor.offset));
+    putU32(out, static_cast<uint32_t>(tensor.dims.size()));
+    for (uint32_t dim : tensor.dims) {
+      putU32(out, dim);
+    }
+  }
+}
+
+class Reader {
+ public:
+  Reader(const uint8_t *data, uint64_t size) : m_data(data), m_size(size) {}
+
+  bool bytes(void *out, uint64_t count) {
+    if (count > m_size - m_pos) {
+      return false;
+    }
+    memcpy(out, m_data + m_pos, count);
+    m_pos += count;
+    return true;
+  }
+
+  bool u32(uint32_t &value) { return bytes(&value, sizeof(value)); }
+
+  bool string(std::string &value) {
+    uint32_t length;
+    if (!u32(length) || length > m_size - m_pos) {
+      return false;
+    }
+    value.assign(reinterpret_cast<const char *>(m_data + m_pos), length);
+    m_pos += length;
+    return true;
+  }
+
+  bool tensors(std::vector<stub::StubTensorSpec> &out) {
+    uint32_t count;
+    if (!u32(count) || count > MAX_ENTRIES) {
+      return false;
+    }
+    out.resize(count);
+    for (auto &tensor : out) {
+      uint32_t dataType, scaleBits, offset, rank;
+      if (!string(tensor.name) || !u32(dataType) || !u32(scaleBits) || !u32(offset) ||
+          !u32(rank) || rank > MAX_ENTRIES) {
+        return false;
+      }
+      tensor.dataType = static_cast<Qnn_DataType_t>(dataType);
+      memcpy(&tensor.scale, &scaleBits, sizeof(scaleBits));
+      tensor.offset = static_cast<int32_t>(offset);
+      tensor.dims.resize(rank);
+      for (auto &dim : tensor.dims) {
+        if (!u32(dim)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+ private:
+  const uint8_t *m_data;
+  uint64_t m_size;
+  uint64_t m_pos = 0;
+};
+
+}  // namespace
+
+std::vector<uint8_t> stub::serialize(const std::vector<StubGraphSpec> &graphs) {
+  std::vector<uint8_t> out(STUB_MAGIC, STUB_MAGIC + sizeof(STUB_MAGIC));
+  putU32(out, STUB_BINARY_VERSION);
+  putU32(out, static_cast<uint32_t>(graphs.size()));
+  for (const auto &graph : graphs) {
+    putString(out, graph.name);
+    putTensors(out, graph.inputs);
+    putTensors(out, graph.outputs);
+  }
+  return out;
+}
+
+bool stub::parse(const void *data, uint64_t size, std::vector<StubGraphSpec> &graphs) {
+  if (nullptr == data) {
+    return false;
+  }
+  Reader reader(static_cast<const uint8_t *>(data), size);
+  char magic[sizeof(STUB_MAGIC)];
+  uint32_t version, count;
+  if (!reader.bytes(magic, sizeof(magic)) || 0 != memcmp(magic, STUB_MAGIC, sizeof(magic)) ||
+      !reader.u32(version) || STUB_BINARY_VERSION != version || !reader.u32(count) ||
+      count > MAX_ENTRIES) {
+    return false;
+  }
+  std::vector<StubGraphSpec> parsed(count);
+  for (auto &graph : parsed) {
+    if (!reader.string(graph.name) || !reader.tensors(graph.inputs) ||
+        !reader.tensors(graph.outputs)) {
+      return false;
+    }
+  }
+  graphs = std::move(parsed);
+  return true;
+}
+
+size_t stub::dataTypeSize(Qnn_DataType_t dataType) {
+  for (const auto &entry : DATA_TYPE_NAMES) {
+    if (entry.dataType == dataType) {
+      return entry.size;
+    }
+  }
+  return 0;
+}
+
+size_t stub::tensorBytes(const StubTensorSpec &tensor) {
+  size_t bytes = dataTypeSize(tensor.dataType);
+  for (uint32_t dim : tensor.dims) {
+    bytes *= dim;
+  }
+  return bytes;
+}
+
+bool stub::dataTypeFromName(const std::string &name, Qnn_DataType_t &dataType) {
+  for (const auto &entry : DATA_TYPE_NAMES) {
+    if (name == entry.name) {
+      dataType = entry.dataType;
+      return true;
+    }
+  }
+  return false;
+}
+
+const char *stub::dataTypeName(Qnn_DataType_t dataType) {
+  for (const auto &entry : DATA_TYPE_NAMES) {
+    if (entry.dataType == dataType) {
+      return entry.name;
+    }
+  }
+  return "unknown";
+}
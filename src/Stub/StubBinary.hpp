@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "QnnTypes.h"
+
+namespace qnn {
+namespace tools {
+namespace stub {
+
+// 桩 backend 的 context binary 只描述图的输入/输出，不含权重。
+// 布局（小端）：魔数 "QNNSTUB\0"、u32 版本、u32 图数量，每张图依次为
+// 名称、u32 输入数、输入张量、u32 输出数、输出张量；
+// 张量为 名称、u32 dataType、f32 scale、i32 offset、u32 rank、u32 dims[rank]。
+// 字符串为 u32 长度加不带结尾 0 的字节。
+constexpr uint32_t STUB_BINARY_VERSION = 1;
+
+struct StubTensorSpec {
+  std::string name;
+  Qnn_DataType_t dataType = QNN_DATATYPE_FLOAT_32;
+  float scale             = 0.0f;  // 仅定点类型使用
+  int32_t offset          = 0;
+  std::vector<uint32_t> dims;
+};
+
+struct StubGraphSpec {
+  std::string name;
+  std::vector<StubTensorSpec> inputs;
+  std::vector<StubTensorSpec> outputs;
+};
+
+std::vector<uint8_t> serialize(const std::vector<StubGraphSpec> &graphs);
+
+// 魔数、版本或长度不符时返回 false
+bool parse(const void *data, uint64_t size, std::vector<StubGraphSpec> &graphs);
+
+// 未知类型返回 0
+size_t dataTypeSize(Qnn_DataType_t dataType);
+
+size_t tensorBytes(const StubTensorSpec &tensor);
+
+// "float32"、"ufixed8" 等名称与 Qnn_DataType_t 互转，未知名称返回 false
+bool dataTypeFromName(const std::string &name, Qnn_DataType_t &dataType);
+
+const char *dataTypeName(Qnn_DataType_t dataType);
+
+}  // namespace stub
+}  // namespace tools
+}  // namespace qnn
@@ -0,0 +1,145 @@
+// qnn-stub-gen：生成桩 backend 可加载的 context binary。
+// 例：qnn-stub-gen --binary echo.bin --graph echo --input in:float32:1x224x224x3
+//                   --output out:float32:1x224x224x3
+// 定点类型可附带量化参数：--input in:ufixed8:1x16:0.0078125:-128
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "PAL/GetOpt.hpp"
+#include "StubBinary.hpp"
+
+using namespace qnn;
+using namespace qnn::tools;
+
+namespace {
+
+void printUsage(const char *program) {
+  printf(
+      "Usage: %s --binary <path> --graph <name> --input <tensor> --output <tensor> ...\n"
+      "\n"
+      "  --binary <path>    context binary to write\n"
+      "  --graph <name>     start a new graph; following --input/--output belong to it\n"
+      "  --input <tensor>   graph input, name:dtype:dims[:scale:offset]\n"
+      "  --output <tensor>  graph output, same format; output i echoes input i\n"
+      "  --help             show this message\n"
+      "\n"
+      "dims are separated by 'x', e.g. 1x3x224x224. dtype is one of float32, float16,\n"
+      "int8, int16, int32, int64, uint8, uint16, uint32, uint64, ufixed8, ufixed16,\n"
+      "sfixed8, sfixed16, bool8.\n",
+      program);
+}
+
+std::vector<std::string> split(const std::string &value, char separator) {
+  std::vector<std::string> parts;
+  std::stringstream stream(value);
+  std::string part;
+  while (std::getline(stream, part, separator)) {
+    parts.push_back(part);
+  }
+  return parts;
+}
+
+bool parseTensor(const std::string &value, stub::StubTensorSpec &tensor) {
+  std::vector<std::string> fields = split(value, ':');
+  if ((fields.size() != 3 && fields.size() != 5) || fields[0].empty() ||
+      !stub::dataTypeFromName(fields[1], tensor.dataType)) {
+    return false;
+  }
+  tensor.name = fields[0];
+  for (const std::string &dim : split(fields[2], 'x')) {
+    char *end           = nullptr;
+    unsigned long parsed = strtoul(dim.c_str(), &end, 10);
+    if (dim.empty() || *end != '\0' || parsed == 0) {
+      return false;
+    }
+    tensor.dims.push_back(static_cast<uint32_t>(parsed));
+  }
+  if (fields.size() == 5) {
+    char *scaleEnd  = nullptr;
+    char *offsetEnd = nullptr;
+    tensor.scale    = strtof(fields[3].c_str(), &scaleEnd);
+    tensor.offset   = static_cast<int32_t>(strtol(fields[4].c_str(), &offsetEnd, 10));
+    if (*scaleEnd != '\0' || *offsetEnd != '\0' || tensor.scale <= 0.0f) {
+      return false;
+    }
+  }
+  return !tensor.dims.empty();
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  enum { OPT_BINARY = 1, OPT_GRAPH, OPT_INPUT, OPT_OUTPUT, OPT_HELP };
+  static const pal::Option longOptions[] = {
+      {"binary", pal::required_argument, nullptr, OPT_BINARY},
+      {"graph", pal::required_argument, nullptr, OPT_GRAPH},
+      {"input", pal::required_argument, nullptr, OPT_INPUT},
+      {"output", pal::required_argument, nullptr, OPT_OUTPUT},
+      {"help", pal::no_argument, nullptr, OPT_HELP},
+      {nullptr, 0, nullptr, 0}};
+
+  std::string binaryPath;
+  std::vector<stub::StubGraphSpec> graphs;
+  int opt;
+  int longIndex = 0;
+  while ((opt = pal::getOptLongOnly(argc, argv, "", longOptions, &longIndex)) != -1) {
+    switch (opt) {
+      case OPT_BINARY:
+        binaryPath = pal::g_optArg;
+        break;
+      case OPT_GRAPH:
+        graphs.emplace_back();
+        graphs.back().name = pal::g_optArg;
+        break;
+      case OPT_INPUT:
+      case OPT_OUTPUT: {
+        stub::StubTensorSpec tensor;
+        if (graphs.empty()) {
+          fprintf(stderr, "--graph must come before --input/--output\n");
+          return EXIT_FAILURE;
+        }
+        if (!parseTensor(pal::g_optArg, tensor)) {
+          fprintf(stderr, "Invalid tensor: %s\n", pal::g_optArg);
+          return EXIT_FAILURE;
+        }
+        (opt == OPT_INPUT ? graphs.back().inputs : graphs.back().outputs)
+            .push_back(std::move(tensor));
+        break;
+      }
+      case OPT_HELP:
+      default:
+        printUsage(argv[0]);
+        return opt == OPT_HELP ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (binaryPath.empty() || graphs.empty()) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  for (const auto &graph : graphs) {
+    if (graph.inputs.empty() || graph.outputs.empty()) {
+      fprintf(stderr, "Graph %s needs at least one input and one output\n", graph.name.c_str());
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::vector<uint8_t> binary = stub::serialize(graphs);
+  std::ofstream out(binaryPath, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(binary.data()),
+            static_cast<std::streamsize>(binary.size()));
+  if (!out) {
+    fprintf(stderr, "Failed to write %s\n", binaryPath.c_str());
+    return EXIT_FAILURE;
+  }
+  for (const auto &graph : graphs) {
+    printf("%s: %zu inputs, %zu outputs\n", graph.name.c_str(), graph.inputs.size(),
+           graph.outputs.size());
+  }
+  printf("Wrote %zu bytes to %s\n", binary.size(), binaryPath.c_str());
+  return EXIT_SUCCESS;
+}
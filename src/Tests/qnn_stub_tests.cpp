@@ -0,0 +1,580 @@
+// 基于桩 backend 的单元测试，只在主机上构建，由 ctest 运行：
+//   qnn-stub-tests <libQnnStub.so 路径>
+// 桩 libQnnSystem.so 必须与 libQnnStub.so 在同一目录。
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ContextCache.hpp"
+#include "GraphInfoIndex.hpp"
+#include "LatencyHistogram.hpp"
+#include "Logger.hpp"
+#include "QnnSampleApp.hpp"
+#include "StubBinary.hpp"
+
+using namespace qnn;
+using namespace qnn::tools;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// 每次执行的模拟设备耗时，让异步执行在提交下一组时仍处于在途状态
+constexpr const char *STUB_LATENCY_US = "2000";
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                             \
+  do {                                                                               \
+    if (!(condition)) {                                                              \
+      fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+      g_failures++;                                                                  \
+    }                                                                                \
+  } while (0)
+
+std::string g_backendPath;
+
+// 每个用例一个独立的临时目录，结束时删除
+class TempDir {
+ public:
+  TempDir() {
+    std::string pattern = (fs::temp_directory_path() / "qnn-stub-tests-XXXXXX").string();
+    std::vector<char> buffer(pattern.begin(), pattern.end());
+    buffer.push_back('\0');
+    if (nullptr != mkdtemp(buffer.data())) {
+      m_path = buffer.data();
+    }
+  }
+
+  ~TempDir() {
+    std::error_code ec;
+    fs::remove_all(m_path, ec);
+  }
+
+  const std::string &path() const { return m_path; }
+
+  std::string file(const std::string &name) const { return (fs::path(m_path) / name).string(); }
+
+ private:
+  std::string m_path;
+};
+
+stub::StubTensorSpec floatTensor(const std::string &name, std::vector<uint32_t> dims) {
+  stub::StubTensorSpec tensor;
+  tensor.name = name;
+  tensor.dims = std::move(dims);
+  return tensor;
+}
+
+// 单输入单输出的回显图，输出等于输入
+stub::StubGraphSpec echoGraph(const std::string &name, uint32_t elements) {
+  stub::StubGraphSpec graph;
+  graph.name = name;
+  graph.inputs.push_back(floatTensor("in", {1, elements}));
+  graph.outputs.push_back(floatTensor("out", {1, elements}));
+  return graph;
+}
+
+bool writeFile(const std::string &path, const std::vector<uint8_t> &data) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+  return static_cast<bool>(out);
+}
+
+bool writeBinary(const std::string &path, const std::vector<stub::StubGraphSpec> &graphs) {
+  return writeFile(path, stub::serialize(graphs));
+}
+
+std::unique_ptr<sample_app::QnnSampleApp> createApp(const std::string &modelPath) {
+  try {
+    return std::make_unique<sample_app::QnnSampleApp>(g_backendPath, modelPath);
+  } catch (const std::exception &e) {
+    fprintf(stderr, "Failed to create instance for %s: %s\n", modelPath.c_str(), e.what());
+    return nullptr;
+  }
+}
+
+// 推理一次并检查输出回显了输入
+bool inferEcho(sample_app::QnnSampleApp &app, int graphIdx, size_t elements, float value) {
+  std::vector<float> input(elements, value);
+  std::vector<float> output(elements, 0.0f);
+  const float *inputs[] = {input.data()};
+  float *outputs[]      = {output.data()};
+  size_t sizes[]        = {elements};
+  if (sample_app::StatusCode::SUCCESS !=
+      app.infer(inputs, sizes, 1, outputs, sizes, 1, graphIdx)) {
+    return false;
+  }
+  return output.front() == value && output.back() == value;
+}
+
+// 桩 backend 能加载桩 context binary 并回显输入
+void testStubEcho() {
+  TempDir dir;
+  std::string binaryPath = dir.file("echo.bin");
+  CHECK(writeBinary(binaryPath, {echoGraph("g", 16), echoGraph("h", 8)}));
+  auto app = createApp(binaryPath);
+  CHECK(app != nullptr);
+  if (!app) {
+    return;
+  }
+  CHECK(app->getGraphCount() == 2);
+  CHECK(app->getGraphIndex("h") == 1);
+  CHECK(inferEcho(*app, 0, 16, 1.5f));
+  CHECK(inferEcho(*app, 1, 8, -2.0f));
+}
+
+void testLatencyHistogram() {
+  metrics::LatencyHistogram histogram;
+  // 1..1000 微秒各一次
+  for (uint64_t us = 1; us <= 1000; us++) {
+    histogram.record(us * 1000);
+  }
+  metrics::LatencySummary summary = histogram.summarize();
+  CHECK(summary.count == 1000);
+  CHECK(std::fabs(summary.meanUs - 500.5) < 0.01);
+  CHECK(summary.maxUs == 1000.0);
+  // 分位数按桶上界报告，相对误差不超过 1/32
+  CHECK(summary.p50Us >= 500.0 && summary.p50Us <= 500.0 * (1.0 + 1.0 / 32));
+  CHECK(summary.p90Us >= 900.0 && summary.p90Us <= 900.0 * (1.0 + 1.0 / 32));
+  CHECK(summary.p99Us >= 990.0 && summary.p99Us <= 990.0 * (1.0 + 1.0 / 32));
+
+  // 64ns 以下精确计数
+  metrics::LatencyHistogram small;
+  small.record(std::chrono::nanoseconds(7));
+  CHECK(small.summarize().maxUs == 0.007);
+
+  // 读取并清零后不再计入旧记录
+  summary = histogram.summarize(true);
+  CHECK(summary.count == 1000);
+  summary = histogram.summarize();
+  CHECK(summary.count == 0);
+  CHECK(summary.maxUs == 0.0);
+
+  // 并发记录不丢计数
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&histogram] {
+      for (int i = 0; i < 10000; i++) {
+        histogram.record(static_cast<uint64_t>(1000 + i));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  CHECK(histogram.summarize().count == 40000);
+}
+
+// 实例的延迟直方图与计数随执行累计，读取时可以清零
+void testInstanceMetrics() {
+  TempDir dir;
+  std::string binaryPath = dir.file("echo.bin");
+  CHECK(writeBinary(binaryPath, {echoGraph("g", 32)}));
+  auto app = createApp(binaryPath);
+  CHECK(app != nullptr);
+  if (!app) {
+    return;
+  }
+  sample_app::Metrics metrics;
+  app->getMetrics(metrics, true);
+  CHECK(inferEcho(*app, 0, 32, 4.5f));
+  app->getMetrics(metrics, true);
+  CHECK(metrics.executions == 1);
+  CHECK(metrics.infer.count == 1);
+  CHECK(metrics.execute.count == 1);
+  CHECK(metrics.bytesConverted == 2 * 32 * sizeof(float));
+  app->getMetrics(metrics);
+  CHECK(metrics.executions == 0);
+}
+
+// 编译缓存的 key、staging 提交、淘汰与清理
+void testContextCache() {
+  TempDir dir;
+  CHECK(!dir.path().empty());
+
+  // key 只取决于模型内容和 fingerprint
+  std::string modelPath = dir.file("model.so");
+  CHECK(writeFile(modelPath, {1, 2, 3, 4}));
+  std::string key = contextcache::ContextCache::computeKey(modelPath, "htp-v73");
+  CHECK(key.size() == 16);
+  CHECK(key == contextcache::ContextCache::computeKey(modelPath, "htp-v73"));
+  CHECK(key != contextcache::ContextCache::computeKey(modelPath, "htp-v75"));
+  CHECK(contextcache::ContextCache::computeKey(dir.file("missing.so"), "htp-v73").empty());
+
+  contextcache::Config config;
+  config.dir      = (fs::path(dir.path()) / "cache").string();
+  config.maxBytes = 150;
+  contextcache::ContextCache cache(config);
+  CHECK(cache.enabled());
+  CHECK(cache.prepare());
+  CHECK(cache.lookup("aaaa").empty());
+
+  // 写入先落到 staging 文件，commit 之前不算命中
+  std::string staging = cache.stagingPath("aaaa");
+  CHECK(staging != cache.stagingPath("aaaa"));
+  CHECK(writeFile(staging, std::vector<uint8_t>(100, 0xaa)));
+  CHECK(cache.lookup("aaaa").empty());
+  CHECK(cache.commit(staging, "aaaa"));
+  CHECK(!fs::exists(staging));
+  CHECK(cache.lookup("aaaa") == cache.pathFor("aaaa"));
+
+  // 丢弃的 staging 文件不再留下
+  std::string discarded = cache.stagingPath("cccc");
+  CHECK(writeFile(discarded, std::vector<uint8_t>(10, 0xcc)));
+  cache.discardStaging(discarded);
+  CHECK(!fs::exists(discarded));
+
+  // 超出上限时淘汰其它条目，keepKey 和写入中的 staging 文件保留
+  std::string inFlight = cache.stagingPath("dddd");
+  CHECK(writeFile(inFlight, std::vector<uint8_t>(500, 0xdd)));
+  std::string second = cache.stagingPath("bbbb");
+  CHECK(writeFile(second, std::vector<uint8_t>(100, 0xbb)));
+  CHECK(cache.commit(second, "bbbb"));
+  cache.evict("bbbb");
+  CHECK(cache.lookup("aaaa").empty());
+  CHECK(!cache.lookup("bbbb").empty());
+  CHECK(fs::exists(inFlight));
+
+  // 只清理足够旧的 staging 文件
+  std::string stale = cache.stagingPath("eeee");
+  CHECK(writeFile(stale, std::vector<uint8_t>(10, 0xee)));
+  fs::last_write_time(stale, fs::file_time_type::clock::now() -
+                                 contextcache::STALE_STAGING_AGE - std::chrono::minutes(1));
+  cache.sweepStaleStaging();
+  CHECK(!fs::exists(stale));
+  CHECK(fs::exists(inFlight));
+
+  cache.invalidate("bbbb");
+  CHECK(cache.lookup("bbbb").empty());
+}
+
+// 图元数据 sidecar 首次加载时写出，之后命中，binary 改变后失效
+void testGraphInfoSidecar() {
+  TempDir dir;
+  std::string binaryPath = dir.file("echo.bin");
+  CHECK(writeBinary(binaryPath, {echoGraph("g", 16), echoGraph("h", 8)}));
+  std::string sidecar = graphindex::GraphInfoIndex::sidecarPath(binaryPath);
+  CHECK(!fs::exists(sidecar));
+
+  // 第一次加载解析 binary info 并写出 sidecar
+  auto first = createApp(binaryPath);
+  CHECK(first != nullptr);
+  if (!first) {
+    return;
+  }
+  CHECK(!first->getBinaryLoadStats().metadataFromSidecar);
+  CHECK(fs::exists(sidecar));
+  // 临时文件改名为 sidecar 后不留下其它文件
+  CHECK(std::distance(fs::directory_iterator(dir.path()), fs::directory_iterator()) == 2);
+  first.reset();
+
+  // 第二次命中 sidecar，图信息与 binary 一致
+  auto second = createApp(binaryPath);
+  CHECK(second != nullptr);
+  if (!second) {
+    return;
+  }
+  CHECK(second->getBinaryLoadStats().metadataFromSidecar);
+  CHECK(second->getGraphCount() == 2);
+  CHECK(second->getGraphIndex("h") == 1);
+  CHECK(std::string(second->getGraphName(0)) == "g");
+  CHECK(second->getNumInputTensors(1) == 1);
+  sample_app::TensorView view;
+  CHECK(sample_app::StatusCode::SUCCESS == second->getInputTensorView(0, view, 1));
+  CHECK(view.rank == 2 && view.dims[1] == 8);
+  CHECK(inferEcho(*second, 0, 16, 1.25f));
+  CHECK(inferEcho(*second, 1, 8, -3.0f));
+  second.reset();
+
+  // binary 改变后 sidecar 校验失败，回退到解析 binary info
+  CHECK(writeBinary(binaryPath, {echoGraph("g", 32)}));
+  auto third = createApp(binaryPath);
+  CHECK(third != nullptr);
+  if (third) {
+    CHECK(!third->getBinaryLoadStats().metadataFromSidecar);
+    CHECK(third->getGraphCount() == 1);
+    CHECK(inferEcho(*third, 0, 32, 4.5f));
+  }
+}
+
+// 张量组环的占用上限，以及各组数据互相独立
+void testTensorRing() {
+  TempDir dir;
+  std::string binaryPath = dir.file("echo.bin");
+  CHECK(writeBinary(binaryPath, {echoGraph("g", 16)}));
+  auto app = createApp(binaryPath);
+  CHECK(app != nullptr);
+  if (!app) {
+    return;
+  }
+
+  // 环大小为 2 时第三次 acquire 失败，有组被占用时不能改环大小
+  CHECK(sample_app::StatusCode::SUCCESS == app->setTensorRingSize(2));
+  uint32_t first = 0, second = 0, third = 0;
+  CHECK(sample_app::StatusCode::SUCCESS == app->acquireTensorSet(0, first));
+  CHECK(sample_app::StatusCode::SUCCESS == app->acquireTensorSet(0, second));
+  CHECK(first != second);
+  CHECK(sample_app::StatusCode::SUCCESS != app->acquireTensorSet(0, third));
+  CHECK(sample_app::StatusCode::SUCCESS != app->setTensorRingSize(3));
+
+  // 不同组的数据互相独立
+  std::vector<float> inputA(16, 1.0f), inputB(16, 2.0f), output(16, 0.0f);
+  const float *inputsA[] = {inputA.data()};
+  const float *inputsB[] = {inputB.data()};
+  float *outputs[]       = {output.data()};
+  size_t sizes[]         = {16};
+  CHECK(sample_app::StatusCode::SUCCESS == app->loadFloatInputsToSet(0, first, inputsA, sizes, 1));
+  CHECK(sample_app::StatusCode::SUCCESS == app->loadFloatInputsToSet(0, second, inputsB, sizes, 1));
+  CHECK(sample_app::StatusCode::SUCCESS == app->submitTensorSet(0, second));
+  CHECK(sample_app::StatusCode::SUCCESS ==
+        app->getFloatOutputsFromSet(0, second, outputs, sizes, 1));
+  CHECK(output[0] == 2.0f);
+
+  CHECK(sample_app::StatusCode::SUCCESS == app->releaseTensorSet(0, first));
+  CHECK(sample_app::StatusCode::SUCCESS == app->releaseTensorSet(0, second));
+  CHECK(sample_app::StatusCode::SUCCESS == app->setTensorRingSize(3));
+}
+
+// 异步执行的在途上限：超出时立即返回 BUSY，完成后可以重试
+void testAsyncInFlightLimit() {
+  TempDir dir;
+  std::string binaryPath = dir.file("echo.bin");
+  CHECK(writeBinary(binaryPath, {echoGraph("g", 16)}));
+  auto app = createApp(binaryPath);
+  CHECK(app != nullptr);
+  if (!app) {
+    return;
+  }
+
+  uint32_t first = 0, second = 0;
+  CHECK(sample_app::StatusCode::SUCCESS == app->acquireTensorSet(0, first));
+  CHECK(sample_app::StatusCode::SUCCESS == app->acquireTensorSet(0, second));
+  std::vector<float> inputA(16, 1.0f), inputB(16, 2.0f), output(16, 0.0f);
+  const float *inputsA[] = {inputA.data()};
+  const float *inputsB[] = {inputB.data()};
+  float *outputs[]       = {output.data()};
+  size_t sizes[]         = {16};
+  CHECK(sample_app::StatusCode::SUCCESS == app->loadFloatInputsToSet(0, first, inputsA, sizes, 1));
+  CHECK(sample_app::StatusCode::SUCCESS == app->loadFloatInputsToSet(0, second, inputsB, sizes, 1));
+
+  // 在途上限为 1：第一组执行期间提交第二组立即返回 BUSY，组保持 ACQUIRED，回调不会被调用
+  CHECK(app->supportsAsyncExecution());
+  CHECK(sample_app::StatusCode::SUCCESS == app->setMaxInFlight(1));
+  std::mutex mutex;
+  std::condition_variable cv;
+  int completed = 0;
+  std::vector<sample_app::StatusCode> statuses;
+  auto onDone = [&](sample_app::StatusCode status) {
+    std::lock_guard<std::mutex> lock(mutex);
+    statuses.push_back(status);
+    completed++;
+    cv.notify_all();
+  };
+  CHECK(sample_app::StatusCode::SUCCESS == app->submitTensorSetAsync(0, first, onDone));
+  CHECK(sample_app::StatusCode::BUSY == app->submitTensorSetAsync(0, second, onDone));
+  app->waitForAsyncExecutions();
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait_for(lock, std::chrono::seconds(5), [&] { return completed == 1; });
+    CHECK(completed == 1);
+    CHECK(statuses.size() == 1 && statuses[0] == sample_app::StatusCode::SUCCESS);
+  }
+  CHECK(sample_app::StatusCode::SUCCESS ==
+        app->getFloatOutputsFromSet(0, first, outputs, sizes, 1));
+  CHECK(output[0] == 1.0f);
+
+  // 上一次执行完成后，BUSY 的组可以重试
+  CHECK(sample_app::StatusCode::SUCCESS == app->submitTensorSetAsync(0, second, onDone));
+  app->waitForAsyncExecutions();
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait_for(lock, std::chrono::seconds(5), [&] { return completed == 2; });
+    CHECK(completed == 2);
+  }
+  CHECK(sample_app::StatusCode::SUCCESS ==
+        app->getFloatOutputsFromSet(0, second, outputs, sizes, 1));
+  CHECK(output[0] == 2.0f);
+
+  CHECK(sample_app::StatusCode::SUCCESS == app->releaseTensorSet(0, first));
+  CHECK(sample_app::StatusCode::SUCCESS == app->releaseTensorSet(0, second));
+}
+
+
+// 切换模型：占用时拒绝，失败时保留原模型，与并发执行交错
+void testSwapModel() {
+  TempDir dir;
+  std::string pathA = dir.file("a.bin");
+  std::string pathB = dir.file("b.bin");
+  CHECK(writeBinary(pathA, {echoGraph("g", 16)}));
+  CHECK(writeBinary(pathB, {echoGraph("g", 16), echoGraph("h", 8)}));
+  auto app = createApp(pathA);
+  CHECK(app != nullptr);
+  if (!app) {
+    return;
+  }
+
+  // 有组被占用时拒绝切换，且不做任何改动
+  uint32_t setIdx = 0;
+  CHECK(sample_app::StatusCode::SUCCESS == app->acquireTensorSet(0, setIdx));
+  CHECK(sample_app::StatusCode::SUCCESS != app->swapModel(pathB));
+  CHECK(app->getGraphCount() == 1);
+  CHECK(sample_app::StatusCode::SUCCESS == app->releaseTensorSet(0, setIdx));
+
+  CHECK(sample_app::StatusCode::SUCCESS == app->swapModel(pathB));
+  CHECK(app->getGraphCount() == 2);
+  CHECK(inferEcho(*app, 1, 8, 6.0f));
+
+  // 加载失败时保留原模型，图和已分配的张量仍可使用
+  CHECK(writeFile(dir.file("bad.bin"), {0, 1, 2, 3}));
+  CHECK(sample_app::StatusCode::SUCCESS != app->swapModel(dir.file("bad.bin")));
+  CHECK(app->getGraphCount() == 2);
+  CHECK(inferEcho(*app, 1, 8, 7.0f));
+  CHECK(sample_app::StatusCode::SUCCESS == app->swapModel(pathA));
+  CHECK(inferEcho(*app, 0, 16, 1.0f));
+
+  // 并发执行与切换：执行要么在旧图上要么在新图上完成，图 0 在两个模型中都存在，不应失败
+  std::atomic<bool> stop{false};
+  std::atomic<int> good{0};
+  std::atomic<int> bad{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 2; t++) {
+    threads.emplace_back([&, t] {
+      while (!stop) {
+        if (inferEcho(*app, 0, 16, static_cast<float>(t + 1))) {
+          good++;
+        } else {
+          bad++;
+        }
+      }
+    });
+  }
+  // 每次切换前等到至少又完成一次执行，保证执行与切换交错
+  auto waitForProgress = [&good, &bad](int seen) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (good + bad <= seen && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+  };
+  int swaps = 0;
+  for (int i = 0; i < 10; i++) {
+    waitForProgress(good + bad);
+    swaps += sample_app::StatusCode::SUCCESS == app->swapModel(i % 2 ? pathA : pathB) ? 1 : 0;
+  }
+  waitForProgress(good + bad);
+  stop = true;
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  CHECK(swaps == 10);
+  CHECK(bad == 0);
+  CHECK(good > 0);
+}
+
+// 地址是否落在 memfd 映射内，用来确认张量确实分配在共享内存上
+bool inMemfdMapping(const void *address) {
+  std::ifstream maps("/proc/self/maps");
+  std::string line;
+  auto value = reinterpret_cast<uintptr_t>(address);
+  while (std::getline(maps, line)) {
+    unsigned long long start = 0, end = 0;
+    if (sscanf(line.c_str(), "%llx-%llx", &start, &end) == 2 && value >= start &&
+        value < end) {
+      return line.find("memfd:") != std::string::npos;
+    }
+  }
+  return false;
+}
+
+// memfd 共享内存：张量经 memRegister 注册后由桩 backend 直接访问，infer 与张量组环都能回显
+void testSharedMemoryMemfd() {
+  TempDir dir;
+  std::string binaryPath = dir.file("echo.bin");
+  CHECK(writeBinary(binaryPath, {echoGraph("g", 16)}));
+  auto app = createApp(binaryPath);
+  CHECK(app != nullptr);
+  if (!app) {
+    return;
+  }
+  CHECK(sample_app::StatusCode::SUCCESS ==
+        app->enableSharedMemory(sharedmem::AllocatorType::MEMFD));
+  CHECK(app->isSharedMemoryEnabled());
+
+  CHECK(inferEcho(*app, 0, 16, 3.5f));
+  sample_app::TensorView view;
+  CHECK(sample_app::StatusCode::SUCCESS == app->getInputTensorView(0, view, 0));
+  CHECK(inMemfdMapping(view.data));
+  CHECK(sample_app::StatusCode::SUCCESS == app->getOutputTensorView(0, view, 0));
+  CHECK(inMemfdMapping(view.data));
+
+  uint32_t setIdx = 0;
+  std::vector<float> input(16, -1.5f), output(16, 0.0f);
+  const float *inputs[] = {input.data()};
+  float *outputs[]      = {output.data()};
+  size_t sizes[]        = {16};
+  CHECK(sample_app::StatusCode::SUCCESS == app->acquireTensorSet(0, setIdx));
+  CHECK(sample_app::StatusCode::SUCCESS == app->loadFloatInputsToSet(0, setIdx, inputs, sizes, 1));
+  CHECK(sample_app::StatusCode::SUCCESS == app->submitTensorSet(0, setIdx));
+  CHECK(sample_app::StatusCode::SUCCESS ==
+        app->getFloatOutputsFromSet(0, setIdx, outputs, sizes, 1));
+  CHECK(output.front() == -1.5f && output.back() == -1.5f);
+  CHECK(sample_app::StatusCode::SUCCESS == app->releaseTensorSet(0, setIdx));
+}
+
+struct TestCase {
+  const char *name;
+  std::function<void()> run;
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <path to libQnnStub.so>\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  g_backendPath = argv[1];
+  // 桩 backend 创建时读取，所有用例共用同一个共享 backend
+  setenv("QNN_STUB_LATENCY_US", STUB_LATENCY_US, 0);
+  if (!log::initializeLogging()) {
+    fprintf(stderr, "Unable to initialize logging\n");
+    return EXIT_FAILURE;
+  }
+  log::setLogLevel(QNN_LOG_LEVEL_ERROR);
+
+  const TestCase tests[] = {{"StubEcho", testStubEcho},
+                            {"LatencyHistogram", testLatencyHistogram},
+                            {"InstanceMetrics", testInstanceMetrics},
+                            {"ContextCache", testContextCache},
+                            {"GraphInfoSidecar", testGraphInfoSidecar},
+                            {"TensorRing", testTensorRing},
+                            {"AsyncInFlightLimit", testAsyncInFlightLimit},
+                            {"SwapModel", testSwapModel},
+                            {"SharedMemoryMemfd", testSharedMemoryMemfd}};
+  int failedTests = 0;
+  for (const auto &test : tests) {
+    int before = g_failures;
+    test.run();
+    bool passed = g_failures == before;
+    printf("[%s] %s\n", passed ? "PASS" : "FAIL", test.name);
+    failedTests += passed ? 0 : 1;
+  }
+  printf("%d of %zu tests failed\n", failedTests, sizeof(tests) / sizeof(tests[0]));
+  return failedTests == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,184 @@
+#include "ContextCache.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+#include "GraphInfoIndex.hpp"
+#include "Logger.hpp"
+
+using namespace qnn::tools;
+
+namespace fs = std::filesystem;
+
+static constexpr uint64_t FNV_PRIME     = 1099511628211ULL;
+static constexpr size_t HASH_CHUNK_SIZE = 1 << 20;
+static const char *CACHE_SUFFIX         = ".bin";
+static const char *STAGING_SUFFIX       = ".staging";
+
+uint64_t contextcache::fnv1a(uint64_t hash, const uint8_t *data, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+std::string contextcache::ContextCache::computeKey(const std::string &modelPath,
+                                                   const std::string &fingerprint) {
+  std::ifstream in(modelPath, std::ios::in | std::ios::binary);
+  if (!in.is_open()) {
+    QNN_ERROR("Failed to open model %s for hashing", modelPath.c_str());
+    return "";
+  }
+  uint64_t hash = FNV_OFFSET_BASIS;
+  std::vector<char> chunk(HASH_CHUNK_SIZE);
+  while (in) {
+    in.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    hash = fnv1a(hash, reinterpret_cast<const uint8_t *>(chunk.data()),
+                 static_cast<size_t>(in.gcount()));
+  }
+  hash = fnv1a(hash, reinterpret_cast<const uint8_t *>(fingerprint.data()), fingerprint.size());
+  char key[17];
+  snprintf(key, sizeof(key), "%016" PRIx64, hash);
+  return key;
+}
+
+std::string contextcache::ContextCache::pathFor(const std::string &key) const {
+  return (fs::path(m_config.dir) / (key + CACHE_SUFFIX)).string();
+}
+
+std::string contextcache::ContextCache::lookup(const std::string &key) const {
+  if (!enabled() || key.empty()) {
+    return "";
+  }
+  std::error_code ec;
+  std::string path = pathFor(key);
+  if (!fs::is_regular_file(path, ec) || fs::file_size(path, ec) == 0) {
+    return "";
+  }
+  // 刷新修改时间，作为 LRU 的最近使用时间。
+  // 有图元数据 sidecar 时刷新 sidecar，binary 的修改时间是 sidecar 的校验项，不能改动
+  std::string sidecar = graphindex::GraphInfoIndex::sidecarPath(path);
+  fs::last_write_time(fs::exists(sidecar, ec) ? sidecar : path,
+                      fs::file_time_type::clock::now(),
+                      ec);
+  return path;
+}
+
+void contextcache::ContextCache::invalidate(const std::string &key) const {
+  if (!enabled() || key.empty()) {
+    return;
+  }
+  std::error_code ec;
+  fs::remove(graphindex::GraphInfoIndex::sidecarPath(pathFor(key)), ec);
+  if (fs::remove(pathFor(key), ec)) {
+    QNN_WARN("Removed invalid cached context %s", key.c_str());
+  }
+}
+
+std::string contextcache::ContextCache::stagingPath(const std::string &key) const {
+  static std::atomic<uint64_t> sequence{0};
+  std::string name = key + "." + std::to_string(getpid()) + "-" +
+                     std::to_string(sequence.fetch_add(1)) + STAGING_SUFFIX;
+  return (fs::path(m_config.dir) / name).string();
+}
+
+bool contextcache::ContextCache::commit(const std::string &stagingPath,
+                                        const std::string &key) const {
+  std::error_code ec;
+  fs::rename(stagingPath, pathFor(key), ec);
+  if (ec) {
+    QNN_ERROR("Failed to commit cached context %s: %s", key.c_str(), ec.message().c_str());
+    fs::remove(stagingPath, ec);
+    return false;
+  }
+  return true;
+}
+
+void contextcache::ContextCache::discardStaging(const std::string &stagingPath) const {
+  std::error_code ec;
+  fs::remove(stagingPath, ec);
+}
+
+void contextcache::ContextCache::sweepStaleStaging() const {
+  if (!enabled()) {
+    return;
+  }
+  std::error_code ec;
+  auto staleBefore = fs::file_time_type::clock::now() - STALE_STAGING_AGE;
+  for (const auto &item : fs::directory_iterator(m_config.dir, ec)) {
+    if (!item.is_regular_file(ec) || item.path().extension() != STAGING_SUFFIX ||
+        item.last_write_time(ec) >= staleBefore) {
+      continue;
+    }
+    if (fs::remove(item.path(), ec)) {
+      QNN_INFO("Removed stale cache staging file %s",
+               item.path().filename().string().c_str());
+    }
+  }
+}
+
+bool contextcache::ContextCache::prepare() const {
+  std::error_code ec;
+  fs::create_directories(m_config.dir, ec);
+  if (ec) {
+    QNN_ERROR("Failed to create context cache dir %s: %s",
+              m_config.dir.c_str(),
+              ec.message().c_str());
+    return false;
+  }
+  return true;
+}
+
+void contextcache::ContextCache::evict(const std::string &keepKey) const {
+  if (!enabled()) {
+    return;
+  }
+  struct Entry {
+    fs::path path;
+    uint64_t size;
+    fs::file_time_type mtime;
+  };
+  std::vector<Entry> entries;
+  uint64_t total = 0;
+  std::error_code ec;
+  for (const auto &item : fs::directory_iterator(m_config.dir, ec)) {
+    if (!item.is_regular_file(ec) || item.path().extension() != CACHE_SUFFIX) {
+      continue;
+    }
+    Entry entry{item.path(), static_cast<uint64_t>(item.file_size(ec)), item.last_write_time(ec)};
+    fs::path sidecar = graphindex::GraphInfoIndex::sidecarPath(item.path().string());
+    if (fs::exists(sidecar, ec)) {
+      entry.size += static_cast<uint64_t>(fs::file_size(sidecar, ec));
+      entry.mtime = std::max(entry.mtime, fs::last_write_time(sidecar, ec));
+    }
+    total += entry.size;
+    if (item.path().stem() != keepKey) {
+      entries.push_back(entry);
+    }
+  }
+  if (total <= m_config.maxBytes) {
+    return;
+  }
+  std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+    return a.mtime < b.mtime;
+  });
+  for (const auto &entry : entries) {
+    if (total <= m_config.maxBytes) {
+      break;
+    }
+    fs::remove(graphindex::GraphInfoIndex::sidecarPath(entry.path.string()), ec);
+    if (fs::remove(entry.path, ec)) {
+      total -= entry.size;
+      QNN_INFO("Evicted cached context %s", entry.path.filename().string().c_str());
+    }
+  }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace qnn {
+namespace tools {
+namespace contextcache {
+
+// 默认缓存目录总大小上限
+constexpr uint64_t DEFAULT_MAX_CACHE_BYTES = 2ULL * 1024 * 1024 * 1024;
+
+// 超过该时长未修改的临时文件视为崩溃遗留
+constexpr std::chrono::minutes STALE_STAGING_AGE{60};
+
+// FNV-1a 64 位哈希，可分段累加：hash 传上一段的结果，首段传 FNV_OFFSET_BASIS
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+uint64_t fnv1a(uint64_t hash, const uint8_t *data, size_t size);
+
+struct Config {
+  std::string dir;  // 为空表示不启用缓存
+  uint64_t maxBytes = DEFAULT_MAX_CACHE_BYTES;
+};
+
+// .so 模型编译后 context binary 的磁盘缓存。
+// 以 "<key>.bin" 存放在缓存目录中，按文件修改时间做 LRU 淘汰（命中时会刷新修改时间，
+// 有图元数据 sidecar 时刷新 sidecar 的修改时间）。
+// 写入中的文件以 ".staging" 结尾，淘汰时不计入也不会删除。
+class ContextCache {
+ public:
+  explicit ContextCache(Config config) : m_config(std::move(config)) {}
+
+  bool enabled() const { return !m_config.dir.empty(); }
+
+  const std::string &dir() const { return m_config.dir; }
+
+  // 对模型文件内容和影响编译结果的各项参数做 FNV-1a 64 位哈希，返回 16 位十六进制串；
+  // 模型文件无法读取时返回空串
+  static std::string computeKey(const std::string &modelPath, const std::string &fingerprint);
+
+  // 命中时返回缓存文件路径并刷新其修改时间，否则返回空串
+  std::string lookup(const std::string &key) const;
+
+  // 缓存文件损坏或加载失败时删除
+  void invalidate(const std::string &key) const;
+
+  // 创建缓存目录（如不存在）
+  bool prepare() const;
+
+  // 删除最久未使用的缓存文件，直到总大小不超过 maxBytes；keepKey 对应的文件不会被删除
+  void evict(const std::string &keepKey) const;
+
+  std::string pathFor(const std::string &key) const;
+
+  // 写入时先落到临时文件，完成后再 commit 改名，避免中途崩溃留下半个文件被当作命中。
+  // 文件名带进程号和序号，多个实例/进程同时写同一个 key 时互不覆盖
+  std::string stagingPath(const std::string &key) const;
+
+  // 成功或失败都不再留下 stagingPath
+  bool commit(const std::string &stagingPath, const std::string &key) const;
+
+  void discardStaging(const std::string &stagingPath) const;
+
+  // 删除崩溃遗留的临时文件；只删修改时间早于 STALE_STAGING_AGE 的，不影响其他进程正在写的文件
+  void sweepStaleStaging() const;
+
+ private:
+  Config m_config;
+};
+
+}  // namespace contextcache
+}  // namespace tools
+}  // namespace qnn
@@ -54,6 +54,34 @@ std::tuple<datautil::StatusCode, size_t> datautil::calculateLength(std::vector<s
   return std::make_tuple(StatusCode::SUCCESS, length);
 }
 
+size_t datautil::calculateElementCount(const uint32_t* dims, uint32_t rank) {
+  if (nullptr == dims || rank == 0) {
+    return 0;
+  }
+  size_t count = 1;
+  for (uint32_t r = 0; r < rank; r++) {
+    count *= dims[r];
+  }
+  return count;
+}
+
+std::tuple<datautil::StatusCode, size_t> datautil::calculateLength(const uint32_t* dims,
+                                                                   uint32_t rank,
+                                                                   Qnn_DataType_t dataType) {
+  if (nullptr == dims || rank == 0) {
+    QNN_ERROR("rank is zero");
+    return std::make_tuple(StatusCode::INVALID_DIMENSIONS, 0);
+  }
+  StatusCode returnStatus{StatusCode::SUCCESS};
+  size_t length{0};
+  std::tie(returnStatus, length) = getDataTypeSizeInBytes(dataType);
+  if (StatusCode::SUCCESS != returnStatus) {
+    return std::make_tuple(returnStatus, 0);
+  }
+  length *= calculateElementCount(dims, rank);
+  return std::make_tuple(StatusCode::SUCCESS, length);
+}
+
 datautil::StatusCode datautil::readDataFromFile(std::string filePath,
                                                 std::vector<size_t> dims,
                                                 Qnn_DataType_t dataType,
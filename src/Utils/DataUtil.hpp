@@ -38,6 +38,13 @@ std::tuple<StatusCode, size_t> calculateLength(std::vector<size_t> dims, Qnn_Dat
 
 size_t calculateElementCount(std::vector<size_t> dims);
 
+// 直接按张量的 uint32_t 维度数组计算，不构造 vector，供每次推理都会调用的路径使用
+size_t calculateElementCount(const uint32_t* dims, uint32_t rank);
+
+std::tuple<StatusCode, size_t> calculateLength(const uint32_t* dims,
+                                               uint32_t rank,
+                                               Qnn_DataType_t dataType);
+
 std::tuple<StatusCode, size_t> getFileSize(std::string filePath);
 
 StatusCode readDataFromFile(std::string filePath,
@@ -29,6 +29,10 @@ StatusCode getQnnFunctionPointers(std::string backendPath,
                                   void** backendHandle,
                                   bool loadModelLib,
                                   void** modelHandleRtn);
+// 只加载 [model].so 并解析 composeGraphs/freeGraphsInfo，backend 由调用者另行加载
+StatusCode getModelFunctionPointers(std::string modelPath,
+                                    sample_app::QnnFunctionPointers* qnnFunctionPointers,
+                                    void** modelHandleRtn);
 StatusCode getQnnSystemFunctionPointers(std::string systemLibraryPath,
                                         sample_app::QnnFunctionPointers* qnnFunctionPointers);
 }  // namespace dynamicloadutil
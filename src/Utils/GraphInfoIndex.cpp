@@ -0,0 +1,337 @@
+#include "GraphInfoIndex.hpp"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "ContextCache.hpp"
+#include "Logger.hpp"
+#include "QnnTypeMacros.hpp"
+
+using namespace qnn;
+using namespace qnn::tools;
+
+// 格式变化时递增，旧 sidecar 直接失效
+static constexpr uint32_t INDEX_VERSION    = 1;
+static constexpr char INDEX_MAGIC[8]       = {'Q', 'N', 'N', 'G', 'I', 'D', 'X', '\0'};
+static constexpr uint64_t NO_OFFSET        = UINT64_MAX;
+static constexpr uint64_t HASH_SAMPLE_SIZE = 64 * 1024;
+static const char *SIDECAR_SUFFIX          = ".graphinfo";
+
+namespace {
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t headerSize;
+  uint64_t binarySize;
+  int64_t binaryMtimeNs;
+  uint64_t binaryHash;
+  uint32_t graphsCount;
+  uint32_t tensorsCount;
+  uint64_t dataSize;
+};
+
+struct GraphRecord {
+  uint64_t nameOffset;
+  uint32_t firstInput;
+  uint32_t numInputs;
+  uint32_t firstOutput;
+  uint32_t numOutputs;
+};
+
+struct TensorRecord {
+  uint32_t version;
+  uint32_t id;
+  uint32_t type;
+  uint32_t dataFormat;
+  uint32_t dataType;
+  uint32_t rank;
+  int32_t encodingDefinition;
+  int32_t quantizationEncoding;
+  float scale;
+  int32_t offset;
+  int32_t axis;
+  uint32_t numScaleOffsets;
+  uint64_t nameOffset;
+  uint64_t dimsOffset;
+  uint64_t dynamicDimsOffset;
+  uint64_t scaleOffsetsOffset;
+};
+
+// 只对 binary 首尾各采样一段做哈希，配合大小和修改时间校验，不为校验读完整个文件
+uint64_t sampleHash(const uint8_t *data, uint64_t size) {
+  uint64_t head = size < HASH_SAMPLE_SIZE ? size : HASH_SAMPLE_SIZE;
+  uint64_t hash = contextcache::fnv1a(contextcache::FNV_OFFSET_BASIS, data, head);
+  if (size > head) {
+    uint64_t tail = size - head < HASH_SAMPLE_SIZE ? size - head : HASH_SAMPLE_SIZE;
+    hash          = contextcache::fnv1a(hash, data + size - tail, tail);
+  }
+  return hash;
+}
+
+bool fileMtimeNs(const std::string &path, int64_t &mtimeNs) {
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) {
+    return false;
+  }
+  mtimeNs = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+  return true;
+}
+
+// 数据区追加，按 align 对齐，返回偏移
+uint64_t append(std::vector<uint8_t> &data, const void *src, size_t size, size_t align) {
+  if (src == nullptr) {
+    return NO_OFFSET;
+  }
+  data.resize((data.size() + align - 1) / align * align);
+  uint64_t offset = data.size();
+  data.insert(data.end(),
+              static_cast<const uint8_t *>(src),
+              static_cast<const uint8_t *>(src) + size);
+  return offset;
+}
+
+TensorRecord makeRecord(const Qnn_Tensor_t &tensor, std::vector<uint8_t> &data) {
+  TensorRecord record{};
+  record.version    = static_cast<uint32_t>(tensor.version);
+  record.id         = QNN_TENSOR_GET_ID(tensor);
+  record.type       = static_cast<uint32_t>(QNN_TENSOR_GET_TYPE(tensor));
+  record.dataFormat = static_cast<uint32_t>(QNN_TENSOR_GET_DATA_FORMAT(tensor));
+  record.dataType   = static_cast<uint32_t>(QNN_TENSOR_GET_DATA_TYPE(tensor));
+  record.rank       = QNN_TENSOR_GET_RANK(tensor);
+
+  const char *name  = QNN_TENSOR_GET_NAME(tensor);
+  record.nameOffset = append(data, name, name ? strlen(name) + 1 : 0, 1);
+  record.dimsOffset =
+      append(data, QNN_TENSOR_GET_DIMENSIONS(tensor), record.rank * sizeof(uint32_t), 4);
+  record.dynamicDimsOffset =
+      append(data, QNN_TENSOR_GET_IS_DYNAMIC_DIMENSIONS(tensor), record.rank * sizeof(uint8_t), 1);
+
+  Qnn_QuantizeParams_t quant  = QNN_TENSOR_GET_QUANT_PARAMS(tensor);
+  record.encodingDefinition   = static_cast<int32_t>(quant.encodingDefinition);
+  record.quantizationEncoding = static_cast<int32_t>(quant.quantizationEncoding);
+  record.scaleOffsetsOffset   = NO_OFFSET;
+  if (quant.quantizationEncoding == QNN_QUANTIZATION_ENCODING_SCALE_OFFSET) {
+    record.scale  = quant.scaleOffsetEncoding.scale;
+    record.offset = quant.scaleOffsetEncoding.offset;
+  } else if (quant.quantizationEncoding == QNN_QUANTIZATION_ENCODING_AXIS_SCALE_OFFSET) {
+    record.axis            = quant.axisScaleOffsetEncoding.axis;
+    record.numScaleOffsets = quant.axisScaleOffsetEncoding.numScaleOffsets;
+    record.scaleOffsetsOffset =
+        append(data,
+               quant.axisScaleOffsetEncoding.scaleOffset,
+               record.numScaleOffsets * sizeof(Qnn_ScaleOffset_t),
+               alignof(Qnn_ScaleOffset_t));
+  }
+  return record;
+}
+
+}  // namespace
+
+std::string graphindex::GraphInfoIndex::sidecarPath(const std::string &binaryPath) {
+  return binaryPath + SIDECAR_SUFFIX;
+}
+
+bool graphindex::GraphInfoIndex::write(const std::string &binaryPath,
+                                       const uint8_t *binaryData,
+                                       uint64_t binarySize,
+                                       qnn_wrapper_api::GraphInfo_t **graphsInfo,
+                                       uint32_t graphsCount) {
+  Header header{};
+  if (graphsInfo == nullptr || !fileMtimeNs(binaryPath, header.binaryMtimeNs)) {
+    return false;
+  }
+  std::vector<GraphRecord> graphs;
+  std::vector<TensorRecord> tensors;
+  std::vector<uint8_t> data;
+  for (uint32_t g = 0; g < graphsCount; g++) {
+    const auto &graphInfo = (*graphsInfo)[g];
+    GraphRecord graph{};
+    graph.nameOffset = append(data,
+                              graphInfo.graphName,
+                              graphInfo.graphName ? strlen(graphInfo.graphName) + 1 : 0,
+                              1);
+    graph.firstInput = static_cast<uint32_t>(tensors.size());
+    graph.numInputs  = graphInfo.numInputTensors;
+    for (uint32_t i = 0; i < graphInfo.numInputTensors; i++) {
+      tensors.push_back(makeRecord(graphInfo.inputTensors[i], data));
+    }
+    graph.firstOutput = static_cast<uint32_t>(tensors.size());
+    graph.numOutputs  = graphInfo.numOutputTensors;
+    for (uint32_t i = 0; i < graphInfo.numOutputTensors; i++) {
+      tensors.push_back(makeRecord(graphInfo.outputTensors[i], data));
+    }
+    graphs.push_back(graph);
+  }
+
+  memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+  header.version      = INDEX_VERSION;
+  header.headerSize   = sizeof(Header);
+  header.binarySize   = binarySize;
+  header.binaryHash   = sampleHash(binaryData, binarySize);
+  header.graphsCount  = graphsCount;
+  header.tensorsCount = static_cast<uint32_t>(tensors.size());
+  header.dataSize     = data.size();
+
+  // 先写临时文件再改名，避免并发加载读到写了一半的索引。临时文件名与 ContextCache::stagingPath
+  // 一样带进程号和序号，多个进程同时写同一个 sidecar 时互不覆盖；位于缓存目录时也会被过期清理
+  static std::atomic<uint64_t> sequence{0};
+  std::string path    = sidecarPath(binaryPath);
+  std::string tmpPath = path + "." + std::to_string(getpid()) + "-" +
+                        std::to_string(sequence.fetch_add(1)) + ".staging";
+  {
+    std::ofstream out(tmpPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+      QNN_DEBUG("Cannot write graph info index %s", path.c_str());
+      return false;
+    }
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(graphs.data()), graphs.size() * sizeof(GraphRecord));
+    out.write(reinterpret_cast<const char *>(tensors.data()),
+              tensors.size() * sizeof(TensorRecord));
+    out.write(reinterpret_cast<const char *>(data.data()), data.size());
+    if (!out.good()) {
+      out.close();
+      std::remove(tmpPath.c_str());
+      return false;
+    }
+  }
+  if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+    std::remove(tmpPath.c_str());
+    return false;
+  }
+  QNN_DEBUG("Wrote graph info index %s", path.c_str());
+  return true;
+}
+
+std::unique_ptr<graphindex::GraphInfoIndex> graphindex::GraphInfoIndex::load(
+    const std::string &binaryPath, const uint8_t *binaryData, uint64_t binarySize) {
+  std::ifstream in(sidecarPath(binaryPath), std::ios::in | std::ios::binary | std::ios::ate);
+  if (!in.is_open()) {
+    return nullptr;
+  }
+  std::unique_ptr<GraphInfoIndex> index(new GraphInfoIndex());
+  auto fileSize = static_cast<uint64_t>(in.tellg());
+  if (fileSize < sizeof(Header)) {
+    return nullptr;
+  }
+  index->m_data.resize(fileSize);
+  in.seekg(0);
+  if (!in.read(reinterpret_cast<char *>(index->m_data.data()), fileSize)) {
+    return nullptr;
+  }
+
+  Header header;
+  memcpy(&header, index->m_data.data(), sizeof(header));
+  int64_t mtimeNs = 0;
+  if (memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 ||
+      header.version != INDEX_VERSION || header.headerSize != sizeof(Header) ||
+      header.binarySize != binarySize || !fileMtimeNs(binaryPath, mtimeNs) ||
+      header.binaryMtimeNs != mtimeNs) {
+    QNN_DEBUG("Graph info index for %s is stale", binaryPath.c_str());
+    return nullptr;
+  }
+  uint64_t recordsSize = static_cast<uint64_t>(header.graphsCount) * sizeof(GraphRecord) +
+                         static_cast<uint64_t>(header.tensorsCount) * sizeof(TensorRecord);
+  if (sizeof(Header) + recordsSize + header.dataSize != fileSize ||
+      header.binaryHash != sampleHash(binaryData, binarySize)) {
+    QNN_DEBUG("Graph info index for %s does not match the binary", binaryPath.c_str());
+    return nullptr;
+  }
+
+  const uint8_t *base = index->m_data.data();
+  auto *graphRecords  = reinterpret_cast<const GraphRecord *>(base + sizeof(Header));
+  auto *tensorRecords = reinterpret_cast<const TensorRecord *>(
+      base + sizeof(Header) + header.graphsCount * sizeof(GraphRecord));
+  uint8_t *data = index->m_data.data() + sizeof(Header) + recordsSize;
+
+  // 偏移越界或字符串未结束都视为损坏
+  auto at = [&](uint64_t offset, uint64_t size) -> uint8_t * {
+    if (offset == NO_OFFSET || offset > header.dataSize || size > header.dataSize - offset) {
+      return nullptr;
+    }
+    return data + offset;
+  };
+  bool valid = true;
+  auto string = [&](uint64_t offset) -> char * {
+    if (offset == NO_OFFSET) {
+      return nullptr;
+    }
+    uint8_t *str = at(offset, 1);
+    if (str == nullptr || memchr(str, '\0', header.dataSize - offset) == nullptr) {
+      valid = false;
+      return nullptr;
+    }
+    return reinterpret_cast<char *>(str);
+  };
+
+  index->m_tensors.resize(header.tensorsCount);
+  for (uint32_t t = 0; t < header.tensorsCount && valid; t++) {
+    const TensorRecord &record = tensorRecords[t];
+    Qnn_Tensor_t &tensor       = index->m_tensors[t];
+    tensor                     = QNN_TENSOR_INIT;
+    tensor.version             = static_cast<Qnn_TensorVersion_t>(record.version);
+    QNN_TENSOR_SET_NAME(tensor, string(record.nameOffset));
+    QNN_TENSOR_SET_ID(tensor, record.id);
+    QNN_TENSOR_SET_TYPE(tensor, static_cast<Qnn_TensorType_t>(record.type));
+    QNN_TENSOR_SET_DATA_FORMAT(tensor, static_cast<Qnn_TensorDataFormat_t>(record.dataFormat));
+    QNN_TENSOR_SET_DATA_TYPE(tensor, static_cast<Qnn_DataType_t>(record.dataType));
+    QNN_TENSOR_SET_RANK(tensor, record.rank);
+    if (record.dimsOffset != NO_OFFSET) {
+      auto *dims = at(record.dimsOffset, record.rank * sizeof(uint32_t));
+      valid      = valid && dims != nullptr;
+      QNN_TENSOR_SET_DIMENSIONS(tensor, reinterpret_cast<uint32_t *>(dims));
+    }
+    if (record.dynamicDimsOffset != NO_OFFSET) {
+      auto *dynamicDims = at(record.dynamicDimsOffset, record.rank * sizeof(uint8_t));
+      valid             = valid && dynamicDims != nullptr;
+      QNN_TENSOR_SET_IS_DYNAMIC_DIMENSIONS(tensor, dynamicDims);
+    }
+    Qnn_QuantizeParams_t quant = QNN_QUANTIZE_PARAMS_INIT;
+    quant.encodingDefinition   = static_cast<Qnn_Definition_t>(record.encodingDefinition);
+    quant.quantizationEncoding = static_cast<Qnn_QuantizationEncoding_t>(record.quantizationEncoding);
+    if (quant.quantizationEncoding == QNN_QUANTIZATION_ENCODING_SCALE_OFFSET) {
+      quant.scaleOffsetEncoding.scale  = record.scale;
+      quant.scaleOffsetEncoding.offset = record.offset;
+    } else if (quant.quantizationEncoding == QNN_QUANTIZATION_ENCODING_AXIS_SCALE_OFFSET) {
+      quant.axisScaleOffsetEncoding.axis            = record.axis;
+      quant.axisScaleOffsetEncoding.numScaleOffsets = record.numScaleOffsets;
+      if (record.scaleOffsetsOffset != NO_OFFSET) {
+        auto *scaleOffsets =
+            at(record.scaleOffsetsOffset, record.numScaleOffsets * sizeof(Qnn_ScaleOffset_t));
+        valid = valid && scaleOffsets != nullptr;
+        quant.axisScaleOffsetEncoding.scaleOffset =
+            reinterpret_cast<Qnn_ScaleOffset_t *>(scaleOffsets);
+      }
+    }
+    QNN_TENSOR_SET_QUANT_PARAMS(tensor, quant);
+  }
+
+  index->m_graphs.resize(header.graphsCount);
+  for (uint32_t g = 0; g < header.graphsCount && valid; g++) {
+    const GraphRecord &record = graphRecords[g];
+    if (static_cast<uint64_t>(record.firstInput) + record.numInputs > header.tensorsCount ||
+        static_cast<uint64_t>(record.firstOutput) + record.numOutputs > header.tensorsCount) {
+      valid = false;
+      break;
+    }
+    auto &graph            = index->m_graphs[g];
+    graph.graph            = nullptr;
+    graph.graphName        = string(record.nameOffset);
+    graph.inputTensors     = index->m_tensors.data() + record.firstInput;
+    graph.numInputTensors  = record.numInputs;
+    graph.outputTensors    = index->m_tensors.data() + record.firstOutput;
+    graph.numOutputTensors = record.numOutputs;
+    index->m_graphPtrs.push_back(&graph);
+  }
+  if (!valid) {
+    QNN_WARN("Graph info index for %s is corrupt", binaryPath.c_str());
+    return nullptr;
+  }
+  return index;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "QnnWrapperUtils.hpp"
+
+namespace qnn {
+namespace tools {
+namespace graphindex {
+
+// context binary 的图元数据索引（sidecar 文件 "<binary>.graphinfo"）。
+// 保存每张图的名称和输入/输出张量信息，用 binary 的大小、修改时间和首尾采样哈希校验。
+// 命中时不再创建 system context 解析 binary info，也不再为每个名称/维度/量化参数单独 malloc：
+// 字符串与数组都指向一次读入的只读数据块，GraphInfo_t 和 Qnn_Tensor_t 放在各自的连续数组里。
+class GraphInfoIndex {
+ public:
+  // 校验失败、版本不符或文件不存在时返回 nullptr
+  static std::unique_ptr<GraphInfoIndex> load(const std::string &binaryPath,
+                                              const uint8_t *binaryData,
+                                              uint64_t binarySize);
+
+  // 把已解析出的图信息写到 binary 旁边；写入失败（例如只读目录）只返回 false
+  static bool write(const std::string &binaryPath,
+                    const uint8_t *binaryData,
+                    uint64_t binarySize,
+                    qnn_wrapper_api::GraphInfo_t **graphsInfo,
+                    uint32_t graphsCount);
+
+  static std::string sidecarPath(const std::string &binaryPath);
+
+  GraphInfoIndex(const GraphInfoIndex &) = delete;
+  GraphInfoIndex &operator=(const GraphInfoIndex &) = delete;
+
+  // 与 copyMetadataToGraphsInfo 的输出形状相同，生命周期由本对象管理，不能传给 freeGraphsInfo
+  qnn_wrapper_api::GraphInfo_t **graphsInfo() { return m_graphPtrs.data(); }
+
+  uint32_t graphsCount() const { return static_cast<uint32_t>(m_graphs.size()); }
+
+ private:
+  GraphInfoIndex() = default;
+
+  std::vector<uint8_t> m_data;  // sidecar 文件内容，名称/维度/量化参数直接指向这里
+  std::vector<qnn_wrapper_api::GraphInfo_t> m_graphs;
+  std::vector<qnn_wrapper_api::GraphInfo_t *> m_graphPtrs;
+  std::vector<Qnn_Tensor_t> m_tensors;
+};
+
+}  // namespace graphindex
+}  // namespace tools
+}  // namespace qnn
@@ -21,6 +21,7 @@
 #endif
 #include "PAL/StringOp.hpp"
 #include "QnnTypeMacros.hpp"
+#include "Tracer.hpp"
 
 using namespace qnn;
 using namespace qnn::tools;
@@ -63,14 +64,15 @@ iotensor::PopulateInputTensorsRetType_t iotensor::IOTensor::readDataAndAllocateB
 // it to a tensor (Qnn_Tensor_t) buffer.
 iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffer,
                                                                Qnn_Tensor_t* tensor) {
+  tracing::TraceSpan span("quantize", "io");
   if (nullptr == floatBuffer || nullptr == tensor) {
     QNN_ERROR("copyFromFloatToNative(): received a nullptr");
     return StatusCode::FAILURE;
   }
 
   StatusCode returnStatus = StatusCode::SUCCESS;
-  std::vector<size_t> dims;
-  fillDims(dims, QNN_TENSOR_GET_DIMENSIONS(tensor), QNN_TENSOR_GET_RANK(tensor));
+  size_t elementCount =
+      datautil::calculateElementCount(QNN_TENSOR_GET_DIMENSIONS(tensor), QNN_TENSOR_GET_RANK(tensor));
 
   switch (QNN_TENSOR_GET_DATA_TYPE(tensor)) {
     case QNN_DATATYPE_UFIXED_POINT_8:
@@ -78,7 +80,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
                                     floatBuffer,
                                     QNN_TENSOR_GET_QUANT_PARAMS(tensor).scaleOffsetEncoding.offset,
                                     QNN_TENSOR_GET_QUANT_PARAMS(tensor).scaleOffsetEncoding.scale,
-                                    datautil::calculateElementCount(dims));
+                                    elementCount);
       break;
 
     case QNN_DATATYPE_UFIXED_POINT_16:
@@ -86,7 +88,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
                                      floatBuffer,
                                      QNN_TENSOR_GET_QUANT_PARAMS(tensor).scaleOffsetEncoding.offset,
                                      QNN_TENSOR_GET_QUANT_PARAMS(tensor).scaleOffsetEncoding.scale,
-                                     datautil::calculateElementCount(dims));
+                                     elementCount);
       break;
 
     case QNN_DATATYPE_UINT_8:
@@ -94,7 +96,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<uint8_t>(
               static_cast<uint8_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<uint8_t>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -105,7 +107,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<uint16_t>(
               static_cast<uint16_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<uint16_t>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -116,7 +118,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<uint32_t>(
               static_cast<uint32_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<uint32_t>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -127,7 +129,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<uint64_t>(
               static_cast<uint64_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<uint64_t>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -138,7 +140,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<int8_t>(
               static_cast<int8_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<int8_t>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -149,7 +151,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<int16_t>(
               static_cast<int16_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<int16_t>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -160,7 +162,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<int32_t>(
               static_cast<int32_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<int32_t>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -171,7 +173,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<int64_t>(
               static_cast<int64_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<int64_t>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -182,7 +184,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<uint8_t>(
               static_cast<uint8_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<bool>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -193,7 +195,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
           datautil::castFromFloat<__fp16>(
               static_cast<__fp16*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               floatBuffer,
-              datautil::calculateElementCount(dims))) {
+              elementCount)) {
         QNN_ERROR("failure in castFromFloat<__fp16>");
         returnStatus = StatusCode::FAILURE;
       }
@@ -202,7 +204,7 @@ iotensor::StatusCode iotensor::IOTensor::copyFromFloatToNative(float* floatBuffe
     case QNN_DATATYPE_FLOAT_32:
       memcpy(static_cast<float*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
              floatBuffer,
-             datautil::calculateElementCount(dims) * sizeof(float));
+             elementCount * sizeof(float));
       break;
 
     default:
@@ -570,20 +572,41 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     QNN_ERROR("tensors is nullptr");
     return StatusCode::FAILURE;
   }
-  std::vector<size_t> dims;
-  fillDims(dims, QNN_TENSOR_GET_DIMENSIONS(tensor), QNN_TENSOR_GET_RANK(tensor));
   auto returnStatus   = StatusCode::SUCCESS;
-  size_t elementCount = datautil::calculateElementCount(dims);
+  size_t elementCount =
+      datautil::calculateElementCount(QNN_TENSOR_GET_DIMENSIONS(tensor), QNN_TENSOR_GET_RANK(tensor));
   returnStatus        = allocateBuffer<float>(out, elementCount);
   if (StatusCode::SUCCESS != returnStatus) {
     QNN_ERROR("failure in allocateBuffer<float>");
     return returnStatus;
   }
+  returnStatus = copyFromNativeToFloat(*out, tensor);
+  if (StatusCode::SUCCESS != returnStatus) {
+    QNN_DEBUG("freeing *out");
+    if (*out != nullptr) {
+      free(*out);
+      *out = nullptr;
+    }
+  }
+  return returnStatus;
+}
+
+// Convert data to float or de-quantize it into a caller-provided
+// buffer, which must hold at least the tensor's element count.
+iotensor::StatusCode iotensor::IOTensor::copyFromNativeToFloat(float* out, Qnn_Tensor_t* tensor) {
+  tracing::TraceSpan span("dequantize", "io");
+  if (nullptr == out || nullptr == tensor) {
+    QNN_ERROR("copyFromNativeToFloat(): received a nullptr");
+    return StatusCode::FAILURE;
+  }
+  auto returnStatus   = StatusCode::SUCCESS;
+  size_t elementCount =
+      datautil::calculateElementCount(QNN_TENSOR_GET_DIMENSIONS(tensor), QNN_TENSOR_GET_RANK(tensor));
   switch (QNN_TENSOR_GET_DATA_TYPE(tensor)) {
     case QNN_DATATYPE_FLOAT_16:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<__fp16>(
-              *out,
+              out,
               reinterpret_cast<__fp16*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<float16>");
@@ -592,14 +615,14 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
       break;
     
     case QNN_DATATYPE_FLOAT_32:
-      memcpy(*out, reinterpret_cast<float*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data), elementCount * sizeof(float));
+      memcpy(out, reinterpret_cast<float*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data), elementCount * sizeof(float));
       break;
     
 
     case QNN_DATATYPE_UFIXED_POINT_8:
       if (datautil::StatusCode::SUCCESS !=
           datautil::tfNToFloat<uint8_t>(
-              *out,
+              out,
               reinterpret_cast<uint8_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               QNN_TENSOR_GET_QUANT_PARAMS(tensor).scaleOffsetEncoding.offset,
               QNN_TENSOR_GET_QUANT_PARAMS(tensor).scaleOffsetEncoding.scale,
@@ -612,7 +635,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_UFIXED_POINT_16:
       if (datautil::StatusCode::SUCCESS !=
           datautil::tfNToFloat<uint16_t>(
-              *out,
+              out,
               reinterpret_cast<uint16_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               QNN_TENSOR_GET_QUANT_PARAMS(tensor).scaleOffsetEncoding.offset,
               QNN_TENSOR_GET_QUANT_PARAMS(tensor).scaleOffsetEncoding.scale,
@@ -625,7 +648,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_UINT_8:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<uint8_t>(
-              *out,
+              out,
               reinterpret_cast<uint8_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<uint8_t>");
@@ -636,7 +659,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_UINT_16:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<uint16_t>(
-              *out,
+              out,
               reinterpret_cast<uint16_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<uint16_t>");
@@ -647,7 +670,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_UINT_32:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<uint32_t>(
-              *out,
+              out,
               reinterpret_cast<uint32_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<uint32_t>");
@@ -658,7 +681,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_UINT_64:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<uint64_t>(
-              *out,
+              out,
               reinterpret_cast<uint64_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<uint64_t>");
@@ -669,7 +692,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_INT_8:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<int8_t>(
-              *out,
+              out,
               reinterpret_cast<int8_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<int8_t>");
@@ -680,7 +703,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_INT_16:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<int16_t>(
-              *out,
+              out,
               reinterpret_cast<int16_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<int16_t>");
@@ -691,7 +714,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_INT_32:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<int32_t>(
-              *out,
+              out,
               reinterpret_cast<int32_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<int32_t>");
@@ -702,7 +725,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_INT_64:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<int64_t>(
-              *out,
+              out,
               reinterpret_cast<int64_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<int64_t>");
@@ -713,7 +736,7 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
     case QNN_DATATYPE_BOOL_8:
       if (datautil::StatusCode::SUCCESS !=
           datautil::castToFloat<uint8_t>(
-              *out,
+              out,
               reinterpret_cast<uint8_t*>(QNN_TENSOR_GET_CLIENT_BUF(tensor).data),
               elementCount)) {
         QNN_ERROR("failure in castToFloat<bool>");
@@ -726,13 +749,6 @@ iotensor::StatusCode iotensor::IOTensor::convertToFloat(float** out, Qnn_Tensor_
       returnStatus = StatusCode::FAILURE;
       break;
   }
-  if (StatusCode::SUCCESS != returnStatus) {
-    QNN_DEBUG("freeing *out");
-    if (*out != nullptr) {
-      free(*out);
-      *out = nullptr;
-    }
-  }
   return returnStatus;
 }
 
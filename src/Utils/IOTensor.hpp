@@ -91,6 +91,8 @@ class IOTensor {
 #ifndef __hexagon__
   StatusCode convertToFloat(float **out, Qnn_Tensor_t *output);
 
+  StatusCode copyFromNativeToFloat(float *out, Qnn_Tensor_t *output);
+
   StatusCode convertAndWriteOutputTensorInFloat(Qnn_Tensor_t *output,
                                                 std::vector<std::string> outputPaths,
                                                 std::string fileName,
@@ -0,0 +1,77 @@
+#include "LatencyHistogram.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace qnn::tools;
+
+uint32_t metrics::LatencyHistogram::bucketIndex(uint64_t valueNs) {
+  if (valueNs < 2 * SUB_BUCKET_COUNT) {
+    return static_cast<uint32_t>(valueNs);
+  }
+  uint32_t msb = 63 - static_cast<uint32_t>(__builtin_clzll(valueNs));
+  if (msb >= MAX_VALUE_BITS) {
+    return BUCKET_COUNT - 1;
+  }
+  uint32_t shift = msb - SUB_BUCKET_BITS;
+  return shift * SUB_BUCKET_COUNT + static_cast<uint32_t>(valueNs >> shift);
+}
+
+uint64_t metrics::LatencyHistogram::bucketUpperBound(uint32_t index) {
+  if (index < 2 * SUB_BUCKET_COUNT) {
+    return index;
+  }
+  uint32_t shift = index / SUB_BUCKET_COUNT - 1;
+  uint64_t top   = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+  return (top << shift) + (uint64_t{1} << shift) - 1;
+}
+
+void metrics::LatencyHistogram::record(uint64_t valueNs) {
+  m_buckets[bucketIndex(valueNs)].fetch_add(1, std::memory_order_relaxed);
+  m_sumNs.fetch_add(valueNs, std::memory_order_relaxed);
+  uint64_t currentMax = m_maxNs.load(std::memory_order_relaxed);
+  while (valueNs > currentMax &&
+         !m_maxNs.compare_exchange_weak(currentMax, valueNs, std::memory_order_relaxed)) {
+  }
+}
+
+metrics::LatencySummary metrics::LatencyHistogram::summarize(bool reset) {
+  std::vector<uint64_t> counts(BUCKET_COUNT);
+  uint64_t total = 0;
+  for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+    counts[i] = reset ? m_buckets[i].exchange(0, std::memory_order_relaxed)
+                      : m_buckets[i].load(std::memory_order_relaxed);
+    total += counts[i];
+  }
+  uint64_t sumNs = reset ? m_sumNs.exchange(0, std::memory_order_relaxed)
+                         : m_sumNs.load(std::memory_order_relaxed);
+  uint64_t maxNs = reset ? m_maxNs.exchange(0, std::memory_order_relaxed)
+                         : m_maxNs.load(std::memory_order_relaxed);
+
+  LatencySummary summary;
+  summary.count = total;
+  if (total == 0) {
+    return summary;
+  }
+  summary.meanUs = static_cast<double>(sumNs) / total / 1000.0;
+  summary.maxUs  = static_cast<double>(maxNs) / 1000.0;
+
+  const double quantiles[] = {0.50, 0.90, 0.99};
+  double *outputs[]        = {&summary.p50Us, &summary.p90Us, &summary.p99Us};
+  uint64_t cumulative      = 0;
+  size_t next              = 0;
+  for (uint32_t i = 0; i < BUCKET_COUNT && next < 3; i++) {
+    cumulative += counts[i];
+    while (next < 3 &&
+           cumulative >= static_cast<uint64_t>(std::ceil(quantiles[next] * total))) {
+      // 桶上界可能超过实际最大值，以最大值为准
+      uint64_t valueNs = bucketUpperBound(i);
+      if (maxNs > 0 && valueNs > maxNs) {
+        valueNs = maxNs;
+      }
+      *outputs[next] = static_cast<double>(valueNs) / 1000.0;
+      next++;
+    }
+  }
+  return summary;
+}
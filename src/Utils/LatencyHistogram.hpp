@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace qnn {
+namespace tools {
+namespace metrics {
+
+// 分位数汇总，单位微秒
+struct LatencySummary {
+  uint64_t count = 0;
+  double meanUs  = 0.0;
+  double p50Us   = 0.0;
+  double p90Us   = 0.0;
+  double p99Us   = 0.0;
+  double maxUs   = 0.0;
+};
+
+// HDR 风格的对数-线性直方图，记录纳秒耗时：小于 64ns 精确计数，
+// 之后每个 2 的幂区间再分 32 个子桶，相对误差不超过 1/32，最大约 18 分钟，超出的计入最后一个桶。
+// record 只做 relaxed 原子加，可在任意线程并发调用；
+// summarize 读取的是近似一致的快照，与并发 record 之间不保证原子性。
+class LatencyHistogram {
+ public:
+  static constexpr uint32_t SUB_BUCKET_BITS  = 5;
+  static constexpr uint32_t SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+  static constexpr uint32_t MAX_VALUE_BITS   = 40;
+  static constexpr uint32_t BUCKET_COUNT =
+      (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+  void record(uint64_t valueNs);
+
+  void record(std::chrono::steady_clock::duration duration) {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    record(static_cast<uint64_t>(ns > 0 ? ns : 0));
+  }
+
+  // reset 为 true 时读取的同时清零，清零前到达的记录不会丢失也不会重复计数
+  LatencySummary summarize(bool reset = false);
+
+ private:
+  static uint32_t bucketIndex(uint64_t valueNs);
+
+  // 桶内最大值，分位数按保守值报告
+  static uint64_t bucketUpperBound(uint32_t index);
+
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_buckets{};
+  std::atomic<uint64_t> m_sumNs{0};
+  std::atomic<uint64_t> m_maxNs{0};
+};
+
+}  // namespace metrics
+}  // namespace tools
+}  // namespace qnn
@@ -0,0 +1,67 @@
+#include "MappedFile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "Logger.hpp"
+
+using namespace qnn::tools;
+
+bool datautil::MappedFile::map(const std::string &path) {
+  unmap();
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    QNN_ERROR("Failed to open %s: %s", path.c_str(), strerror(errno));
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    QNN_ERROR("Failed to stat %s or file is empty", path.c_str());
+    close(fd);
+    return false;
+  }
+  size_t size = static_cast<size_t>(st.st_size);
+  void *data  = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  // 映射建立后 fd 不再需要
+  close(fd);
+  if (data == MAP_FAILED) {
+    QNN_WARN("mmap of %s failed: %s", path.c_str(), strerror(errno));
+    return false;
+  }
+  if (madvise(data, size, MADV_SEQUENTIAL) != 0 || madvise(data, size, MADV_WILLNEED) != 0) {
+    QNN_DEBUG("madvise on %s failed: %s", path.c_str(), strerror(errno));
+  }
+  m_data = static_cast<uint8_t *>(data);
+  m_size = size;
+  return true;
+}
+
+void datautil::MappedFile::unmap() {
+  if (m_data != nullptr) {
+    munmap(m_data, m_size);
+    m_data = nullptr;
+    m_size = 0;
+  }
+}
+
+uint64_t datautil::readPeakRssKb() {
+  FILE *file = fopen("/proc/self/status", "r");
+  if (file == nullptr) {
+    return 0;
+  }
+  char line[256];
+  unsigned long long peakKb = 0;
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    if (sscanf(line, "VmHWM: %llu kB", &peakKb) == 1) {
+      break;
+    }
+  }
+  fclose(file);
+  return peakKb;
+}
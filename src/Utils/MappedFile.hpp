@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace qnn {
+namespace tools {
+namespace datautil {
+
+// 只读文件的内存映射，用于大体积的 context binary：
+// 不在堆上复制整个文件，按需缺页读入，unmap 后页面立即可回收。
+// 映射为 MAP_PRIVATE + 可写，API 即使写入缓冲区也只会产生私有的写时复制页，不会改动文件。
+class MappedFile {
+ public:
+  MappedFile() = default;
+
+  ~MappedFile() { unmap(); }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  // 映射整个文件并提示内核顺序读取、提前预读；失败返回 false
+  bool map(const std::string &path);
+
+  void unmap();
+
+  uint8_t *data() const { return m_data; }
+
+  size_t size() const { return m_size; }
+
+ private:
+  uint8_t *m_data = nullptr;
+  size_t m_size   = 0;
+};
+
+// 读取 /proc/self/status 中的 VmHWM（进程峰值常驻内存，KB），失败返回 0
+uint64_t readPeakRssKb();
+
+}  // namespace datautil
+}  // namespace tools
+}  // namespace qnn
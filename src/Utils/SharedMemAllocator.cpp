@@ -0,0 +1,248 @@
+#include "SharedMemAllocator.hpp"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include "Logger.hpp"
+#include "PAL/DynamicLoading.hpp"
+#include "QnnTypeMacros.hpp"
+
+using namespace qnn::tools;
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+
+// rpcmem 接口，来自 Hexagon SDK 的 rpcmem.h
+static constexpr int RPCMEM_HEAP_ID_SYSTEM    = 25;
+static constexpr uint32_t RPCMEM_DEFAULT_FLAGS = 1;
+typedef void *(*RpcMemAllocFn_t)(int heapId, uint32_t flags, int size);
+typedef void (*RpcMemFreeFn_t)(void *po);
+typedef int (*RpcMemToFdFn_t)(void *po);
+
+namespace {
+
+class RpcMemAllocator : public sharedmem::SharedMemAllocator {
+ public:
+  ~RpcMemAllocator() override {
+    if (m_libHandle != nullptr) {
+      pal::dynamicloading::dlClose(m_libHandle);
+    }
+  }
+
+  bool load() {
+    m_libHandle = pal::dynamicloading::dlOpen(
+        "libcdsprpc.so", pal::dynamicloading::DL_NOW | pal::dynamicloading::DL_LOCAL);
+    if (m_libHandle == nullptr) {
+      QNN_DEBUG("libcdsprpc.so not available, rpcmem allocator disabled");
+      return false;
+    }
+    m_alloc = reinterpret_cast<RpcMemAllocFn_t>(
+        pal::dynamicloading::dlSym(m_libHandle, "rpcmem_alloc"));
+    m_free = reinterpret_cast<RpcMemFreeFn_t>(
+        pal::dynamicloading::dlSym(m_libHandle, "rpcmem_free"));
+    m_toFd = reinterpret_cast<RpcMemToFdFn_t>(
+        pal::dynamicloading::dlSym(m_libHandle, "rpcmem_to_fd"));
+    if (m_alloc == nullptr || m_free == nullptr || m_toFd == nullptr) {
+      QNN_WARN("libcdsprpc.so is missing rpcmem symbols");
+      return false;
+    }
+    return true;
+  }
+
+  const char *name() const override { return "rpcmem"; }
+
+  bool allocate(size_t size, sharedmem::SharedBuffer &buffer) override {
+    void *data = m_alloc(RPCMEM_HEAP_ID_SYSTEM, RPCMEM_DEFAULT_FLAGS, static_cast<int>(size));
+    if (data == nullptr) {
+      QNN_ERROR("rpcmem_alloc of %zu bytes failed", size);
+      return false;
+    }
+    int fd = m_toFd(data);
+    if (fd < 0) {
+      QNN_ERROR("rpcmem_to_fd failed");
+      m_free(data);
+      return false;
+    }
+    buffer.data = data;
+    buffer.size = size;
+    buffer.fd   = fd;
+    return true;
+  }
+
+  void release(sharedmem::SharedBuffer &buffer) override {
+    if (buffer.data != nullptr) {
+      m_free(buffer.data);
+    }
+    buffer = sharedmem::SharedBuffer();
+  }
+
+ private:
+  void *m_libHandle        = nullptr;
+  RpcMemAllocFn_t m_alloc  = nullptr;
+  RpcMemFreeFn_t m_free    = nullptr;
+  RpcMemToFdFn_t m_toFd    = nullptr;
+};
+
+class MemfdAllocator : public sharedmem::SharedMemAllocator {
+ public:
+  const char *name() const override { return "memfd"; }
+
+  bool allocate(size_t size, sharedmem::SharedBuffer &buffer) override {
+    // 0 字节无法 mmap，至少映射 1 字节
+    size_t mapSize = size > 0 ? size : 1;
+    int fd = static_cast<int>(syscall(__NR_memfd_create, "qnn_tensor", MFD_CLOEXEC));
+    if (fd < 0) {
+      QNN_ERROR("memfd_create failed: %s", strerror(errno));
+      return false;
+    }
+    if (ftruncate(fd, static_cast<off_t>(mapSize)) != 0) {
+      QNN_ERROR("ftruncate of memfd to %zu bytes failed: %s", mapSize, strerror(errno));
+      close(fd);
+      return false;
+    }
+    void *data = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+      QNN_ERROR("mmap of memfd failed: %s", strerror(errno));
+      close(fd);
+      return false;
+    }
+    buffer.data = data;
+    buffer.size = mapSize;
+    buffer.fd   = fd;
+    return true;
+  }
+
+  void release(sharedmem::SharedBuffer &buffer) override {
+    if (buffer.data != nullptr) {
+      munmap(buffer.data, buffer.size);
+    }
+    if (buffer.fd >= 0) {
+      close(buffer.fd);
+    }
+    buffer = sharedmem::SharedBuffer();
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<sharedmem::SharedMemAllocator> sharedmem::createAllocator(AllocatorType type) {
+  if (type == AllocatorType::RPCMEM || type == AllocatorType::AUTO) {
+    std::unique_ptr<RpcMemAllocator> rpcmem(new RpcMemAllocator());
+    if (rpcmem->load()) {
+      return rpcmem;
+    }
+    if (type == AllocatorType::RPCMEM) {
+      QNN_ERROR("rpcmem allocator requested but not available");
+      return nullptr;
+    }
+  }
+  return std::unique_ptr<SharedMemAllocator>(new MemfdAllocator());
+}
+
+sharedmem::TensorBinding::TensorBinding(SharedMemAllocator &allocator,
+                                        const QNN_INTERFACE_VER_TYPE &qnnInterface)
+    : m_allocator(allocator), m_qnnInterface(qnnInterface) {}
+
+std::unique_ptr<sharedmem::TensorBinding> sharedmem::TensorBinding::bind(
+    SharedMemAllocator &allocator,
+    const QNN_INTERFACE_VER_TYPE &qnnInterface,
+    Qnn_ContextHandle_t context,
+    Qnn_Tensor_t *tensors,
+    uint32_t numTensors) {
+  if (tensors == nullptr || nullptr == qnnInterface.memRegister ||
+      nullptr == qnnInterface.memDeRegister) {
+    return nullptr;
+  }
+  std::unique_ptr<TensorBinding> binding(new TensorBinding(allocator, qnnInterface));
+
+  // 先分配并注册全部张量，成功之后才替换 host 端缓冲区
+  for (uint32_t i = 0; i < numTensors; i++) {
+    SharedBuffer buffer;
+    if (!allocator.allocate(QNN_TENSOR_GET_CLIENT_BUF(tensors[i]).dataSize, buffer)) {
+      return nullptr;
+    }
+    binding->m_buffers.push_back(buffer);
+
+    Qnn_MemDescriptor_t descriptor = QNN_MEM_DESCRIPTOR_INIT;
+    descriptor.memShape = {QNN_TENSOR_GET_RANK(tensors[i]),
+                           QNN_TENSOR_GET_DIMENSIONS(tensors[i]),
+                           nullptr};
+    descriptor.dataType     = QNN_TENSOR_GET_DATA_TYPE(tensors[i]);
+    descriptor.memType      = QNN_MEM_TYPE_ION;
+    descriptor.ionInfo.fd   = buffer.fd;
+    Qnn_MemHandle_t memHandle = nullptr;
+    if (QNN_SUCCESS != qnnInterface.memRegister(context, &descriptor, 1, &memHandle)) {
+      QNN_WARN("memRegister failed for tensor %s with %s memory",
+               QNN_TENSOR_GET_NAME(tensors[i]),
+               allocator.name());
+      return nullptr;
+    }
+    binding->m_memHandles.push_back(memHandle);
+  }
+
+  binding->m_hostTensors = tensors;
+  binding->m_execTensors.assign(tensors, tensors + numTensors);
+  for (uint32_t i = 0; i < numTensors; i++) {
+    Qnn_ClientBuffer_t clientBuffer = QNN_TENSOR_GET_CLIENT_BUF(tensors[i]);
+    if (clientBuffer.data != nullptr) {
+      memcpy(binding->m_buffers[i].data, clientBuffer.data, clientBuffer.dataSize);
+      free(clientBuffer.data);
+    }
+    clientBuffer.data = binding->m_buffers[i].data;
+    QNN_TENSOR_SET_CLIENT_BUF(tensors[i], clientBuffer);
+
+    QNN_TENSOR_SET_MEM_TYPE(binding->m_execTensors[i], QNN_TENSORMEMTYPE_MEMHANDLE);
+    QNN_TENSOR_SET_MEM_HANDLE(binding->m_execTensors[i], binding->m_memHandles[i]);
+  }
+  QNN_DEBUG("Bound %u tensors to %s shared memory", numTensors, allocator.name());
+  return binding;
+}
+
+bool sharedmem::TensorBinding::unbindToHeap() {
+  if (m_hostTensors == nullptr) {
+    return true;
+  }
+  std::vector<void *> heapBuffers;
+  for (size_t i = 0; i < m_buffers.size(); i++) {
+    void *heapBuffer = malloc(QNN_TENSOR_GET_CLIENT_BUF(m_hostTensors[i]).dataSize);
+    if (heapBuffer == nullptr) {
+      for (void *allocated : heapBuffers) {
+        free(allocated);
+      }
+      return false;
+    }
+    heapBuffers.push_back(heapBuffer);
+  }
+  for (size_t i = 0; i < m_buffers.size(); i++) {
+    Qnn_ClientBuffer_t clientBuffer = QNN_TENSOR_GET_CLIENT_BUF(m_hostTensors[i]);
+    memcpy(heapBuffers[i], m_buffers[i].data, clientBuffer.dataSize);
+    clientBuffer.data = heapBuffers[i];
+    QNN_TENSOR_SET_CLIENT_BUF(m_hostTensors[i], clientBuffer);
+  }
+  m_hostTensors = nullptr;
+  return true;
+}
+
+sharedmem::TensorBinding::~TensorBinding() {
+  if (!m_memHandles.empty() &&
+      QNN_SUCCESS != m_qnnInterface.memDeRegister(m_memHandles.data(),
+                                                  static_cast<uint32_t>(m_memHandles.size()))) {
+    QNN_ERROR("memDeRegister failed");
+  }
+  if (m_hostTensors != nullptr) {
+    for (size_t i = 0; i < m_buffers.size(); i++) {
+      Qnn_ClientBuffer_t clientBuffer = QNN_TENSOR_GET_CLIENT_BUF(m_hostTensors[i]);
+      clientBuffer.data = nullptr;
+      QNN_TENSOR_SET_CLIENT_BUF(m_hostTensors[i], clientBuffer);
+    }
+  }
+  for (auto &buffer : m_buffers) {
+    m_allocator.release(buffer);
+  }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "QnnInterface.h"
+
+namespace qnn {
+namespace tools {
+namespace sharedmem {
+
+enum class AllocatorType {
+  AUTO,    // 设备上优先 rpcmem，不可用时退回 memfd
+  RPCMEM,  // libcdsprpc.so 的 rpcmem（新系统上由 dmabuf 支撑）
+  MEMFD    // memfd_create + mmap，Linux 上的替身，用于桩 backend 测试
+};
+
+// 一块可以通过 fd 在进程/设备间共享的内存
+struct SharedBuffer {
+  void *data  = nullptr;
+  size_t size = 0;
+  int fd      = -1;
+};
+
+class SharedMemAllocator {
+ public:
+  virtual ~SharedMemAllocator() = default;
+
+  virtual const char *name() const = 0;
+
+  virtual bool allocate(size_t size, SharedBuffer &buffer) = 0;
+
+  virtual void release(SharedBuffer &buffer) = 0;
+};
+
+// 按类型创建分配器，不可用时返回 nullptr
+std::unique_ptr<SharedMemAllocator> createAllocator(AllocatorType type);
+
+// 一组张量在共享内存上的绑定。
+// host 端张量仍为 RAW 类型，clientBuf 指向映射后的共享内存，因此现有的量化/视图代码不变；
+// 执行时改用 memHandle 类型的浅拷贝，backend 直接访问同一块内存，省去每次执行的拷贝。
+class TensorBinding {
+ public:
+  // 任意一步失败都返回 nullptr，且 tensors 保持原样
+  static std::unique_ptr<TensorBinding> bind(SharedMemAllocator &allocator,
+                                             const QNN_INTERFACE_VER_TYPE &qnnInterface,
+                                             Qnn_ContextHandle_t context,
+                                             Qnn_Tensor_t *tensors,
+                                             uint32_t numTensors);
+
+  // 注销并释放共享内存，host 端张量的 clientBuf.data 置空，
+  // 必须在 IOTensor::tearDownInputAndOutputTensors 之前析构
+  ~TensorBinding();
+
+  TensorBinding(const TensorBinding &) = delete;
+  TensorBinding &operator=(const TensorBinding &) = delete;
+
+  // 把 host 端张量搬回新分配的 RAW 缓冲区（内容保留），之后析构不再改动 host 端张量。
+  // 用于一组张量只绑定成功一部分时整组回退；分配失败返回 false，绑定保持不变
+  bool unbindToHeap();
+
+  // 传给 graphExecute 的 memHandle 类型张量
+  Qnn_Tensor_t *execTensors() { return m_execTensors.data(); }
+
+ private:
+  TensorBinding(SharedMemAllocator &allocator, const QNN_INTERFACE_VER_TYPE &qnnInterface);
+
+  SharedMemAllocator &m_allocator;
+  QNN_INTERFACE_VER_TYPE m_qnnInterface;
+  Qnn_Tensor_t *m_hostTensors = nullptr;
+  std::vector<SharedBuffer> m_buffers;
+  std::vector<Qnn_MemHandle_t> m_memHandles;
+  std::vector<Qnn_Tensor_t> m_execTensors;
+};
+
+}  // namespace sharedmem
+}  // namespace tools
+}  // namespace qnn
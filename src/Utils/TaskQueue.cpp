@@ -0,0 +1,95 @@
+#include "TaskQueue.hpp"
+
+#include "Logger.hpp"
+
+using namespace qnn::tools;
+
+// 共享线程池的线程数，create/arch version 这类调用本身并发度很低
+static constexpr size_t SHARED_POOL_THREADS = 2;
+
+taskqueue::TaskQueue::TaskQueue(size_t numThreads) : m_state(std::make_shared<State>()) {
+  if (numThreads == 0) {
+    numThreads = 1;
+  }
+  for (size_t i = 0; i < numThreads; i++) {
+    m_threads.emplace_back(workerLoop, m_state);
+  }
+}
+
+taskqueue::TaskQueue::~TaskQueue() {
+  bool fromWorker = isWorkerThread();
+  {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    if (fromWorker && !m_state->tasks.empty()) {
+      QNN_WARN("TaskQueue destroyed from its own worker, dropping %zu pending tasks",
+               m_state->tasks.size());
+      m_state->tasks.clear();
+    }
+    m_state->stop = true;
+  }
+  m_state->taskCv.notify_all();
+  for (auto &thread : m_threads) {
+    if (thread.get_id() == std::this_thread::get_id()) {
+      thread.detach();
+    } else if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+void taskqueue::TaskQueue::submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->tasks.push_back(std::move(task));
+  }
+  m_state->taskCv.notify_one();
+}
+
+void taskqueue::TaskQueue::drain() {
+  if (isWorkerThread()) {
+    QNN_WARN("TaskQueue::drain() called from a worker thread, ignored");
+    return;
+  }
+  std::unique_lock<std::mutex> lock(m_state->mutex);
+  m_state->idleCv.wait(lock, [this] { return m_state->tasks.empty() && m_state->running == 0; });
+}
+
+bool taskqueue::TaskQueue::isWorkerThread() const {
+  for (auto &thread : m_threads) {
+    if (thread.get_id() == std::this_thread::get_id()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void taskqueue::TaskQueue::workerLoop(std::shared_ptr<State> state) {
+  std::unique_lock<std::mutex> lock(state->mutex);
+  while (true) {
+    state->taskCv.wait(lock, [&state] { return state->stop || !state->tasks.empty(); });
+    if (state->tasks.empty()) {
+      // stop 且队列已空
+      break;
+    }
+    auto task = std::move(state->tasks.front());
+    state->tasks.pop_front();
+    state->running++;
+    lock.unlock();
+    try {
+      task();
+    } catch (...) {
+      QNN_ERROR("Unhandled exception in TaskQueue task");
+    }
+    lock.lock();
+    state->running--;
+    if (state->tasks.empty() && state->running == 0) {
+      state->idleCv.notify_all();
+    }
+  }
+}
+
+taskqueue::TaskQueue &taskqueue::sharedPool() {
+  // 故意不释放，避免进程退出时静态析构顺序导致的问题
+  static TaskQueue *pool = new TaskQueue(SHARED_POOL_THREADS);
+  return *pool;
+}
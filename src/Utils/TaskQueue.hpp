@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace qnn {
+namespace tools {
+namespace taskqueue {
+
+// 常驻线程的任务队列，任务按提交顺序 (FIFO) 取出执行。
+// 单线程时即为串行执行器：同一队列上的任务严格按提交顺序依次完成。
+class TaskQueue {
+ public:
+  explicit TaskQueue(size_t numThreads = 1);
+
+  // 等待已提交的任务全部执行完再退出。
+  // 如果在自身工作线程中析构（例如在回调里销毁实例），则不等待，剩余任务被丢弃。
+  ~TaskQueue();
+
+  TaskQueue(const TaskQueue &) = delete;
+  TaskQueue &operator=(const TaskQueue &) = delete;
+
+  void submit(std::function<void()> task);
+
+  // 阻塞直到当前已提交的任务全部完成
+  void drain();
+
+  bool isWorkerThread() const;
+
+ private:
+  // 状态单独放在 shared_ptr 中，自身线程析构时 detach 的线程仍可安全访问
+  struct State {
+    std::mutex mutex;
+    std::condition_variable taskCv;
+    std::condition_variable idleCv;
+    std::deque<std::function<void()>> tasks;
+    size_t running = 0;
+    bool stop = false;
+  };
+
+  static void workerLoop(std::shared_ptr<State> state);
+
+  std::shared_ptr<State> m_state;
+  std::vector<std::thread> m_threads;
+};
+
+// 进程内共享的有界线程池，用于 create/arch version 等与实例无关的异步调用
+TaskQueue &sharedPool();
+
+}  // namespace taskqueue
+}  // namespace tools
+}  // namespace qnn
@@ -0,0 +1,156 @@
+#include "Tracer.hpp"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+#include "Logger.hpp"
+
+using namespace qnn::tools;
+
+uint64_t tracing::nowUs() {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+
+uint32_t tracing::currentThreadId() {
+  static thread_local uint32_t tid = static_cast<uint32_t>(syscall(SYS_gettid));
+  return tid;
+}
+
+tracing::Tracer &tracing::Tracer::instance() {
+  static Tracer tracer;
+  return tracer;
+}
+
+void tracing::Tracer::start(size_t capacity) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.clear();
+  m_dropped  = 0;
+  m_capacity = capacity > 0 ? capacity : DEFAULT_TRACE_CAPACITY;
+  m_enabled.store(true, std::memory_order_relaxed);
+  QNN_INFO("Tracing started, capacity %zu events", m_capacity);
+}
+
+void tracing::Tracer::stop() {
+  m_enabled.store(false, std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  QNN_INFO("Tracing stopped, %zu events buffered, %llu dropped", m_events.size(),
+           static_cast<unsigned long long>(m_dropped));
+}
+
+void tracing::Tracer::addComplete(std::string name,
+                                  const char *category,
+                                  uint64_t startUs,
+                                  uint64_t durationUs,
+                                  uint32_t tid,
+                                  std::string args) {
+  if (!enabled()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_events.size() >= m_capacity) {
+    m_events.pop_front();
+    m_dropped++;
+  }
+  m_events.push_back(
+      TraceEvent{std::move(name), category, startUs, durationUs, tid, std::move(args)});
+}
+
+std::string tracing::Tracer::toJson() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  uint32_t pid     = static_cast<uint32_t>(getpid());
+  bool first       = true;
+  for (const TraceEvent &event : m_events) {
+    if (!first) {
+      json += ",";
+    }
+    first = false;
+    json += "{\"name\":";
+    appendJsonString(json, event.name);
+    json += ",\"cat\":\"";
+    json += event.category;
+    json += "\",\"ph\":\"X\",\"ts\":" + std::to_string(event.startUs) +
+            ",\"dur\":" + std::to_string(event.durationUs) + ",\"pid\":" + std::to_string(pid) +
+            ",\"tid\":" + std::to_string(event.tid);
+    if (!event.args.empty()) {
+      json += ",\"args\":{" + event.args + "}";
+    }
+    json += "}";
+  }
+  json += "],\"otherData\":{\"droppedEvents\":" + std::to_string(m_dropped) + "}}";
+  return json;
+}
+
+bool tracing::Tracer::writeJson(const std::string &path) {
+  std::string json = toJson();
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    QNN_ERROR("Failed to open trace file %s", path.c_str());
+    return false;
+  }
+  out.write(json.data(), static_cast<std::streamsize>(json.size()));
+  if (!out) {
+    QNN_ERROR("Failed to write trace file %s", path.c_str());
+    return false;
+  }
+  QNN_INFO("Wrote %zu bytes of trace to %s", json.size(), path.c_str());
+  return true;
+}
+
+void tracing::Tracer::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.clear();
+  m_dropped = 0;
+}
+
+uint64_t tracing::Tracer::dropped() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_dropped;
+}
+
+tracing::TraceSpan::TraceSpan(const char *name, const char *category)
+    : m_name(name), m_category(category) {
+  if (Tracer::instance().enabled()) {
+    m_active  = true;
+    m_startUs = nowUs();
+  }
+}
+
+tracing::TraceSpan::~TraceSpan() {
+  if (m_active) {
+    Tracer::instance().addComplete(
+        m_name, m_category, m_startUs, nowUs() - m_startUs, currentThreadId());
+  }
+}
+
+void tracing::appendJsonString(std::string &out, const std::string &value) {
+  out += '"';
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+          out += escaped;
+        } else {
+          out += c;
+        }
+    }
+  }
+  out += '"';
+}
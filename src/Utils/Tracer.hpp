@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+
+namespace qnn {
+namespace tools {
+namespace tracing {
+
+// 默认最多缓冲的事件数，超出后丢弃最旧的事件
+constexpr size_t DEFAULT_TRACE_CAPACITY = 65536;
+
+// Trace Event Format 中的完整事件 ("ph":"X")
+struct TraceEvent {
+  std::string name;
+  const char *category = "";  // 必须是静态字符串
+  uint64_t startUs     = 0;
+  uint64_t durationUs  = 0;
+  uint32_t tid         = 0;
+  std::string args;  // JSON 对象的内容（不含花括号），可为空
+};
+
+// steady_clock 时间戳（微秒），与 ExecutionProfile::startUs 使用同一时钟
+uint64_t nowUs();
+
+uint32_t currentThreadId();
+
+// 进程级的时间线记录器：FFI 入口、工作线程排队、量化/反量化、graphExecute 和 backend 事件
+// 写入同一个有界缓冲，导出为 chrome://tracing / Perfetto 可直接打开的 JSON。
+// 未启动时每个埋点只有一次原子读。
+class Tracer {
+ public:
+  static Tracer &instance();
+
+  // 清空缓冲并开始记录
+  void start(size_t capacity = DEFAULT_TRACE_CAPACITY);
+
+  // 停止记录，已缓冲的事件保留，可继续导出
+  void stop();
+
+  bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+  void addComplete(std::string name,
+                   const char *category,
+                   uint64_t startUs,
+                   uint64_t durationUs,
+                   uint32_t tid,
+                   std::string args = std::string());
+
+  std::string toJson();
+
+  bool writeJson(const std::string &path);
+
+  void clear();
+
+  // 因缓冲已满被丢弃的事件数
+  uint64_t dropped();
+
+ private:
+  Tracer() = default;
+
+  std::atomic<bool> m_enabled{false};
+  std::mutex m_mutex;
+  std::deque<TraceEvent> m_events;
+  size_t m_capacity  = DEFAULT_TRACE_CAPACITY;
+  uint64_t m_dropped = 0;
+};
+
+// 作用域内的耗时区间，析构时记录；构造时未启动记录则什么都不做
+class TraceSpan {
+ public:
+  TraceSpan(const char *name, const char *category);
+
+  ~TraceSpan();
+
+  TraceSpan(const TraceSpan &) = delete;
+  TraceSpan &operator=(const TraceSpan &) = delete;
+
+ private:
+  const char *m_name;
+  const char *m_category;
+  uint64_t m_startUs = 0;
+  bool m_active      = false;
+};
+
+// 转义后追加为 JSON 字符串（含引号）
+void appendJsonString(std::string &out, const std::string &value);
+
+}  // namespace tracing
+}  // namespace tools
+}  // namespace qnn
@@ -0,0 +1,726 @@
+// qnn-bench：在应用之外测量模型与封装层的性能。
+// 冷启动各阶段、预热、延迟分位数与吞吐量以文本输出，可同时写出 JSON。
+// Linux 上可配合 libQnnCpu.so 或桩 backend 运行，只依赖 qnn_common。
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "BatchScheduler.hpp"
+#include "Logger.hpp"
+#include "PAL/GetOpt.hpp"
+#include "QnnSampleApp.hpp"
+#include "QnnSampleAppUtils.hpp"
+#include "Tracer.hpp"
+
+using namespace qnn;
+using namespace qnn::tools;
+
+using Clock = std::chrono::steady_clock;
+
+// 每次迭代正好提交一个 batch，凑满即执行；超时只是兜底
+constexpr std::chrono::milliseconds BATCH_MAX_DELAY(100);
+
+namespace {
+
+struct BenchOptions {
+  std::string backendPath;
+  std::string modelPath;
+  uint32_t iterations = 100;
+  uint32_t warmupRuns = 10;
+  uint32_t threads    = 1;
+  bool batch          = false;  // 单样本请求经 BatchScheduler 合进图的 batch 维度执行
+  std::string input   = "zeros";  // zeros | random | 输入列表文件路径
+  int graphIdx        = 0;
+  std::string jsonPath;  // "-" 表示把 JSON 写到标准输出并省略文本报告
+  std::string tracePath;
+  QnnLog_Level_t logLevel = QNN_LOG_LEVEL_WARN;
+};
+
+// 一个样本：每个输入一块 float 数据
+using Sample = std::vector<std::vector<float>>;
+
+struct LatencyStats {
+  size_t count  = 0;
+  double meanMs = 0.0;
+  double minMs  = 0.0;
+  double p50Ms  = 0.0;
+  double p90Ms  = 0.0;
+  double p99Ms  = 0.0;
+  double maxMs  = 0.0;
+};
+
+// 每个工作线程独占一个实例，同一 backend 的实例通过 BackendRegistry 共享 backend/device
+struct Worker {
+  std::unique_ptr<sample_app::QnnSampleApp> app;
+  // 合批模式下使用，声明在 app 之后以便先于实例析构
+  std::unique_ptr<sample_app::BatchScheduler> scheduler;
+  std::vector<std::vector<float>> outputs;
+  std::vector<std::vector<float>> slotOutputs;  // 合批模式下每个请求的单样本输出：[slot * 输出数 + i]
+  std::vector<double> latenciesMs;
+  uint64_t failures = 0;
+};
+
+void printUsage(const char *program) {
+  printf(
+      "Usage: %s --backend <path> --model <path> [options]\n"
+      "\n"
+      "  --backend <path>     QNN backend library, e.g. libQnnCpu.so or libQnnHtp.so\n"
+      "  --model <path>       model .so or context binary .bin\n"
+      "  --iterations <n>     timed iterations per thread (default 100)\n"
+      "  --warmup <n>         warm-up runs per instance before timing (default 10)\n"
+      "  --threads <n>        worker threads, each with its own instance (default 1)\n"
+      "  --batch              submit single-sample requests through BatchScheduler, which\n"
+      "                       packs them into the graph's batch dimension (dim 0); each\n"
+      "                       iteration runs one full batch, latency is reported per\n"
+      "                       batch and throughput per sample. Input list files then\n"
+      "                       hold one sample each\n"
+      "  --input <src>        zeros, random, or an input list file as read by\n"
+      "                       readInputList (raw float32 files, one line per sample)\n"
+      "  --graph <idx>        graph index to run (default 0)\n"
+      "  --json <path>        also write the report as JSON; '-' prints JSON only\n"
+      "  --trace <path>       write a Chrome trace of the timed phase\n"
+      "  --log_level <level>  error, warn, info, debug (default warn)\n"
+      "  --help               show this message\n",
+      program);
+}
+
+bool parseUint(const char *arg, uint32_t &value) {
+  char *end           = nullptr;
+  unsigned long parsed = strtoul(arg, &end, 10);
+  if (end == arg || *end != '\0') {
+    return false;
+  }
+  value = static_cast<uint32_t>(parsed);
+  return true;
+}
+
+bool parseOptions(int argc, char **argv, BenchOptions &options) {
+  enum {
+    OPT_BACKEND = 1,
+    OPT_MODEL,
+    OPT_ITERATIONS,
+    OPT_WARMUP,
+    OPT_THREADS,
+    OPT_BATCH,
+    OPT_INPUT,
+    OPT_GRAPH,
+    OPT_JSON,
+    OPT_TRACE,
+    OPT_LOG_LEVEL,
+    OPT_HELP
+  };
+  static const pal::Option longOptions[] = {
+      {"backend", pal::required_argument, nullptr, OPT_BACKEND},
+      {"model", pal::required_argument, nullptr, OPT_MODEL},
+      {"iterations", pal::required_argument, nullptr, OPT_ITERATIONS},
+      {"warmup", pal::required_argument, nullptr, OPT_WARMUP},
+      {"threads", pal::required_argument, nullptr, OPT_THREADS},
+      {"batch", pal::no_argument, nullptr, OPT_BATCH},
+      {"input", pal::required_argument, nullptr, OPT_INPUT},
+      {"graph", pal::required_argument, nullptr, OPT_GRAPH},
+      {"json", pal::required_argument, nullptr, OPT_JSON},
+      {"trace", pal::required_argument, nullptr, OPT_TRACE},
+      {"log_level", pal::required_argument, nullptr, OPT_LOG_LEVEL},
+      {"help", pal::no_argument, nullptr, OPT_HELP},
+      {nullptr, 0, nullptr, 0}};
+
+  int opt;
+  int longIndex = 0;
+  uint32_t value;
+  while ((opt = pal::getOptLongOnly(argc, argv, "", longOptions, &longIndex)) != -1) {
+    switch (opt) {
+      case OPT_BACKEND:
+        options.backendPath = pal::g_optArg;
+        break;
+      case OPT_MODEL:
+        options.modelPath = pal::g_optArg;
+        break;
+      case OPT_ITERATIONS:
+        if (!parseUint(pal::g_optArg, options.iterations) || options.iterations == 0) {
+          fprintf(stderr, "Invalid --iterations: %s\n", pal::g_optArg);
+          return false;
+        }
+        break;
+      case OPT_WARMUP:
+        if (!parseUint(pal::g_optArg, options.warmupRuns)) {
+          fprintf(stderr, "Invalid --warmup: %s\n", pal::g_optArg);
+          return false;
+        }
+        break;
+      case OPT_THREADS:
+        if (!parseUint(pal::g_optArg, options.threads) || options.threads == 0) {
+          fprintf(stderr, "Invalid --threads: %s\n", pal::g_optArg);
+          return false;
+        }
+        break;
+      case OPT_BATCH:
+        options.batch = true;
+        break;
+      case OPT_INPUT:
+        options.input = pal::g_optArg;
+        break;
+      case OPT_GRAPH:
+        if (!parseUint(pal::g_optArg, value)) {
+          fprintf(stderr, "Invalid --graph: %s\n", pal::g_optArg);
+          return false;
+        }
+        options.graphIdx = static_cast<int>(value);
+        break;
+      case OPT_JSON:
+        options.jsonPath = pal::g_optArg;
+        break;
+      case OPT_TRACE:
+        options.tracePath = pal::g_optArg;
+        break;
+      case OPT_LOG_LEVEL: {
+        std::string level = pal::g_optArg;
+        if (level == "error") {
+          options.logLevel = QNN_LOG_LEVEL_ERROR;
+        } else if (level == "warn") {
+          options.logLevel = QNN_LOG_LEVEL_WARN;
+        } else if (level == "info") {
+          options.logLevel = QNN_LOG_LEVEL_INFO;
+        } else if (level == "debug") {
+          options.logLevel = QNN_LOG_LEVEL_DEBUG;
+        } else {
+          fprintf(stderr, "Invalid --log_level: %s\n", pal::g_optArg);
+          return false;
+        }
+        break;
+      }
+      case OPT_HELP:
+      default:
+        return false;
+    }
+  }
+  if (options.backendPath.empty() || options.modelPath.empty()) {
+    fprintf(stderr, "--backend and --model are required\n");
+    return false;
+  }
+  return true;
+}
+
+size_t elementCount(const sample_app::TensorView &view) {
+  size_t count = 1;
+  for (uint32_t d = 0; d < view.rank; d++) {
+    count *= view.dims[d];
+  }
+  return count;
+}
+
+bool readRawFloats(const std::string &path, size_t numElements, std::vector<float> &data) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in) {
+    fprintf(stderr, "Failed to open input file %s\n", path.c_str());
+    return false;
+  }
+  std::streamsize size = in.tellg();
+  if (size < static_cast<std::streamsize>(numElements * sizeof(float))) {
+    fprintf(stderr, "Input file %s has %lld bytes, expected %zu\n", path.c_str(),
+            static_cast<long long>(size), numElements * sizeof(float));
+    return false;
+  }
+  data.resize(numElements);
+  in.seekg(0);
+  in.read(reinterpret_cast<char *>(data.data()),
+          static_cast<std::streamsize>(numElements * sizeof(float)));
+  return static_cast<bool>(in);
+}
+
+// 按输入名称与元素个数准备样本，输入列表中可用 name:=path 指定对应关系
+bool prepareSamples(const BenchOptions &options,
+                    const std::vector<std::string> &inputNames,
+                    const std::vector<size_t> &inputSizes,
+                    std::vector<Sample> &samples) {
+  if (options.input == "zeros" || options.input == "random") {
+    Sample sample(inputSizes.size());
+    // 与 QnnSampleApp::warmup 的随机输入使用同样的种子和分布
+    std::mt19937 rng(0x5eed);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    for (size_t i = 0; i < inputSizes.size(); i++) {
+      sample[i].assign(inputSizes[i], 0.0f);
+      if (options.input == "random") {
+        for (float &v : sample[i]) {
+          v = dist(rng);
+        }
+      }
+    }
+    samples.push_back(std::move(sample));
+    return true;
+  }
+
+  std::vector<std::vector<std::string>> filePaths;
+  std::unordered_map<std::string, uint32_t> nameToIndex;
+  bool ok = false;
+  std::tie(filePaths, nameToIndex, ok) = sample_app::readInputList(options.input);
+  if (!ok || filePaths.empty()) {
+    fprintf(stderr, "Failed to read input list %s\n", options.input.c_str());
+    return false;
+  }
+  size_t numSamples = filePaths[0].size();
+  for (size_t s = 0; s < numSamples; s++) {
+    Sample sample(inputSizes.size());
+    for (size_t i = 0; i < inputSizes.size(); i++) {
+      size_t column = i;
+      auto it       = nameToIndex.find(inputNames[i]);
+      if (it != nameToIndex.end()) {
+        column = it->second;
+      }
+      if (column >= filePaths.size() || s >= filePaths[column].size()) {
+        fprintf(stderr, "Input list has no file for input %s on line %zu\n",
+                inputNames[i].c_str(), s + 1);
+        return false;
+      }
+      if (!readRawFloats(filePaths[column][s], inputSizes[i], sample[i])) {
+        return false;
+      }
+    }
+    samples.push_back(std::move(sample));
+  }
+  return true;
+}
+
+LatencyStats summarize(std::vector<double> latencies) {
+  LatencyStats stats;
+  if (latencies.empty()) {
+    return stats;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double q) {
+    size_t rank = static_cast<size_t>(q * latencies.size() + 0.5);
+    rank        = std::min(std::max<size_t>(rank, 1), latencies.size());
+    return latencies[rank - 1];
+  };
+  double total = 0.0;
+  for (double v : latencies) {
+    total += v;
+  }
+  stats.count  = latencies.size();
+  stats.meanMs = total / latencies.size();
+  stats.minMs  = latencies.front();
+  stats.p50Ms  = percentile(0.50);
+  stats.p90Ms  = percentile(0.90);
+  stats.p99Ms  = percentile(0.99);
+  stats.maxMs  = latencies.back();
+  return stats;
+}
+
+std::string latencyJson(const LatencyStats &stats) {
+  std::ostringstream json;
+  json << std::fixed << std::setprecision(3) << "{\"count\":" << stats.count
+       << ",\"meanMs\":" << stats.meanMs << ",\"minMs\":" << stats.minMs
+       << ",\"p50Ms\":" << stats.p50Ms << ",\"p90Ms\":" << stats.p90Ms
+       << ",\"p99Ms\":" << stats.p99Ms << ",\"maxMs\":" << stats.maxMs << "}";
+  return json.str();
+}
+
+std::string summaryJson(const metrics::LatencySummary &summary) {
+  std::ostringstream json;
+  json << std::fixed << std::setprecision(3) << "{\"count\":" << summary.count
+       << ",\"meanUs\":" << summary.meanUs << ",\"p50Us\":" << summary.p50Us
+       << ",\"p90Us\":" << summary.p90Us << ",\"p99Us\":" << summary.p99Us
+       << ",\"maxUs\":" << summary.maxUs << "}";
+  return json.str();
+}
+
+// 输入列表模式下用第一个样本预热，预热与计时阶段的数据分布一致；统计口径同 QnnSampleApp::warmup
+bool warmupWithSample(Worker &worker,
+                      const Sample &sample,
+                      const std::vector<size_t> &inputSizes,
+                      const std::vector<size_t> &outputSizes,
+                      uint32_t runs,
+                      int graphIdx,
+                      sample_app::WarmupStats &stats) {
+  std::vector<const float *> inputs(sample.size());
+  for (size_t i = 0; i < sample.size(); i++) {
+    inputs[i] = sample[i].data();
+  }
+  std::vector<float *> outputs(worker.outputs.size());
+  for (size_t i = 0; i < worker.outputs.size(); i++) {
+    outputs[i] = worker.outputs[i].data();
+  }
+  std::vector<double> latencies;
+  latencies.reserve(runs);
+  for (uint32_t r = 0; r < runs; r++) {
+    auto start = Clock::now();
+    if (sample_app::StatusCode::SUCCESS !=
+        worker.app->infer(inputs.data(), inputSizes.data(), inputs.size(), outputs.data(),
+                          outputSizes.data(), outputs.size(), graphIdx)) {
+      return false;
+    }
+    latencies.push_back(std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+  }
+  stats            = sample_app::WarmupStats();
+  stats.runs       = runs;
+  stats.firstRunMs = latencies.front();
+  stats.minMs      = *std::min_element(latencies.begin(), latencies.end());
+  stats.maxMs      = *std::max_element(latencies.begin(), latencies.end());
+  for (double latency : latencies) {
+    stats.totalMs += latency;
+  }
+  std::vector<double> steady(latencies.size() > 1 ? latencies.begin() + 1 : latencies.begin(),
+                             latencies.end());
+  std::nth_element(steady.begin(), steady.begin() + steady.size() / 2, steady.end());
+  stats.steadyStateMs = steady[steady.size() / 2];
+  return true;
+}
+
+// 把一个 batch 的单样本请求交给 BatchScheduler，凑满后整批执行一次，等待所有回调返回
+bool runBatch(Worker &worker,
+              const std::vector<Sample> &samples,
+              size_t &next,
+              const std::vector<size_t> &inputSizes,
+              const std::vector<size_t> &outputSizes) {
+  size_t numOutputs = outputSizes.size();
+  std::vector<const float *> inputs(inputSizes.size());
+  std::vector<float *> outputs(numOutputs);
+  std::mutex mutex;
+  std::condition_variable cv;
+  uint32_t pending = 0;
+  bool ok          = true;
+  auto onDone      = [&](sample_app::StatusCode status) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ok = ok && sample_app::StatusCode::SUCCESS == status;
+    if (--pending == 0) {
+      cv.notify_one();
+    }
+  };
+  bool submitted = true;
+  for (uint32_t slot = 0; slot < worker.scheduler->batchSize(); slot++) {
+    const Sample &sample = samples[next++ % samples.size()];
+    for (size_t i = 0; i < sample.size(); i++) {
+      inputs[i] = sample[i].data();
+    }
+    for (size_t i = 0; i < numOutputs; i++) {
+      outputs[i] = worker.slotOutputs[slot * numOutputs + i].data();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pending++;
+    }
+    if (sample_app::StatusCode::SUCCESS !=
+        worker.scheduler->submit(inputs.data(), inputSizes.data(), inputs.size(), outputs.data(),
+                                 outputSizes.data(), numOutputs, onDone)) {
+      std::lock_guard<std::mutex> lock(mutex);
+      pending--;
+      submitted = false;
+      break;
+    }
+  }
+  // 提交失败时 batch 凑不满，立即执行已排队的请求
+  if (!submitted) {
+    worker.scheduler->flush();
+  }
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait(lock, [&pending] { return pending == 0; });
+  return submitted && ok;
+}
+
+void printSummary(const char *name, const metrics::LatencySummary &summary) {
+  printf("  %-18s p50 %9.1f  p90 %9.1f  p99 %9.1f  max %9.1f us\n", name, summary.p50Us,
+         summary.p90Us, summary.p99Us, summary.maxUs);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  BenchOptions options;
+  if (!parseOptions(argc, argv, options)) {
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (!log::initializeLogging()) {
+    fprintf(stderr, "Unable to initialize logging\n");
+    return EXIT_FAILURE;
+  }
+  log::setLogLevel(options.logLevel);
+
+  // 实例依次创建：第一个实例的启动统计即冷启动，之后的实例复用共享 backend
+  std::vector<Worker> workers(options.threads);
+  for (uint32_t t = 0; t < options.threads; t++) {
+    try {
+      workers[t].app = std::make_unique<sample_app::QnnSampleApp>(options.backendPath,
+                                                                  options.modelPath);
+    } catch (const std::exception &e) {
+      fprintf(stderr, "Failed to create instance %u: %s\n", t, e.what());
+      return EXIT_FAILURE;
+    }
+  }
+  sample_app::StartupStats startup = workers[0].app->getStartupStats();
+
+  sample_app::QnnSampleApp &first = *workers[0].app;
+  if (options.graphIdx >= static_cast<int>(first.getGraphCount())) {
+    fprintf(stderr, "Graph index %d out of range (%u graphs)\n", options.graphIdx,
+            first.getGraphCount());
+    return EXIT_FAILURE;
+  }
+  if (sample_app::StatusCode::SUCCESS != first.prepareTensors(options.graphIdx)) {
+    fprintf(stderr, "Failed to prepare tensors\n");
+    return EXIT_FAILURE;
+  }
+  std::vector<std::string> inputNames;
+  std::vector<size_t> inputSizes;
+  for (uint32_t i = 0; i < first.getNumInputTensors(options.graphIdx); i++) {
+    sample_app::TensorView view;
+    first.getInputTensorView(i, view, options.graphIdx);
+    inputNames.push_back(view.name ? view.name : "");
+    inputSizes.push_back(elementCount(view));
+  }
+  std::vector<size_t> outputSizes;
+  for (uint32_t i = 0; i < first.getNumOutputTensors(options.graphIdx); i++) {
+    sample_app::TensorView view;
+    first.getOutputTensorView(i, view, options.graphIdx);
+    outputSizes.push_back(elementCount(view));
+  }
+
+  // 合批模式下样本与请求都是单样本大小，batch 大小取自图的第 0 维
+  uint32_t batchSize = 1;
+  std::vector<size_t> requestInputSizes  = inputSizes;
+  std::vector<size_t> requestOutputSizes = outputSizes;
+  if (options.batch) {
+    for (uint32_t t = 0; t < options.threads; t++) {
+      try {
+        workers[t].scheduler = std::make_unique<sample_app::BatchScheduler>(
+            workers[t].app.get(), options.graphIdx, BATCH_MAX_DELAY);
+      } catch (const std::exception &e) {
+        fprintf(stderr, "Cannot batch graph %d: %s\n", options.graphIdx, e.what());
+        return EXIT_FAILURE;
+      }
+    }
+    batchSize = workers[0].scheduler->batchSize();
+    for (size_t &size : requestInputSizes) {
+      size /= batchSize;
+    }
+    for (size_t &size : requestOutputSizes) {
+      size /= batchSize;
+    }
+  }
+
+  std::vector<Sample> samples;
+  if (!prepareSamples(options, inputNames, requestInputSizes, samples)) {
+    return EXIT_FAILURE;
+  }
+  // 预热直接在实例上执行整个 batch，把第一个样本铺满所有槽位
+  Sample warmupSample(samples[0].size());
+  for (size_t i = 0; i < samples[0].size(); i++) {
+    for (uint32_t b = 0; b < batchSize; b++) {
+      warmupSample[i].insert(warmupSample[i].end(), samples[0][i].begin(), samples[0][i].end());
+    }
+  }
+
+  sample_app::WarmupStats warmup;
+  bool inputList = options.input != "zeros" && options.input != "random";
+  sample_app::WarmupInput warmupInput = options.input == "zeros"
+                                            ? sample_app::WarmupInput::ZEROS
+                                            : sample_app::WarmupInput::RANDOM;
+  for (uint32_t t = 0; t < options.threads; t++) {
+    Worker &worker = workers[t];
+    if (sample_app::StatusCode::SUCCESS != worker.app->prepareTensors(options.graphIdx)) {
+      fprintf(stderr, "Failed to prepare tensors of instance %u\n", t);
+      return EXIT_FAILURE;
+    }
+    worker.outputs.resize(outputSizes.size());
+    for (size_t i = 0; i < outputSizes.size(); i++) {
+      worker.outputs[i].resize(outputSizes[i]);
+    }
+    if (options.batch) {
+      worker.slotOutputs.resize(batchSize * requestOutputSizes.size());
+      for (size_t slot = 0; slot < worker.slotOutputs.size(); slot++) {
+        worker.slotOutputs[slot].resize(requestOutputSizes[slot % requestOutputSizes.size()]);
+      }
+    }
+    sample_app::WarmupStats stats;
+    bool warmedUp = true;
+    if (options.warmupRuns > 0) {
+      warmedUp = inputList ? warmupWithSample(worker, warmupSample, inputSizes, outputSizes,
+                                              options.warmupRuns, options.graphIdx, stats)
+                           : sample_app::StatusCode::SUCCESS ==
+                                 worker.app->warmup(options.warmupRuns, stats, options.graphIdx,
+                                                    warmupInput);
+    }
+    if (!warmedUp) {
+      fprintf(stderr, "Warm-up of instance %u failed\n", t);
+      return EXIT_FAILURE;
+    }
+    if (t == 0) {
+      warmup = stats;
+    }
+    worker.latenciesMs.reserve(options.iterations);
+    // 只统计计时阶段
+    sample_app::Metrics discard;
+    worker.app->getMetrics(discard, true);
+  }
+
+  if (!options.tracePath.empty()) {
+    tracing::Tracer::instance().start();
+  }
+
+  std::mutex startMutex;
+  std::condition_variable startCv;
+  bool started = false;
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < options.threads; t++) {
+    threads.emplace_back([&, t]() {
+      Worker &worker = workers[t];
+      std::vector<const float *> inputs(inputSizes.size());
+      std::vector<float *> outputs(outputSizes.size());
+      for (size_t i = 0; i < outputSizes.size(); i++) {
+        outputs[i] = worker.outputs[i].data();
+      }
+      {
+        std::unique_lock<std::mutex> lock(startMutex);
+        startCv.wait(lock, [&started] { return started; });
+      }
+      size_t next = 0;
+      for (uint32_t it = 0; it < options.iterations; it++) {
+        auto start = Clock::now();
+        if (options.batch) {
+          if (!runBatch(worker, samples, next, requestInputSizes, requestOutputSizes)) {
+            worker.failures++;
+          }
+        } else {
+          const Sample &sample = samples[next++ % samples.size()];
+          for (size_t i = 0; i < sample.size(); i++) {
+            inputs[i] = sample[i].data();
+          }
+          if (sample_app::StatusCode::SUCCESS !=
+              worker.app->infer(inputs.data(), inputSizes.data(), inputs.size(), outputs.data(),
+                                outputSizes.data(), outputs.size(), options.graphIdx)) {
+            worker.failures++;
+          }
+        }
+        worker.latenciesMs.push_back(
+            std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+      }
+    });
+  }
+  auto runStart = Clock::now();
+  {
+    std::lock_guard<std::mutex> lock(startMutex);
+    started = true;
+  }
+  startCv.notify_all();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  double runSeconds = std::chrono::duration<double>(Clock::now() - runStart).count();
+
+  if (!options.tracePath.empty()) {
+    tracing::Tracer::instance().stop();
+    tracing::Tracer::instance().writeJson(options.tracePath);
+  }
+
+  std::vector<double> allLatencies;
+  uint64_t failures = 0;
+  for (const Worker &worker : workers) {
+    allLatencies.insert(allLatencies.end(), worker.latenciesMs.begin(), worker.latenciesMs.end());
+    failures += worker.failures;
+  }
+  LatencyStats latency = summarize(allLatencies);
+  uint64_t inferences =
+      static_cast<uint64_t>(options.iterations) * batchSize * options.threads;
+  double throughput = runSeconds > 0.0 ? inferences / runSeconds : 0.0;
+  sample_app::Metrics stages;
+  workers[0].app->getMetrics(stages);
+
+  if (options.jsonPath != "-") {
+    printf("qnn-bench: %s on %s\n", options.modelPath.c_str(), options.backendPath.c_str());
+    printf("Cold start (instance 0): %.2f ms\n", startup.totalMs);
+    printf("  backend acquire    %9.2f ms%s\n", startup.backendAcquireMs,
+           startup.backendShared ? " (shared)" : "");
+    printf("  model load         %9.2f ms\n", startup.modelLoadMs);
+    if (startup.cacheLookupMs > 0.0) {
+      printf("  cache lookup       %9.2f ms\n", startup.cacheLookupMs);
+    }
+    // .bin 与缓存命中走二进制路径，没有 compose/finalize；.so 编译路径没有二进制读取阶段
+    if (startup.binary.fileSize > 0) {
+      const sample_app::BinaryLoadStats &binary = startup.binary;
+      printf("  binary read        %9.2f ms (%s, %llu bytes)\n", binary.readMs,
+             binary.mapped ? "mapped" : "heap",
+             static_cast<unsigned long long>(binary.fileSize));
+      printf("  %-18s %9.2f ms\n", binary.metadataFromSidecar ? "sidecar index" : "binary info",
+             binary.binaryInfoMs);
+      printf("  context create     %9.2f ms\n", startup.contextCreateMs);
+      printf("  graph retrieve     %9.2f ms\n", binary.graphRetrieveMs);
+    } else {
+      printf("  context create     %9.2f ms\n", startup.contextCreateMs);
+      printf("  compose graphs     %9.2f ms\n", startup.composeGraphsMs);
+      printf("  graph config       %9.2f ms\n", startup.graphConfigMs);
+      printf("  finalize graphs    %9.2f ms\n", startup.finalizeGraphsMs);
+      printf("  cache store        %9.2f ms\n", startup.cacheStoreMs);
+    }
+    if (options.warmupRuns > 0) {
+      printf("Warm-up (instance 0): %u runs, first %.3f ms, steady state %.3f ms\n", warmup.runs,
+             warmup.firstRunMs, warmup.steadyStateMs);
+    }
+    if (options.batch) {
+      printf("Latency per batch of %u (%zu batches, input %s):\n", batchSize, latency.count,
+             options.input.c_str());
+    } else {
+      printf("Latency per inference (%zu samples, input %s):\n", latency.count,
+             options.input.c_str());
+    }
+    printf("  mean %.3f  min %.3f  p50 %.3f  p90 %.3f  p99 %.3f  max %.3f ms\n", latency.meanMs,
+           latency.minMs, latency.p50Ms, latency.p90Ms, latency.p99Ms, latency.maxMs);
+    printf("Throughput: %.1f inferences/s (%u threads, batch %u, %.2f s)\n", throughput,
+           options.threads, batchSize, runSeconds);
+    printf("Stages (instance 0):\n");
+    printSummary("input staging", stages.inputStaging);
+    printSummary("execute", stages.execute);
+    printSummary("output conversion", stages.outputConversion);
+    printSummary("infer", stages.infer);
+    if (failures > 0) {
+      printf("Failures: %llu\n", static_cast<unsigned long long>(failures));
+    }
+  }
+
+  if (!options.jsonPath.empty()) {
+    std::string backendPath, modelPath, input;
+    tracing::appendJsonString(backendPath, options.backendPath);
+    tracing::appendJsonString(modelPath, options.modelPath);
+    tracing::appendJsonString(input, options.input);
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3) << "{\"backend\":" << backendPath
+         << ",\"model\":" << modelPath << ",\"iterations\":" << options.iterations
+         << ",\"warmupRuns\":" << options.warmupRuns << ",\"threads\":" << options.threads
+         << ",\"batch\":" << (options.batch ? "true" : "false")
+         << ",\"batchSize\":" << batchSize << ",\"input\":" << input
+         << ",\"graphIdx\":" << options.graphIdx << ",\"startup\":" << startup.toJson()
+         << ",\"warmup\":{\"runs\":" << warmup.runs << ",\"firstRunMs\":" << warmup.firstRunMs
+         << ",\"steadyStateMs\":" << warmup.steadyStateMs << "}"
+         << ",\"latency\":" << latencyJson(latency) << ",\"throughput\":" << throughput
+         << ",\"runSeconds\":" << runSeconds << ",\"stages\":{\"inputStaging\":"
+         << summaryJson(stages.inputStaging) << ",\"execute\":" << summaryJson(stages.execute)
+         << ",\"outputConversion\":" << summaryJson(stages.outputConversion)
+         << ",\"infer\":" << summaryJson(stages.infer) << "},\"failures\":" << failures << "}";
+    if (options.jsonPath == "-") {
+      printf("%s\n", json.str().c_str());
+    } else {
+      std::ofstream out(options.jsonPath);
+      out << json.str() << "\n";
+      if (!out) {
+        fprintf(stderr, "Failed to write %s\n", options.jsonPath.c_str());
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // 先销毁实例再退出，共享 backend 随最后一个实例释放
+  workers.clear();
+  return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -1,19 +1,28 @@
 #include "qnn_wrapper.h"
 #include "HTP/QnnHtpDevice.h"
 #include "QnnSampleApp.hpp"
+#include "BatchScheduler.hpp"
+#include "ModelLoader.hpp"
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 #include <new>
-#include <thread>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <stdexcept>
+#include <thread>
 #include <unistd.h>
 #include <android/log.h>
 #include <errno.h>
 #include <dirent.h>
 
 #include "Logger.hpp"
+#include "TaskQueue.hpp"
+#include "Tracer.hpp"
 
 using namespace qnn::tools;
 
@@ -28,14 +37,47 @@ using namespace qnn::tools;
 // 定义不透明结构体，内部保存 C++ 对象实例指针
 struct QnnSampleApp {
     qnn::tools::sample_app::QnnSampleApp* instance;
+    // 实例专属的串行工作线程，该实例的异步调用按提交顺序依次执行
+    std::unique_ptr<taskqueue::TaskQueue> worker;
 };
 
-extern "C" {
+// 实例相关的异步任务提交到实例自己的队列；实例无效时交给共享线程池，由任务本身返回失败
+static void submitToApp(QnnSampleApp* app, std::function<void()> task) {
+    // 记录任务在工作线程队列中的等待时间
+    if (tracing::Tracer::instance().enabled()) {
+        uint64_t queuedUs = tracing::nowUs();
+        task = [queuedUs, task = std::move(task)]() {
+            uint64_t startUs = tracing::nowUs();
+            tracing::Tracer::instance().addComplete("workerWait", "worker", queuedUs,
+                                                    startUs - queuedUs, tracing::currentThreadId());
+            task();
+        };
+    }
+    if (app && app->worker) {
+        app->worker->submit(std::move(task));
+    } else {
+        taskqueue::sharedPool().submit(std::move(task));
+    }
+}
 
-QnnSampleApp* qnn_sample_app_create(const char* backendPath, const char* modelPath, QnnOutputDataType outputDataType, QnnInputDataType inputDataType, const char* dataDir) {
+struct QnnBatchScheduler {
+    std::unique_ptr<sample_app::BatchScheduler> instance;
+};
+
+struct QnnModelLoader {
+    std::shared_ptr<sample_app::ModelLoader> instance;
+};
+
+// 工作目录是进程级状态，切换目录与按当前目录解析相对路径都在这把锁下进行
+static std::mutex g_environmentMutex;
+
+// 初始化日志并切换工作目录，创建实例前调用。成功返回时 lock 持有 g_environmentMutex，
+// 调用者用 resolvePath 把相对路径解析完后再释放，之后其它线程切换目录不再影响本实例
+static bool prepareEnvironment(const char* dataDir, std::unique_lock<std::mutex>& lock) {
+    lock = std::unique_lock<std::mutex>(g_environmentMutex);
     if (!qnn::log::initializeLogging()) {
         __android_log_print(ANDROID_LOG_ERROR, "QnnWrapper", "ERROR: Unable to initialize logging!\n");
-        return nullptr;
+        return false;
     }
 
     qnn::log::setLogLevel(QNN_LOG_LEVEL_DEBUG);
@@ -66,27 +108,260 @@ QnnSampleApp* qnn_sample_app_create(const char* backendPath, const char* modelPa
             __android_log_print(ANDROID_LOG_ERROR, "QnnWrapper", "切换目录失败: %s", strerror(errno));
         }
     }
-    
+    return true;
+}
+
+// 按当前工作目录把相对路径转为绝对路径。dlopen 只把含 '/' 的名称当作路径，
+// 其余按库搜索路径查找，与工作目录无关，这类名称（libraryName 为 true 时）保持不变
+static std::string resolvePath(const std::string& path, bool libraryName) {
+    if (path.empty() || (libraryName && path.find('/') == std::string::npos)) {
+        return path;
+    }
+    std::error_code ec;
+    std::filesystem::path absolute = std::filesystem::absolute(path, ec);
+    return ec ? path : absolute.string();
+}
+
+static bool isSharedLibrary(const std::string& path) {
+    return path.size() >= 3 && path.compare(path.size() - 3, 3, ".so") == 0;
+}
+
+// 创建实例专属的工作线程。线程创建失败会抛出 std::system_error，不能让异常穿过 C 接口
+static std::unique_ptr<taskqueue::TaskQueue> createWorker() {
+    try {
+        return std::unique_ptr<taskqueue::TaskQueue>(new taskqueue::TaskQueue(1));
+    } catch (const std::exception& e) {
+        __android_log_print(ANDROID_LOG_ERROR, "QnnWrapper", "创建实例工作线程失败: %s", e.what());
+        return nullptr;
+    }
+}
+
+// 把已创建的 C++ 实例包装成 C 句柄，失败时释放实例。句柄总是带有工作线程，
+// 否则该实例的异步调用会落到共享线程池，失去按提交顺序执行的保证
+static QnnSampleApp* wrapInstance(std::unique_ptr<sample_app::QnnSampleApp> instance) {
+    if (!instance) {
+        return nullptr;
+    }
+    std::unique_ptr<taskqueue::TaskQueue> worker = createWorker();
+    if (!worker) {
+        return nullptr;
+    }
     QnnSampleApp* appWrapper = new(std::nothrow) QnnSampleApp;
     if (!appWrapper) {
         return nullptr;
     }
+    appWrapper->instance = instance.release();
+    appWrapper->worker = std::move(worker);
+    return appWrapper;
+}
+
+static contextcache::Config makeCacheConfig(const char* cacheDir, unsigned long long maxCacheBytes) {
+    contextcache::Config cacheConfig;
+    if (cacheDir != nullptr) {
+        cacheConfig.dir = cacheDir;
+    }
+    if (maxCacheBytes > 0) {
+        cacheConfig.maxBytes = maxCacheBytes;
+    }
+    return cacheConfig;
+}
+
+static sample_app::BackendConfig makeBackendConfig(const QnnBackendHtpConfig* htpConfig) {
+    sample_app::BackendConfig backendConfig;
+    if (htpConfig != nullptr) {
+        auto& config = backendConfig.htpConfig;
+        config.optimizationLevel = htpConfig->optimizationLevel;
+        config.precisionMode = static_cast<sample_app::BackendConfig::HtpConfig::PrecisionMode>(htpConfig->precisionMode);
+        config.vtcmSizeMb = htpConfig->vtcmSizeMb;
+        config.numHvxThreads = htpConfig->numHvxThreads;
+        config.enableDlbc = htpConfig->enableDlbc < 0 ? -1 : (htpConfig->enableDlbc != 0 ? 1 : 0);
+        config.enableDlbcWeights = htpConfig->enableDlbcWeights != 0;
+        config.explicitConfig = true;
+    }
+    return backendConfig;
+}
+
+static QnnSampleApp* createApp(const char* backendPath, const char* modelPath, QnnOutputDataType outputDataType, QnnInputDataType inputDataType, const char* dataDir, const sample_app::BackendConfig& backendConfig, const contextcache::Config& cacheConfig, unsigned int warmupRuns) {
+    if (!backendPath || !modelPath) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> environmentLock;
+    if (!prepareEnvironment(dataDir, environmentLock)) {
+        return nullptr;
+    }
+    std::string resolvedBackendPath = resolvePath(backendPath, true);
+    std::string resolvedModelPath = resolvePath(modelPath, isSharedLibrary(modelPath));
+    contextcache::Config resolvedCacheConfig = cacheConfig;
+    resolvedCacheConfig.dir = resolvePath(cacheConfig.dir, false);
+    environmentLock.unlock();
+
+    std::unique_ptr<sample_app::QnnSampleApp> instance;
     try {
         // 使用 C++ 对象构造函数创建实例
-        appWrapper->instance = new qnn::tools::sample_app::QnnSampleApp(backendPath, modelPath,
+        instance.reset(new qnn::tools::sample_app::QnnSampleApp(resolvedBackendPath, resolvedModelPath,
             static_cast<iotensor::OutputDataType>(outputDataType),
-            static_cast<iotensor::InputDataType>(inputDataType));
+            static_cast<iotensor::InputDataType>(inputDataType),
+            backendConfig,
+            resolvedCacheConfig,
+            warmupRuns));
     } catch (const std::exception&) {
-        delete appWrapper;
         __android_log_print(ANDROID_LOG_ERROR, "QnnWrapper", "创建QNN实例失败");
         return nullptr;
     }
-    __android_log_print(ANDROID_LOG_INFO, "QnnWrapper", "创建QNN实例成功");
+    QnnSampleApp* appWrapper = wrapInstance(std::move(instance));
+    if (appWrapper) {
+        __android_log_print(ANDROID_LOG_INFO, "QnnWrapper", "创建QNN实例成功");
+    }
+    return appWrapper;
+}
+
+extern "C" {
+
+QnnSampleApp* qnn_sample_app_create(const char* backendPath, const char* modelPath, QnnOutputDataType outputDataType, QnnInputDataType inputDataType, const char* dataDir) {
+    return createApp(backendPath, modelPath, outputDataType, inputDataType, dataDir,
+                     sample_app::BackendConfig(), contextcache::Config(), 0);
+}
+
+QnnSampleApp* qnn_sample_app_create_with_cache(const char* backendPath, const char* modelPath, QnnOutputDataType outputDataType, QnnInputDataType inputDataType, const char* dataDir, const char* cacheDir, unsigned long long maxCacheBytes) {
+    return createApp(backendPath, modelPath, outputDataType, inputDataType, dataDir,
+                     sample_app::BackendConfig(), makeCacheConfig(cacheDir, maxCacheBytes), 0);
+}
+
+void qnn_htp_config_init(QnnBackendHtpConfig* config) {
+    if (!config) return;
+    sample_app::BackendConfig::HtpConfig defaults;
+    config->optimizationLevel = defaults.optimizationLevel;
+    config->precisionMode = static_cast<QnnHtpPrecisionMode>(defaults.precisionMode);
+    config->vtcmSizeMb = defaults.vtcmSizeMb;
+    config->numHvxThreads = defaults.numHvxThreads;
+    config->enableDlbc = defaults.enableDlbc;
+    config->enableDlbcWeights = defaults.enableDlbcWeights ? 1 : 0;
+}
+
+QnnSampleApp* qnn_sample_app_create_with_options(const char* backendPath, const char* modelPath, QnnOutputDataType outputDataType, QnnInputDataType inputDataType, const char* dataDir, const QnnCreateOptions* options) {
+    if (!options) {
+        return qnn_sample_app_create(backendPath, modelPath, outputDataType, inputDataType, dataDir);
+    }
+    return createApp(backendPath, modelPath, outputDataType, inputDataType, dataDir,
+                     makeBackendConfig(options->htpConfig),
+                     makeCacheConfig(options->cacheDir, options->maxCacheBytes), options->warmupRuns);
+}
+
+int qnn_sample_app_is_loaded_from_cache(QnnSampleApp* app) {
+    if (!app || !app->instance) return 0;
+    return app->instance->isLoadedFromCache() ? 1 : 0;
+}
+
+QnnModelLoader* qnn_model_loader_start(const char* backendPath, const char* modelPath, QnnOutputDataType outputDataType, QnnInputDataType inputDataType, const char* dataDir, const char* cacheDir, unsigned long long maxCacheBytes) {
+    QnnCreateOptions options = {cacheDir, maxCacheBytes, 0, nullptr};
+    return qnn_model_loader_start_with_options(backendPath, modelPath, outputDataType, inputDataType, dataDir, &options);
+}
+
+QnnModelLoader* qnn_model_loader_start_with_options(const char* backendPath, const char* modelPath, QnnOutputDataType outputDataType, QnnInputDataType inputDataType, const char* dataDir, const QnnCreateOptions* options) {
+    if (!backendPath || !modelPath) {
+        return nullptr;
+    }
+    QnnModelLoader* loader = new(std::nothrow) QnnModelLoader;
+    if (!loader) {
+        return nullptr;
+    }
+    try {
+        sample_app::LoadRequest request;
+        request.outputDataType = static_cast<iotensor::OutputDataType>(outputDataType);
+        request.inputDataType = static_cast<iotensor::InputDataType>(inputDataType);
+        if (options) {
+            request.cacheConfig = makeCacheConfig(options->cacheDir, options->maxCacheBytes);
+            request.warmupRuns = options->warmupRuns;
+            request.backendCfg = makeBackendConfig(options->htpConfig);
+        }
+        {
+            // 加载线程稍后才打开文件，路径在切换目录后立即解析
+            std::unique_lock<std::mutex> environmentLock;
+            if (!prepareEnvironment(dataDir, environmentLock)) {
+                delete loader;
+                return nullptr;
+            }
+            request.backendPath = resolvePath(backendPath, true);
+            request.modelPath = resolvePath(modelPath, isSharedLibrary(modelPath));
+            request.cacheConfig.dir = resolvePath(request.cacheConfig.dir, false);
+        }
+        loader->instance = sample_app::ModelLoader::start(std::move(request));
+    } catch (const std::exception& e) {
+        __android_log_print(ANDROID_LOG_ERROR, "QnnWrapper", "启动模型加载失败: %s", e.what());
+        delete loader;
+        return nullptr;
+    }
+    return loader;
+}
+
+QnnLoadStage qnn_model_loader_get_stage(QnnModelLoader* loader) {
+    if (!loader || !loader->instance) return QNN_LOAD_STAGE_FAILED;
+    return static_cast<QnnLoadStage>(loader->instance->stage());
+}
+
+QnnLoadStage qnn_model_loader_wait(QnnModelLoader* loader, int timeoutMs) {
+    if (!loader || !loader->instance) return QNN_LOAD_STAGE_FAILED;
+    return static_cast<QnnLoadStage>(loader->instance->wait(std::chrono::milliseconds(timeoutMs)));
+}
+
+QnnStatus qnn_model_loader_get_timings(QnnModelLoader* loader, QnnLoadTimings* timings) {
+    if (!loader || !loader->instance || !timings) return QNN_STATUS_FAILURE;
+    auto loadTimings = loader->instance->timings();
+    timings->queuedMs = loadTimings.queuedMs;
+    timings->backendMs = loadTimings.backendMs;
+    timings->prefetchMs = loadTimings.prefetchMs;
+    timings->prepareMs = loadTimings.prepareMs;
+    timings->createMs = loadTimings.createMs;
+    timings->totalMs = loadTimings.totalMs;
+    return QNN_STATUS_SUCCESS;
+}
+
+const char* qnn_model_loader_get_error(QnnModelLoader* loader) {
+    if (!loader || !loader->instance) return nullptr;
+    std::string error = loader->instance->error();
+    // 复制一份字符串返回，由调用者负责释放
+    char* cstr = (char*)std::malloc(error.size() + 1);
+    if (cstr) {
+        std::strcpy(cstr, error.c_str());
+    }
+    return cstr;
+}
+
+QnnSampleApp* qnn_model_loader_take_app(QnnModelLoader* loader) {
+    if (!loader || !loader->instance) return nullptr;
+    // 先分配句柄和工作线程再取走实例，任一失败时实例仍留在加载器中，可以重试
+    std::unique_ptr<taskqueue::TaskQueue> worker = createWorker();
+    if (!worker) {
+        return nullptr;
+    }
+    QnnSampleApp* appWrapper = new(std::nothrow) QnnSampleApp;
+    if (!appWrapper) {
+        return nullptr;
+    }
+    appWrapper->instance = loader->instance->take().release();
+    if (!appWrapper->instance) {
+        delete appWrapper;
+        return nullptr;
+    }
+    appWrapper->worker = std::move(worker);
     return appWrapper;
 }
 
+void qnn_model_loader_destroy(QnnModelLoader* loader) {
+    if (loader) {
+        try {
+            loader->instance.reset();
+        } catch (...) {
+            // 忽略异常
+        }
+        delete loader;
+    }
+}
+
 void qnn_sample_app_destroy(QnnSampleApp* app) {
     if (app) {
+        // 先停止工作线程（等待已提交的任务执行完），再释放实例
+        app->worker.reset();
         try {
             delete app->instance;
         } catch (...) {
@@ -142,6 +417,7 @@ QnnStatus qnn_sample_app_finalize_graphs(QnnSampleApp* app) {
 }
 
 QnnStatus qnn_sample_app_execute_graphs(QnnSampleApp* app) {
+    tracing::TraceSpan span(__func__, "ffi");
     if (!app || !app->instance) return QNN_STATUS_FAILURE;
     try {
         return static_cast<QnnStatus>(app->instance->executeGraphs());
@@ -150,6 +426,117 @@ QnnStatus qnn_sample_app_execute_graphs(QnnSampleApp* app) {
     }
 }
 
+QnnStatus qnn_sample_app_get_binary_load_stats(QnnSampleApp* app, QnnBinaryLoadStats* stats) {
+    if (!app || !app->instance || !stats) return QNN_STATUS_FAILURE;
+    const auto& loadStats = app->instance->getBinaryLoadStats();
+    stats->mapped = loadStats.mapped ? 1 : 0;
+    stats->fileSize = loadStats.fileSize;
+    stats->readMs = loadStats.readMs;
+    stats->binaryInfoMs = loadStats.binaryInfoMs;
+    stats->contextCreateMs = loadStats.contextCreateMs;
+    stats->totalMs = loadStats.totalMs;
+    stats->peakRssBeforeKb = loadStats.peakRssBeforeKb;
+    stats->peakRssAfterKb = loadStats.peakRssAfterKb;
+    stats->heapBytesAvoided = loadStats.heapBytesAvoided;
+    return QNN_STATUS_SUCCESS;
+}
+
+QnnStatus qnn_sample_app_get_startup_stats(QnnSampleApp* app, QnnStartupStats* stats) {
+    if (!app || !app->instance || !stats) return QNN_STATUS_FAILURE;
+    const auto& startup = app->instance->getStartupStats();
+    stats->backendShared = startup.backendShared ? 1 : 0;
+    stats->backendAcquireMs = startup.backendAcquireMs;
+    stats->backendLoadMs = startup.backend.loadMs;
+    stats->backendCreateMs = startup.backend.createMs;
+    stats->deviceCreateMs = startup.backend.deviceCreateMs;
+    stats->powerConfigMs = startup.backend.powerConfigMs;
+    stats->modelLoadMs = startup.modelLoadMs;
+    stats->opPackagesMs = startup.opPackagesMs;
+    stats->cacheLookupMs = startup.cacheLookupMs;
+    stats->contextCreateMs = startup.contextCreateMs;
+    stats->composeGraphsMs = startup.composeGraphsMs;
+    stats->graphConfigMs = startup.graphConfigMs;
+    stats->finalizeGraphsMs = startup.finalizeGraphsMs;
+    stats->cacheStoreMs = startup.cacheStoreMs;
+    stats->binaryMapped = startup.binary.mapped ? 1 : 0;
+    stats->binarySize = startup.binary.fileSize;
+    stats->binaryReadMs = startup.binary.readMs;
+    stats->binaryInfoMs = startup.binary.binaryInfoMs;
+    stats->copyMetadataMs = startup.binary.copyMetadataMs;
+    stats->graphRetrieveMs = startup.binary.graphRetrieveMs;
+    stats->heapBytesAllocated = startup.heapBytesAllocated;
+    stats->peakRssBeforeKb = startup.peakRssBeforeKb;
+    stats->peakRssAfterKb = startup.peakRssAfterKb;
+    stats->totalMs = startup.totalMs;
+    stats->metadataFromSidecar = startup.binary.metadataFromSidecar ? 1 : 0;
+    stats->warmupMs = startup.warmupMs;
+    return QNN_STATUS_SUCCESS;
+}
+
+const char* qnn_sample_app_get_startup_stats_json(QnnSampleApp* app) {
+    if (!app || !app->instance) return nullptr;
+    try {
+        std::string json = app->instance->getStartupStats().toJson();
+        // 复制一份字符串返回，由调用者负责释放
+        char* cstr = (char*)std::malloc(json.size() + 1);
+        if (cstr) {
+            std::strcpy(cstr, json.c_str());
+        }
+        return cstr;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+QnnStatus qnn_sample_app_enable_shared_memory(QnnSampleApp* app, QnnSharedMemoryType type) {
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->enableSharedMemory(
+            static_cast<sharedmem::AllocatorType>(type)));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_get_graph_count(QnnSampleApp* app, size_t* numGraphs) {
+    if (!app || !app->instance || !numGraphs) return QNN_STATUS_FAILURE;
+    *numGraphs = app->instance->getGraphCount();
+    return QNN_STATUS_SUCCESS;
+}
+
+const char* qnn_sample_app_get_graph_name(QnnSampleApp* app, int graphIdx) {
+    if (!app || !app->instance) return nullptr;
+    return app->instance->getGraphName(graphIdx);
+}
+
+int qnn_sample_app_get_graph_index(QnnSampleApp* app, const char* graphName) {
+    if (!app || !app->instance || !graphName) return -1;
+    try {
+        return app->instance->getGraphIndex(graphName);
+    } catch (...) {
+        return -1;
+    }
+}
+
+QnnStatus qnn_sample_app_execute_graph(QnnSampleApp* app, int graphIdx) {
+    tracing::TraceSpan span(__func__, "ffi");
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->executeGraph(graphIdx));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_execute_graph_by_name(QnnSampleApp* app, const char* graphName) {
+    if (!app || !app->instance || !graphName) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->executeGraph(std::string(graphName)));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
 QnnStatus qnn_sample_app_register_op_packages(QnnSampleApp* app) {
     if (!app || !app->instance) return QNN_STATUS_FAILURE;
     try {
@@ -204,6 +591,15 @@ QnnStatus qnn_sample_app_free_graphs(QnnSampleApp* app) {
     }
 }
 
+QnnStatus qnn_sample_app_swap_model(QnnSampleApp* app, const char* modelPath) {
+    if (!app || !app->instance || !modelPath) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->swapModel(modelPath));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
 const char* qnn_sample_app_get_backend_build_id(QnnSampleApp* app) {
     if (!app || !app->instance) return nullptr;
     try {
@@ -251,13 +647,10 @@ QnnStatus qnn_sample_app_load_float_inputs(QnnSampleApp* app,
                                            const size_t* sizes,
                                            size_t numInputs,
                                            int graphIdx) {
-    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    tracing::TraceSpan span(__func__, "ffi");
+    if (!app || !app->instance || !inputs || !sizes) return QNN_STATUS_FAILURE;
     try {
-        std::vector<std::vector<float>> inputData(numInputs);
-        for (size_t i = 0; i < numInputs; ++i) {
-            inputData[i] = std::vector<float>(inputs[i], inputs[i] + sizes[i]);
-        }
-        return static_cast<QnnStatus>(app->instance->loadFloatInputs(inputData, graphIdx));
+        return static_cast<QnnStatus>(app->instance->loadFloatInputs(inputs, sizes, numInputs, graphIdx));
     } catch (...) {
         return QNN_STATUS_FAILURE;
     }
@@ -268,6 +661,7 @@ QnnStatus qnn_sample_app_get_float_outputs(QnnSampleApp* app,
                                            size_t** out_sizes,
                                            size_t* numOutputs,
                                            int graphIdx) {
+    tracing::TraceSpan span(__func__, "ffi");
     if (!app || !app->instance || !outputs || !out_sizes || !numOutputs) return QNN_STATUS_FAILURE;
     try {
         std::vector<std::vector<float>> outputData;
@@ -305,6 +699,434 @@ QnnStatus qnn_sample_app_get_float_outputs(QnnSampleApp* app,
     }
 }
 
+QnnStatus qnn_sample_app_get_input_count(QnnSampleApp* app, int graphIdx, size_t* numInputs) {
+    if (!app || !app->instance || !numInputs) return QNN_STATUS_FAILURE;
+    *numInputs = app->instance->getNumInputTensors(graphIdx);
+    return QNN_STATUS_SUCCESS;
+}
+
+static void toCTensorView(const sample_app::TensorView& tensorView, QnnTensorView* view) {
+    view->name = tensorView.name;
+    view->data = tensorView.data;
+    view->dataSize = tensorView.dataSize;
+    view->dataType = static_cast<QnnTensorDataType>(tensorView.dataType);
+    view->rank = tensorView.rank;
+    view->dims = tensorView.dims;
+    view->scale = tensorView.scale;
+    view->offset = tensorView.offset;
+}
+
+QnnStatus qnn_sample_app_get_input_tensor_view(QnnSampleApp* app,
+                                               int graphIdx,
+                                               size_t inputIdx,
+                                               QnnTensorView* view) {
+    if (!app || !app->instance || !view) return QNN_STATUS_FAILURE;
+    try {
+        sample_app::TensorView tensorView;
+        QnnStatus status = static_cast<QnnStatus>(
+            app->instance->getInputTensorView(static_cast<uint32_t>(inputIdx), tensorView, graphIdx));
+        if (status == QNN_STATUS_SUCCESS) {
+            toCTensorView(tensorView, view);
+        }
+        return status;
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_get_output_count(QnnSampleApp* app, int graphIdx, size_t* numOutputs) {
+    if (!app || !app->instance || !numOutputs) return QNN_STATUS_FAILURE;
+    *numOutputs = app->instance->getNumOutputTensors(graphIdx);
+    return QNN_STATUS_SUCCESS;
+}
+
+QnnStatus qnn_sample_app_get_float_outputs_into(QnnSampleApp* app,
+                                                float** outputs,
+                                                const size_t* capacities,
+                                                size_t numOutputs,
+                                                int graphIdx) {
+    tracing::TraceSpan span(__func__, "ffi");
+    if (!app || !app->instance || !outputs || !capacities) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(
+            app->instance->getFloatOutputsInto(outputs, capacities, numOutputs, graphIdx));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_get_output_tensor_view(QnnSampleApp* app,
+                                                int graphIdx,
+                                                size_t outputIdx,
+                                                QnnTensorView* view) {
+    if (!app || !app->instance || !view) return QNN_STATUS_FAILURE;
+    try {
+        sample_app::TensorView tensorView;
+        QnnStatus status = static_cast<QnnStatus>(
+            app->instance->getOutputTensorView(static_cast<uint32_t>(outputIdx), tensorView, graphIdx));
+        if (status == QNN_STATUS_SUCCESS) {
+            toCTensorView(tensorView, view);
+        }
+        return status;
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_load_native_inputs(QnnSampleApp* app,
+                                            const void** inputs,
+                                            const size_t* sizes,
+                                            size_t numInputs,
+                                            int graphIdx) {
+    tracing::TraceSpan span(__func__, "ffi");
+    if (!app || !app->instance || !inputs || !sizes) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(
+            app->instance->loadNativeInputs(inputs, sizes, numInputs, graphIdx));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_get_native_outputs(QnnSampleApp* app,
+                                            void** outputs,
+                                            const size_t* capacities,
+                                            size_t numOutputs,
+                                            size_t* writtenSizes,
+                                            int graphIdx) {
+    if (!app || !app->instance || !outputs || !capacities) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(
+            app->instance->getNativeOutputs(outputs, capacities, numOutputs, writtenSizes, graphIdx));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_infer(QnnSampleApp* app,
+                               const float** inputs,
+                               const size_t* sizes,
+                               size_t numInputs,
+                               float** outputs,
+                               const size_t* capacities,
+                               size_t numOutputs,
+                               int graphIdx) {
+    tracing::TraceSpan span(__func__, "ffi");
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->infer(
+            inputs, sizes, numInputs, outputs, capacities, numOutputs, graphIdx));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+static void copyWarmupStats(const sample_app::WarmupStats& warmupStats, QnnWarmupStats* stats) {
+    stats->runs = warmupStats.runs;
+    stats->firstRunMs = warmupStats.firstRunMs;
+    stats->steadyStateMs = warmupStats.steadyStateMs;
+    stats->minMs = warmupStats.minMs;
+    stats->maxMs = warmupStats.maxMs;
+    stats->totalMs = warmupStats.totalMs;
+}
+
+QnnStatus qnn_sample_app_warmup(QnnSampleApp* app, unsigned int runs, int graphIdx, QnnWarmupInput input, QnnWarmupStats* stats) {
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        sample_app::WarmupStats warmupStats;
+        auto status = app->instance->warmup(runs, warmupStats, graphIdx,
+                                            static_cast<sample_app::WarmupInput>(input));
+        if (status == sample_app::StatusCode::SUCCESS && stats) {
+            copyWarmupStats(warmupStats, stats);
+        }
+        return static_cast<QnnStatus>(status);
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_get_warmup_stats(QnnSampleApp* app, int graphIdx, QnnWarmupStats* stats) {
+    if (!app || !app->instance || !stats) return QNN_STATUS_FAILURE;
+    sample_app::WarmupStats warmupStats;
+    if (!app->instance->getWarmupStats(graphIdx, warmupStats)) {
+        return QNN_STATUS_FAILURE;
+    }
+    copyWarmupStats(warmupStats, stats);
+    return QNN_STATUS_SUCCESS;
+}
+
+static void copyLatencySummary(const metrics::LatencySummary& src, QnnLatencySummary* dst) {
+    dst->count = src.count;
+    dst->meanUs = src.meanUs;
+    dst->p50Us = src.p50Us;
+    dst->p90Us = src.p90Us;
+    dst->p99Us = src.p99Us;
+    dst->maxUs = src.maxUs;
+}
+
+QnnStatus qnn_sample_app_get_metrics(QnnSampleApp* app, QnnMetrics* metrics, int reset) {
+    if (!app || !app->instance || !metrics) return QNN_STATUS_FAILURE;
+    try {
+        sample_app::Metrics snapshot;
+        app->instance->getMetrics(snapshot, reset != 0);
+        copyLatencySummary(snapshot.inputStaging, &metrics->inputStaging);
+        copyLatencySummary(snapshot.execute, &metrics->execute);
+        copyLatencySummary(snapshot.outputConversion, &metrics->outputConversion);
+        copyLatencySummary(snapshot.infer, &metrics->infer);
+        metrics->executions = snapshot.executions;
+        metrics->failures = snapshot.failures;
+        metrics->bytesConverted = snapshot.bytesConverted;
+        return QNN_STATUS_SUCCESS;
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_set_profiling(QnnSampleApp* app, QnnProfilingLevel level, unsigned int historySize) {
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    if (level < QNN_PROFILING_LEVEL_OFF || level > QNN_PROFILING_LEVEL_DETAILED) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->setProfiling(
+            static_cast<sample_app::ProfilingLevel>(level), historySize));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+size_t qnn_sample_app_get_profile_count(QnnSampleApp* app) {
+    if (!app || !app->instance) return 0;
+    return app->instance->getProfileCount();
+}
+
+QnnStatus qnn_sample_app_get_profile(QnnSampleApp* app, size_t back, QnnExecutionProfileInfo* info, QnnProfileEvent* events, size_t capacity) {
+    if (!app || !app->instance || !info) return QNN_STATUS_FAILURE;
+    try {
+        sample_app::ExecutionProfile profile;
+        if (!app->instance->getProfile(back, profile)) {
+            return QNN_STATUS_FAILURE;
+        }
+        info->sequence = profile.sequence;
+        info->graphIdx = profile.graphIdx;
+        info->async = profile.async ? 1 : 0;
+        info->startUs = profile.startUs;
+        info->wallMs = profile.wallMs;
+        info->numEvents = profile.events.size();
+        if (events) {
+            size_t count = std::min(capacity, profile.events.size());
+            for (size_t i = 0; i < count; i++) {
+                const sample_app::ProfileEvent& event = profile.events[i];
+                events[i].eventId = event.eventId;
+                std::strncpy(events[i].identifier, event.identifier.c_str(), sizeof(events[i].identifier) - 1);
+                events[i].identifier[sizeof(events[i].identifier) - 1] = '\0';
+                events[i].type = event.type;
+                events[i].unit = event.unit;
+                events[i].value = event.value;
+                events[i].parent = event.parent;
+                events[i].depth = event.depth;
+            }
+        }
+        return QNN_STATUS_SUCCESS;
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+const char* qnn_sample_app_get_profiles_json(QnnSampleApp* app, size_t maxCount) {
+    if (!app || !app->instance) return nullptr;
+    try {
+        std::string json = app->instance->getProfilesJson(maxCount);
+        // 复制一份字符串返回，由调用者负责释放
+        char* cstr = (char*)std::malloc(json.size() + 1);
+        if (cstr) {
+            std::strcpy(cstr, json.c_str());
+        }
+        return cstr;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void qnn_sample_app_clear_profiles(QnnSampleApp* app) {
+    if (!app || !app->instance) return;
+    app->instance->clearProfiles();
+}
+
+static bool isValidPowerProfile(QnnPowerProfile profile) {
+    return profile >= QNN_POWER_PROFILE_BURST && profile <= QNN_POWER_PROFILE_LOW_POWER;
+}
+
+QnnStatus qnn_sample_app_set_power_policy(QnnSampleApp* app, QnnPowerProfile active, QnnPowerProfile idle, unsigned int idleTimeoutMs) {
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    if (!isValidPowerProfile(active) || !isValidPowerProfile(idle)) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->setPowerPolicy(
+            static_cast<sample_app::PowerProfile>(active),
+            static_cast<sample_app::PowerProfile>(idle),
+            std::chrono::milliseconds(idleTimeoutMs)));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_pin_power_profile(QnnSampleApp* app, QnnPowerProfile profile) {
+    if (!app || !app->instance || !isValidPowerProfile(profile)) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(
+            app->instance->pinPowerProfile(static_cast<sample_app::PowerProfile>(profile)));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_unpin_power_profile(QnnSampleApp* app) {
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->unpinPowerProfile());
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+int qnn_sample_app_get_power_profile(QnnSampleApp* app) {
+    if (!app || !app->instance) return -1;
+    sample_app::PowerProfile profile;
+    if (!app->instance->getPowerProfile(profile)) {
+        return -1;
+    }
+    return static_cast<int>(profile);
+}
+
+QnnStatus qnn_sample_app_set_tensor_ring_size(QnnSampleApp* app, unsigned int size) {
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->setTensorRingSize(size));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_acquire_tensor_set(QnnSampleApp* app, int graphIdx, unsigned int* setIdx) {
+    if (!app || !app->instance || !setIdx) return QNN_STATUS_FAILURE;
+    try {
+        uint32_t idx = 0;
+        QnnStatus status = static_cast<QnnStatus>(app->instance->acquireTensorSet(graphIdx, idx));
+        if (status == QNN_STATUS_SUCCESS) {
+            *setIdx = idx;
+        }
+        return status;
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_load_float_inputs_to_set(QnnSampleApp* app,
+                                                  int graphIdx,
+                                                  unsigned int setIdx,
+                                                  const float** inputs,
+                                                  const size_t* sizes,
+                                                  size_t numInputs) {
+    tracing::TraceSpan span(__func__, "ffi");
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(
+            app->instance->loadFloatInputsToSet(graphIdx, setIdx, inputs, sizes, numInputs));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_get_tensor_set_input_view(QnnSampleApp* app,
+                                                   int graphIdx,
+                                                   unsigned int setIdx,
+                                                   size_t inputIdx,
+                                                   QnnTensorView* view) {
+    if (!app || !app->instance || !view) return QNN_STATUS_FAILURE;
+    try {
+        sample_app::TensorView tensorView;
+        QnnStatus status = static_cast<QnnStatus>(app->instance->getTensorSetInputView(
+            graphIdx, setIdx, static_cast<uint32_t>(inputIdx), tensorView));
+        if (status == QNN_STATUS_SUCCESS) {
+            toCTensorView(tensorView, view);
+        }
+        return status;
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_get_tensor_set_output_view(QnnSampleApp* app,
+                                                    int graphIdx,
+                                                    unsigned int setIdx,
+                                                    size_t outputIdx,
+                                                    QnnTensorView* view) {
+    if (!app || !app->instance || !view) return QNN_STATUS_FAILURE;
+    try {
+        sample_app::TensorView tensorView;
+        QnnStatus status = static_cast<QnnStatus>(app->instance->getTensorSetOutputView(
+            graphIdx, setIdx, static_cast<uint32_t>(outputIdx), tensorView));
+        if (status == QNN_STATUS_SUCCESS) {
+            toCTensorView(tensorView, view);
+        }
+        return status;
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_submit_tensor_set(QnnSampleApp* app, int graphIdx, unsigned int setIdx) {
+    tracing::TraceSpan span(__func__, "ffi");
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->submitTensorSet(graphIdx, setIdx));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_get_float_outputs_from_set(QnnSampleApp* app,
+                                                    int graphIdx,
+                                                    unsigned int setIdx,
+                                                    float** outputs,
+                                                    const size_t* capacities,
+                                                    size_t numOutputs) {
+    tracing::TraceSpan span(__func__, "ffi");
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->getFloatOutputsFromSet(
+            graphIdx, setIdx, outputs, capacities, numOutputs));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+QnnStatus qnn_sample_app_release_tensor_set(QnnSampleApp* app, int graphIdx, unsigned int setIdx) {
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(app->instance->releaseTensorSet(graphIdx, setIdx));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+int qnn_sample_app_supports_async_execution(QnnSampleApp* app) {
+    if (!app || !app->instance) return 0;
+    try {
+        return app->instance->supportsAsyncExecution() ? 1 : 0;
+    } catch (...) {
+        return 0;
+    }
+}
+
+QnnStatus qnn_sample_app_set_max_in_flight(QnnSampleApp* app, unsigned int maxInFlight) {
+    if (!app || !app->instance) return QNN_STATUS_FAILURE;
+    return static_cast<QnnStatus>(app->instance->setMaxInFlight(maxInFlight));
+}
+
+void qnn_sample_app_wait_async_executions(QnnSampleApp* app) {
+    if (!app || !app->instance) return;
+    app->instance->waitForAsyncExecutions();
+}
+
 int qnn_get_htp_arch_version(const char* backendPath) {
     if (!backendPath) {
         __android_log_print(ANDROID_LOG_ERROR, "QnnWrapper", "后端路径为空");
@@ -350,7 +1172,7 @@ void qnn_sample_app_create_async(const char* backendPath,
     __android_log_print(ANDROID_LOG_INFO, "QnnWrapper", "模型路径: %s", modelPathCopy.c_str());
     __android_log_print(ANDROID_LOG_INFO, "QnnWrapper", "数据目录: %s", dataDirCopy.c_str());
 
-    std::thread([=, backendPathCopy = std::move(backendPathCopy), 
+    taskqueue::sharedPool().submit([=, backendPathCopy = std::move(backendPathCopy), 
                    modelPathCopy = std::move(modelPathCopy),
                    dataDirCopy = std::move(dataDirCopy)]() {
         __android_log_print(ANDROID_LOG_INFO, "QnnWrapper", "异步线程启动");
@@ -385,88 +1207,104 @@ void qnn_sample_app_create_async(const char* backendPath,
                 callback(nullptr, userData);
             }
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_destroy_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    // 作为实例工作线程上的最后一个任务执行：之前提交的任务都已完成，也不占用共享线程池。
+    // TaskQueue 在自身工作线程中析构时会 detach 该线程，任务返回后线程自行退出
+    auto destroyTask = [=]() {
         qnn_sample_app_destroy(app);
         if (callback) {
             callback(QNN_STATUS_SUCCESS, userData);
         }
-    }).detach();
+    };
+    if (app && app->worker) {
+        app->worker->submit(destroyTask);
+    } else {
+        std::thread(destroyTask).detach();
+    }
 }
 
 void qnn_sample_app_initialize_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_initialize(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_initialize_profiling_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_initialize_profiling(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_create_context_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_create_context(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_compose_graphs_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_compose_graphs(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_finalize_graphs_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_finalize_graphs(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_execute_graphs_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_execute_graphs(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
+}
+
+void qnn_sample_app_execute_graph_async(QnnSampleApp* app, int graphIdx, QnnAsyncCallback callback, void* userData) {
+    submitToApp(app, [=]() {
+        QnnStatus status = qnn_sample_app_execute_graph(app, graphIdx);
+        if (callback) {
+            callback(status, userData);
+        }
+    });
 }
 
 void qnn_sample_app_register_op_packages_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_register_op_packages(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_create_from_binary_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_create_from_binary(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_save_binary_async(QnnSampleApp* app, const char* outputPath, const char* binaryName, QnnAsyncCallback callback, void* userData) {
@@ -474,88 +1312,99 @@ void qnn_sample_app_save_binary_async(QnnSampleApp* app, const char* outputPath,
     std::string outputPathCopy(outputPath ? outputPath : "");
     std::string binaryNameCopy(binaryName ? binaryName : "");
     
-    std::thread([=, outputPathCopy = std::move(outputPathCopy), binaryNameCopy = std::move(binaryNameCopy)]() {
+    submitToApp(app, [=, outputPathCopy = std::move(outputPathCopy), binaryNameCopy = std::move(binaryNameCopy)]() {
         QnnStatus status = qnn_sample_app_save_binary(app, outputPathCopy.c_str(), binaryNameCopy.c_str());
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_free_context_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_free_context(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_terminate_backend_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_terminate_backend(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_free_graphs_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_free_graphs(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
+}
+
+void qnn_sample_app_swap_model_async(QnnSampleApp* app, const char* modelPath, QnnAsyncCallback callback, void* userData) {
+    std::string modelPathCopy(modelPath ? modelPath : "");
+
+    submitToApp(app, [=, modelPathCopy = std::move(modelPathCopy)]() {
+        QnnStatus status = qnn_sample_app_swap_model(app, modelPathCopy.c_str());
+        if (callback) {
+            callback(status, userData);
+        }
+    });
 }
 
 void qnn_sample_app_get_backend_build_id_async(QnnSampleApp* app, QnnStringCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         const char* buildId = qnn_sample_app_get_backend_build_id(app);
         if (callback) {
             callback(buildId ? QNN_STATUS_SUCCESS : QNN_STATUS_FAILURE, buildId, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_is_device_property_supported_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_is_device_property_supported(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_create_device_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_create_device(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_free_device_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_free_device(app);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_load_float_inputs_async(QnnSampleApp* app, const float** inputs, const size_t* sizes, size_t numInputs, int graphIdx, QnnAsyncCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         QnnStatus status = qnn_sample_app_load_float_inputs(app, inputs, sizes, numInputs, graphIdx);
         if (callback) {
             callback(status, userData);
         }
-    }).detach();
+    });
 }
 
 void qnn_sample_app_get_float_outputs_async(QnnSampleApp* app, int graphIdx, QnnFloatOutputCallback callback, void* userData) {
-    std::thread([=]() {
+    submitToApp(app, [=]() {
         float** outputs = nullptr;
         size_t* sizes = nullptr;
         size_t numOutputs = 0;
@@ -570,18 +1419,173 @@ void qnn_sample_app_get_float_outputs_async(QnnSampleApp* app, int graphIdx, Qnn
         // }
         // free(outputs);
         // free(sizes);
-    }).detach();
+    });
+}
+
+void qnn_sample_app_infer_async(QnnSampleApp* app, const float** inputs, const size_t* sizes, size_t numInputs, float** outputs, const size_t* capacities, size_t numOutputs, int graphIdx, QnnAsyncCallback callback, void* userData) {
+    submitToApp(app, [=]() {
+        QnnStatus status = qnn_sample_app_infer(app, inputs, sizes, numInputs, outputs, capacities, numOutputs, graphIdx);
+        if (callback) {
+            callback(status, userData);
+        }
+    });
+}
+
+void qnn_sample_app_warmup_async(QnnSampleApp* app, unsigned int runs, int graphIdx, QnnWarmupInput input, QnnAsyncCallback callback, void* userData) {
+    submitToApp(app, [=]() {
+        QnnStatus status = qnn_sample_app_warmup(app, runs, graphIdx, input, nullptr);
+        if (callback) {
+            callback(status, userData);
+        }
+    });
+}
+
+QnnStatus qnn_sample_app_submit_tensor_set_async(QnnSampleApp* app, int graphIdx, unsigned int setIdx, QnnAsyncCallback callback, void* userData) {
+    // 优先使用 backend 原生的 graphExecuteAsync，不支持时退回实例工作线程上的同步执行
+    if (app && app->instance) {
+        sample_app::StatusCode status = sample_app::StatusCode::QNN_FEATURE_UNSUPPORTED;
+        try {
+            status = app->instance->submitTensorSetAsync(
+                graphIdx, setIdx, [callback, userData](sample_app::StatusCode doneStatus) {
+                    if (callback) {
+                        callback(static_cast<QnnStatus>(doneStatus), userData);
+                    }
+                });
+        } catch (...) {
+            status = sample_app::StatusCode::FAILURE;
+        }
+        if (status == sample_app::StatusCode::BUSY) {
+            return QNN_STATUS_BUSY;
+        }
+        if (status != sample_app::StatusCode::QNN_FEATURE_UNSUPPORTED) {
+            // 失败回调也走实例工作线程，调用线程上不执行任何回调
+            if (status != sample_app::StatusCode::SUCCESS && callback) {
+                submitToApp(app, [=]() {
+                    callback(static_cast<QnnStatus>(status), userData);
+                });
+            }
+            return QNN_STATUS_SUCCESS;
+        }
+    }
+    submitToApp(app, [=]() {
+        QnnStatus status = qnn_sample_app_submit_tensor_set(app, graphIdx, setIdx);
+        if (callback) {
+            callback(status, userData);
+        }
+    });
+    return QNN_STATUS_SUCCESS;
 }
 
 void qnn_get_htp_arch_version_async(const char* backendPath, QnnArchVersionCallback callback, void* userData) {
     std::string backendPathCopy(backendPath ? backendPath : "");
     
-    std::thread([=, backendPathCopy = std::move(backendPathCopy)]() {
+    taskqueue::sharedPool().submit([=, backendPathCopy = std::move(backendPathCopy)]() {
         int version = qnn_get_htp_arch_version(backendPathCopy.c_str());
         if (callback) {
             callback(version, userData);
         }
-    }).detach();
+    });
+}
+
+QnnBatchScheduler* qnn_batch_scheduler_create(QnnSampleApp* app, int graphIdx, unsigned int maxDelayUs) {
+    if (!app || !app->instance) return nullptr;
+    try {
+        auto scheduler = new QnnBatchScheduler();
+        try {
+            // 整批推理投递到实例工作线程，与该实例的其它异步调用串行执行
+            scheduler->instance.reset(new sample_app::BatchScheduler(
+                app->instance, graphIdx, std::chrono::microseconds(maxDelayUs),
+                [app](std::function<void()> task) { submitToApp(app, std::move(task)); }));
+        } catch (...) {
+            delete scheduler;
+            throw;
+        }
+        return scheduler;
+    } catch (const std::exception& e) {
+        __android_log_print(ANDROID_LOG_ERROR, "QnnWrapper", "创建合批调度器失败: %s", e.what());
+        return nullptr;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void qnn_batch_scheduler_destroy(QnnBatchScheduler* scheduler) {
+    if (scheduler) {
+        try {
+            scheduler->instance.reset();
+        } catch (...) {
+            // 忽略异常
+        }
+        delete scheduler;
+    }
+}
+
+unsigned int qnn_batch_scheduler_get_batch_size(QnnBatchScheduler* scheduler) {
+    if (!scheduler || !scheduler->instance) return 0;
+    return scheduler->instance->batchSize();
+}
+
+QnnStatus qnn_batch_scheduler_submit(QnnBatchScheduler* scheduler,
+                                     const float** inputs,
+                                     const size_t* sizes,
+                                     size_t numInputs,
+                                     float** outputs,
+                                     const size_t* capacities,
+                                     size_t numOutputs,
+                                     QnnAsyncCallback callback,
+                                     void* userData) {
+    if (!scheduler || !scheduler->instance) return QNN_STATUS_FAILURE;
+    try {
+        return static_cast<QnnStatus>(scheduler->instance->submit(
+            inputs, sizes, numInputs, outputs, capacities, numOutputs,
+            [callback, userData](sample_app::StatusCode status) {
+                if (callback) {
+                    callback(static_cast<QnnStatus>(status), userData);
+                }
+            }));
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+void qnn_batch_scheduler_flush(QnnBatchScheduler* scheduler) {
+    if (!scheduler || !scheduler->instance) return;
+    scheduler->instance->flush();
+}
+
+void qnn_trace_start(size_t capacity) {
+    tracing::Tracer::instance().start(capacity);
+}
+
+void qnn_trace_stop(void) {
+    tracing::Tracer::instance().stop();
+}
+
+QnnStatus qnn_trace_write(const char* path) {
+    if (!path) return QNN_STATUS_FAILURE;
+    try {
+        return tracing::Tracer::instance().writeJson(path) ? QNN_STATUS_SUCCESS : QNN_STATUS_FAILURE;
+    } catch (...) {
+        return QNN_STATUS_FAILURE;
+    }
+}
+
+const char* qnn_trace_get_json(void) {
+    try {
+        std::string json = tracing::Tracer::instance().toJson();
+        // 复制一份字符串返回，由调用者负责释放
+        char* cstr = (char*)std::malloc(json.size() + 1);
+        if (cstr) {
+            std::strcpy(cstr, json.c_str());
+        }
+        return cstr;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void qnn_trace_clear(void) {
+    tracing::Tracer::instance().clear();
 }
 
 } // extern "C"
\ No newline at end of file
@@ -14,7 +14,8 @@ typedef enum {
     QNN_STATUS_FAILURE_INPUT_LIST_EXHAUSTED,
     QNN_STATUS_FAILURE_SYSTEM_ERROR,
     QNN_STATUS_FAILURE_SYSTEM_COMMUNICATION_ERROR,
-    QNN_STATUS_FEATURE_UNSUPPORTED
+    QNN_STATUS_FEATURE_UNSUPPORTED,
+    QNN_STATUS_BUSY                 // 资源暂时用尽，调用未生效，可稍后重试
 } QnnStatus;
 
 // 定义输出数据类型
@@ -39,21 +40,215 @@ typedef enum {
     QNN_HTP_PRECISION_MODE_DEFAULT = 0x7FFFFFFF
 } QnnHtpPrecisionMode;
 
-// 定义HTP后端配置结构体
+// 定义HTP后端配置结构体，先用 qnn_htp_config_init 填充默认值再修改需要的字段。
+// 在 finalize 之前校验并应用到每张图，只对 .so 模型生效（.bin 和编译缓存命中时图已编译完成）；
+// 通过本结构体给出的取值无效、设备不支持或 graphSetConfig 失败时创建失败；不传时使用默认配置，失败只记录警告
 typedef struct {
-    int optimizationLevel;      // 优化级别(0-3)，3为最佳性能
-    QnnHtpPrecisionMode precisionMode;  // 精度模式
+    int optimizationLevel;      // 优化级别(1-3)，3为最佳性能，默认 2
+    QnnHtpPrecisionMode precisionMode;  // 精度模式，默认 FLOAT16，DEFAULT 表示由 backend 决定
+    unsigned int vtcmSizeMb;    // VTCM 大小(MB)，0 表示设备最大值，不能超过设备 VTCM 大小
+    unsigned long long numHvxThreads;   // HVX 线程数，0 表示不限制
+    int enableDlbc;             // -1 自动（默认），仅在设备报告支持时启用；0 关闭；1 启用，需要设备支持
+    int enableDlbcWeights;      // 1 启用权重 DLBC，默认关闭
 } QnnBackendHtpConfig;
 
+// 定义张量数据类型，取值和 QNN 中 Qnn_DataType_t 保持一致
+typedef enum {
+    QNN_TENSOR_DATA_TYPE_INT_8 = 0x0008,
+    QNN_TENSOR_DATA_TYPE_INT_16 = 0x0016,
+    QNN_TENSOR_DATA_TYPE_INT_32 = 0x0032,
+    QNN_TENSOR_DATA_TYPE_INT_64 = 0x0064,
+    QNN_TENSOR_DATA_TYPE_UINT_8 = 0x0108,
+    QNN_TENSOR_DATA_TYPE_UINT_16 = 0x0116,
+    QNN_TENSOR_DATA_TYPE_UINT_32 = 0x0132,
+    QNN_TENSOR_DATA_TYPE_UINT_64 = 0x0164,
+    QNN_TENSOR_DATA_TYPE_FLOAT_16 = 0x0216,
+    QNN_TENSOR_DATA_TYPE_FLOAT_32 = 0x0232,
+    QNN_TENSOR_DATA_TYPE_SFIXED_POINT_8 = 0x0308,
+    QNN_TENSOR_DATA_TYPE_SFIXED_POINT_16 = 0x0316,
+    QNN_TENSOR_DATA_TYPE_UFIXED_POINT_8 = 0x0408,
+    QNN_TENSOR_DATA_TYPE_UFIXED_POINT_16 = 0x0416,
+    QNN_TENSOR_DATA_TYPE_BOOL_8 = 0x0508,
+    QNN_TENSOR_DATA_TYPE_UNDEFINED = 0x7FFFFFFF
+} QnnTensorDataType;
+
+/*
+ * 张量视图：借用 QnnSampleApp 内部持久化张量的缓冲区，不拥有内存，调用者不能释放。
+ * data/dims/name 在切换图或销毁实例之前一直有效。
+ * scale/offset 为量化参数，仅对 FIXED_POINT 类型有意义，反量化公式为 (q + offset) * scale。
+ */
+typedef struct {
+    const char* name;
+    void* data;
+    size_t dataSize;                // 缓冲区字节数
+    QnnTensorDataType dataType;
+    unsigned int rank;
+    const unsigned int* dims;
+    float scale;
+    int offset;
+} QnnTensorView;
+
+// context binary 加载统计，字段含义同 C++ 中 sample_app::BinaryLoadStats
+typedef struct {
+    int mapped;                       // 1 表示通过 mmap 加载
+    unsigned long long fileSize;
+    double readMs;
+    double binaryInfoMs;
+    double contextCreateMs;
+    double totalMs;
+    unsigned long long peakRssBeforeKb;
+    unsigned long long peakRssAfterKb;
+    unsigned long long heapBytesAvoided;
+} QnnBinaryLoadStats;
+
+// 实例创建各阶段耗时（毫秒）与内存统计，字段含义同 C++ 中 sample_app::StartupStats
+typedef struct {
+    int backendShared;                // 1 表示复用了已有的共享 backend，backend 各项为 0
+    double backendAcquireMs;
+    double backendLoadMs;             // dlOpen + QnnInterface_getProviders
+    double backendCreateMs;
+    double deviceCreateMs;
+    double powerConfigMs;
+    double modelLoadMs;
+    double opPackagesMs;
+    double cacheLookupMs;
+    double contextCreateMs;           // contextCreate 或 contextCreateFromBinary
+    double composeGraphsMs;
+    double graphConfigMs;
+    double finalizeGraphsMs;
+    double cacheStoreMs;
+    int binaryMapped;
+    unsigned long long binarySize;
+    double binaryReadMs;
+    double binaryInfoMs;              // systemContextGetBinaryInfo（含 copyMetadataMs）或 sidecar 读取
+    double copyMetadataMs;
+    double graphRetrieveMs;
+    unsigned long long heapBytesAllocated;
+    unsigned long long peakRssBeforeKb;
+    unsigned long long peakRssAfterKb;
+    double totalMs;
+    int metadataFromSidecar;          // 图信息来自 "<binary>.graphinfo"，跳过了 binary info 解析
+    double warmupMs;                  // 创建时自动预热所有图的耗时，未启用为 0
+} QnnStartupStats;
+
+// 创建实例的可选项，字段为 0/NULL 时使用默认行为
+typedef struct {
+    const char* cacheDir;             // 编译缓存目录，含义同 qnn_sample_app_create_with_cache
+    unsigned long long maxCacheBytes;
+    unsigned int warmupRuns;          // 大于 0 时在创建结束前对每张图自动预热该次数
+    const QnnBackendHtpConfig* htpConfig;  // HTP 图配置，NULL 使用默认值，非 HTP 后端忽略
+} QnnCreateOptions;
+
+// 预热时输入的填充方式，与 C++ 中 sample_app::WarmupInput 保持一致
+typedef enum {
+    QNN_WARMUP_INPUT_ZEROS = 0,
+    QNN_WARMUP_INPUT_RANDOM         // 固定种子的伪随机数据
+} QnnWarmupInput;
+
+// 预热得到的单次执行耗时（毫秒）
+typedef struct {
+    unsigned int runs;
+    double firstRunMs;                // 第一次执行
+    double steadyStateMs;             // 其余各次的中位数
+    double minMs;
+    double maxMs;
+    double totalMs;
+} QnnWarmupStats;
+
+// 耗时分位数（微秒），来自常开的对数直方图，相对误差约 3%
+typedef struct {
+    unsigned long long count;
+    double meanUs;
+    double p50Us;
+    double p90Us;
+    double p99Us;
+    double maxUs;                   // 精确值
+} QnnLatencySummary;
+
+// 实例的运行时指标
+typedef struct {
+    QnnLatencySummary inputStaging;      // float 输入量化写入张量
+    QnnLatencySummary execute;           // graphExecute，原生异步执行为提交到完成
+    QnnLatencySummary outputConversion;  // 输出反量化为 float
+    QnnLatencySummary infer;             // qnn_sample_app_infer 端到端
+    unsigned long long executions;       // 执行次数，含失败
+    unsigned long long failures;
+    unsigned long long bytesConverted;   // 输入/输出 float 数据的字节数
+} QnnMetrics;
+
+// 性能分析级别，与 C++ 中 sample_app::ProfilingLevel 保持一致
+typedef enum {
+    QNN_PROFILING_LEVEL_OFF = 0,
+    QNN_PROFILING_LEVEL_BASIC,      // 图级别的执行耗时
+    QNN_PROFILING_LEVEL_DETAILED    // 额外包含逐节点的子事件
+} QnnProfilingLevel;
+
+// 一个性能分析事件，事件树按先序遍历展开，通过 parent 还原层级
+typedef struct {
+    unsigned long long eventId;
+    char identifier[128];           // 事件或节点名，过长时截断
+    unsigned int type;              // QnnProfile_EventType_t
+    unsigned int unit;              // QnnProfile_EventUnit_t
+    unsigned long long value;
+    int parent;                     // 父事件下标，顶层事件为 -1
+    unsigned int depth;
+} QnnProfileEvent;
+
+// 一次执行的性能分析概要
+typedef struct {
+    unsigned long long sequence;    // 实例内递增的执行序号
+    int graphIdx;
+    int async;                      // 1 表示原生异步执行
+    unsigned long long startUs;     // 单调时钟时间戳（微秒）
+    double wallMs;                  // 同步执行为 graphExecute 耗时，异步执行为提交到完成
+    size_t numEvents;
+} QnnExecutionProfileInfo;
+
+// HTP 性能档位，与 C++ 中 sample_app::PowerProfile 保持一致
+typedef enum {
+    QNN_POWER_PROFILE_BURST = 0,    // 锁定 turbo，延迟最低
+    QNN_POWER_PROFILE_SUSTAINED,    // nom+ 附近，适合长时间连续推理
+    QNN_POWER_PROFILE_BALANCED,     // DCVS 按负载调整
+    QNN_POWER_PROFILE_LOW_POWER     // 省电，适合空闲或后台任务
+} QnnPowerProfile;
+
+// 共享内存分配器类型，和 C++ 中 sharedmem::AllocatorType 保持一致
+typedef enum {
+    QNN_SHARED_MEMORY_AUTO = 0,   // 优先 rpcmem，不可用时使用 memfd
+    QNN_SHARED_MEMORY_RPCMEM,
+    QNN_SHARED_MEMORY_MEMFD
+} QnnSharedMemoryType;
+
 // 不透明指针类型，用户只能通过接口操作
 typedef struct QnnSampleApp QnnSampleApp;
+typedef struct QnnModelLoader QnnModelLoader;
+
+// 分阶段加载的当前阶段，与 C++ 中 sample_app::LoadStage 保持一致
+typedef enum {
+    QNN_LOAD_STAGE_PENDING = 0,
+    QNN_LOAD_STAGE_PREPARING,   // 并行：backend 初始化 + 模型文件预读
+    QNN_LOAD_STAGE_CREATING,    // context 创建/反序列化、finalize、预热
+    QNN_LOAD_STAGE_READY,
+    QNN_LOAD_STAGE_FAILED
+} QnnLoadStage;
+
+// 分阶段加载的耗时（毫秒），backendMs 与 prefetchMs 并行，prepareMs 为该阶段的实际耗时
+typedef struct {
+    double queuedMs;
+    double backendMs;
+    double prefetchMs;
+    double prepareMs;
+    double createMs;
+    double totalMs;
+} QnnLoadTimings;
 
 /* 
  * 创建 QnnSampleApp 对象。
  * 参数 backendPath 和 modelPath 为后端库及模型库文件路径，
  * outputDataType 与 inputDataType 为数据类型枚举值。
- * dataDir 为应用数据目录路径，用于切换工作目录。
- * htpConfig 为HTP后端特定配置，如果不是HTP后端则忽略。
+ * dataDir 为应用数据目录路径，非空时把进程工作目录切换过去；工作目录是进程级状态，
+ * 会影响其它线程，各创建/加载接口之间对切换目录串行，并在切换后立即把相对路径解析为绝对路径。
+ * HTP 后端的图配置通过 qnn_sample_app_create_with_options 传入，这里使用默认值。
  * 如果创建失败返回 NULL。
  */
 QnnSampleApp* qnn_sample_app_create(const char* backendPath, 
@@ -63,6 +258,80 @@ QnnSampleApp* qnn_sample_app_create(const char* backendPath,
                                     const char* dataDir
                                    );
 
+/*
+ * 与 qnn_sample_app_create 相同，但对 .so 模型启用编译缓存：
+ * 首次启动编译并 finalize 后把 context 序列化到 cacheDir，之后的启动直接走二进制加载路径。
+ * 缓存 key 由模型文件内容、backend build id、SoC/arch 和后端配置决定，任一变化都会重新编译；
+ * 缓存加载失败时自动删除该缓存并重新编译。
+ * maxCacheBytes 为缓存目录总大小上限，超出时删除最久未使用的缓存，传 0 使用默认值（2 GB）。
+ * cacheDir 为 NULL 或空串时等同于 qnn_sample_app_create；.bin 模型忽略缓存参数。
+ */
+QnnSampleApp* qnn_sample_app_create_with_cache(const char* backendPath,
+                                               const char* modelPath,
+                                               QnnOutputDataType outputDataType,
+                                               QnnInputDataType inputDataType,
+                                               const char* dataDir,
+                                               const char* cacheDir,
+                                               unsigned long long maxCacheBytes);
+
+/* 用默认值填充 HTP 图配置 */
+void qnn_htp_config_init(QnnBackendHtpConfig* config);
+
+/*
+ * 与 qnn_sample_app_create 相同，额外选项见 QnnCreateOptions，options 为 NULL 时等同于 qnn_sample_app_create。
+ * 启用 warmupRuns 时返回的实例已经过预热，第一次请求即为稳态速度。
+ */
+QnnSampleApp* qnn_sample_app_create_with_options(const char* backendPath,
+                                                 const char* modelPath,
+                                                 QnnOutputDataType outputDataType,
+                                                 QnnInputDataType inputDataType,
+                                                 const char* dataDir,
+                                                 const QnnCreateOptions* options);
+
+/* 本实例是否命中编译缓存（1 命中，0 未命中或未启用） */
+int qnn_sample_app_is_loaded_from_cache(QnnSampleApp* app);
+
+/*
+ * 非阻塞的分阶段加载：立即返回加载句柄，加载在独立线程上进行。
+ * 同时启动多个即可并行加载多个模型，同一 backend 只初始化一次。
+ * 参数与 qnn_sample_app_create_with_cache 相同，cacheDir 可为 NULL。
+ */
+QnnModelLoader* qnn_model_loader_start(const char* backendPath,
+                                       const char* modelPath,
+                                       QnnOutputDataType outputDataType,
+                                       QnnInputDataType inputDataType,
+                                       const char* dataDir,
+                                       const char* cacheDir,
+                                       unsigned long long maxCacheBytes);
+
+/* 与 qnn_model_loader_start 相同，额外选项见 QnnCreateOptions，options 可为 NULL */
+QnnModelLoader* qnn_model_loader_start_with_options(const char* backendPath,
+                                                    const char* modelPath,
+                                                    QnnOutputDataType outputDataType,
+                                                    QnnInputDataType inputDataType,
+                                                    const char* dataDir,
+                                                    const QnnCreateOptions* options);
+
+/* 轮询当前阶段 */
+QnnLoadStage qnn_model_loader_get_stage(QnnModelLoader* loader);
+
+/* 等待加载结束或超时，返回当时的阶段；timeoutMs 为负表示一直等待 */
+QnnLoadStage qnn_model_loader_wait(QnnModelLoader* loader, int timeoutMs);
+
+QnnStatus qnn_model_loader_get_timings(QnnModelLoader* loader, QnnLoadTimings* timings);
+
+/* 失败原因，返回的字符串由调用者负责释放 */
+const char* qnn_model_loader_get_error(QnnModelLoader* loader);
+
+/*
+ * READY 后取走实例，只能取一次，之后由调用者通过 qnn_sample_app_destroy 释放；
+ * 未就绪返回 NULL。分配句柄失败时也返回 NULL，实例仍留在加载器中，可以再次调用。
+ */
+QnnSampleApp* qnn_model_loader_take_app(QnnModelLoader* loader);
+
+/* 等待加载线程结束并释放句柄，未取走的实例一并释放 */
+void qnn_model_loader_destroy(QnnModelLoader* loader);
+
 /* 释放 QnnSampleApp 对象 */
 void qnn_sample_app_destroy(QnnSampleApp* app);
 
@@ -80,6 +349,53 @@ QnnStatus qnn_sample_app_free_context(QnnSampleApp* app);
 QnnStatus qnn_sample_app_terminate_backend(QnnSampleApp* app);
 QnnStatus qnn_sample_app_free_graphs(QnnSampleApp* app);
 
+/*
+ * 热切换模型：保留 backend、device 和 HTP 性能投票，只把 context 和图替换为 modelPath（.bin）中的内容，
+ * 切换耗时基本只有 context 反序列化。在途的原生异步执行先在旧图上完成，同步执行阻塞到切换结束后
+ * 在新图上运行（图索引在新模型中不存在时返回失败）。之前取得的张量视图和图名称指针在切换后失效。
+ * 流水线张量组需全部释放，合批调度器需先销毁。新模型加载失败时保留原模型，实例可以继续使用。
+ * _async 版本排在该实例此前提交的异步调用之后执行。
+ */
+QnnStatus qnn_sample_app_swap_model(QnnSampleApp* app, const char* modelPath);
+
+/*
+ * 获取 .bin 模型加载的耗时与内存统计，非 .bin 模型各字段为 0。
+ */
+QnnStatus qnn_sample_app_get_binary_load_stats(QnnSampleApp* app, QnnBinaryLoadStats* stats);
+
+/*
+ * 获取实例创建（冷启动）各阶段的耗时与内存统计，用于跟踪 SDK 升级前后的回归。
+ * _json 版本返回同样内容的 JSON 字符串，由调用者负责释放。
+ */
+QnnStatus qnn_sample_app_get_startup_stats(QnnSampleApp* app, QnnStartupStats* stats);
+const char* qnn_sample_app_get_startup_stats_json(QnnSampleApp* app);
+
+/*
+ * 张量内存改为可共享的 fd 内存（rpcmem / memfd）并通过 memRegister 注册，执行时 backend 直接访问，
+ * 省去每次执行的输入/输出拷贝。输入/输出视图等接口的用法不变。
+ * 必须在首次加载输入或获取视图之前调用；backend 不支持 memRegister 时返回 QNN_STATUS_FEATURE_UNSUPPORTED。
+ */
+QnnStatus qnn_sample_app_enable_shared_memory(QnnSampleApp* app, QnnSharedMemoryType type);
+
+/*
+ * 多图支持：每张图有独立的持久化输入/输出张量，首次使用时分配，切换图不会重新分配。
+ * qnn_sample_app_execute_graphs 执行最近一次加载输入的图（默认图 0）。
+ */
+QnnStatus qnn_sample_app_get_graph_count(QnnSampleApp* app, size_t* numGraphs);
+
+/*
+ * 获取图名称，返回的字符串归实例所有，在下一次切换模型或实例销毁前有效；索引无效时返回 NULL。
+ */
+const char* qnn_sample_app_get_graph_name(QnnSampleApp* app, int graphIdx);
+
+/*
+ * 按名称查找图索引，找不到时返回 -1。
+ */
+int qnn_sample_app_get_graph_index(QnnSampleApp* app, const char* graphName);
+
+QnnStatus qnn_sample_app_execute_graph(QnnSampleApp* app, int graphIdx);
+QnnStatus qnn_sample_app_execute_graph_by_name(QnnSampleApp* app, const char* graphName);
+
 /*
  * 获取后端生成的版本号字符串。
  * 返回的字符串由内部动态分配，调用者需要使用 free() 释放。
@@ -111,6 +427,176 @@ QnnStatus qnn_sample_app_get_float_outputs(QnnSampleApp* app,
                                            size_t* numOutputs,
                                            int graphIdx);
 
+/*
+ * 获取指定图的输入张量个数。
+ */
+QnnStatus qnn_sample_app_get_input_count(QnnSampleApp* app, int graphIdx, size_t* numInputs);
+
+/*
+ * 零拷贝输入：获取第 inputIdx 个输入张量的缓冲区视图。
+ * 调用者按 dataType / 量化参数直接写入 view->data（最多 dataSize 字节），
+ * 然后调用 qnn_sample_app_execute_graphs 即可，无需再调用 load_float_inputs。
+ * 首次调用时会为该图分配持久化张量。
+ */
+QnnStatus qnn_sample_app_get_input_tensor_view(QnnSampleApp* app,
+                                               int graphIdx,
+                                               size_t inputIdx,
+                                               QnnTensorView* view);
+
+/*
+ * 获取指定图的输出张量个数。
+ */
+QnnStatus qnn_sample_app_get_output_count(QnnSampleApp* app, int graphIdx, size_t* numOutputs);
+
+/*
+ * 将浮点输出直接反量化到调用者预先分配的缓冲区中，不在内部分配内存。
+ * outputs 为各输出缓冲区指针数组，capacities 为各缓冲区可容纳的 float 个数，
+ * numOutputs 为缓冲区个数，必须不少于模型的输出张量个数。
+ * 所需容量可以通过 qnn_sample_app_get_output_tensor_view 的 dims 计算。
+ */
+QnnStatus qnn_sample_app_get_float_outputs_into(QnnSampleApp* app,
+                                                float** outputs,
+                                                const size_t* capacities,
+                                                size_t numOutputs,
+                                                int graphIdx);
+
+/*
+ * 只读输出视图：获取第 outputIdx 个输出张量的原生缓冲区视图及其量化参数。
+ * 调用者不得写入或释放 view->data，数据在下一次执行后被覆盖。
+ */
+QnnStatus qnn_sample_app_get_output_tensor_view(QnnSampleApp* app,
+                                                int graphIdx,
+                                                size_t outputIdx,
+                                                QnnTensorView* view);
+
+/*
+ * 按张量原生数据类型加载输入（如 uint8 像素、int32 token id、fp16），不做量化。
+ * inputs 为各输入原始数据指针，sizes 为各输入的字节数，必须与张量的字节数完全一致。
+ * 如果 inputs[i] 就是输入视图的 data 指针，则跳过拷贝。
+ */
+QnnStatus qnn_sample_app_load_native_inputs(QnnSampleApp* app,
+                                            const void** inputs,
+                                            const size_t* sizes,
+                                            size_t numInputs,
+                                            int graphIdx);
+
+/*
+ * 按原生数据类型拷贝输出原始字节到调用者提供的缓冲区，不做反量化。
+ * capacities 为各缓冲区字节数，writtenSizes 可为 NULL，否则返回各输出写入的字节数。
+ * 如需完全零拷贝，请使用 qnn_sample_app_get_output_tensor_view。
+ */
+QnnStatus qnn_sample_app_get_native_outputs(QnnSampleApp* app,
+                                            void** outputs,
+                                            const size_t* capacities,
+                                            size_t numOutputs,
+                                            size_t* writtenSizes,
+                                            int graphIdx);
+
+/*
+ * 单次调用完成推理：加载浮点输入、执行图、将输出反量化到调用者提供的缓冲区。
+ * 输入约定同 qnn_sample_app_load_float_inputs，输出约定同 qnn_sample_app_get_float_outputs_into。
+ * inputs 为 NULL 表示输入已通过输入视图写好；outputs 为 NULL 表示跳过输出转换，由调用者通过输出视图读取。
+ */
+QnnStatus qnn_sample_app_infer(QnnSampleApp* app,
+                               const float** inputs,
+                               const size_t* sizes,
+                               size_t numInputs,
+                               float** outputs,
+                               const size_t* capacities,
+                               size_t numOutputs,
+                               int graphIdx);
+
+/*
+ * 预热：用全零或随机数据填充该图的默认输入并执行 runs 次，stats 返回首次与稳态耗时，可为 NULL。
+ * 会覆盖该图默认张量中已有的输入/输出数据。
+ * get_warmup_stats 返回最近一次预热（包括创建时的自动预热）的结果，该图未预热过时返回失败。
+ */
+QnnStatus qnn_sample_app_warmup(QnnSampleApp* app, unsigned int runs, int graphIdx, QnnWarmupInput input, QnnWarmupStats* stats);
+QnnStatus qnn_sample_app_get_warmup_stats(QnnSampleApp* app, int graphIdx, QnnWarmupStats* stats);
+
+/*
+ * 获取常开的延迟直方图与计数器，开销很低，不需要开启 QNN 性能分析。
+ * reset 非 0 时读取的同时清零，可用于按周期上报。
+ */
+QnnStatus qnn_sample_app_get_metrics(QnnSampleApp* app, QnnMetrics* metrics, int reset);
+
+/*
+ * 运行时开启 backend 性能分析：之后每次成功执行收集一次事件树，只保留最近 historySize 次（默认建议 16）。
+ * 切换级别会清空已有结果，OFF 关闭并释放 profile 句柄。
+ * get_profile 的 back 为 0 表示最近一次；events 可为 NULL 只获取概要，
+ * capacity 小于 info->numEvents 时只拷贝前 capacity 个。
+ * get_profiles_json 返回最近 maxCount 次（0 为全部）的 JSON 数组，调用者需要使用 free() 释放。
+ */
+QnnStatus qnn_sample_app_set_profiling(QnnSampleApp* app, QnnProfilingLevel level, unsigned int historySize);
+size_t qnn_sample_app_get_profile_count(QnnSampleApp* app);
+QnnStatus qnn_sample_app_get_profile(QnnSampleApp* app, size_t back, QnnExecutionProfileInfo* info, QnnProfileEvent* events, size_t capacity);
+const char* qnn_sample_app_get_profiles_json(QnnSampleApp* app, size_t maxCount);
+void qnn_sample_app_clear_profiles(QnnSampleApp* app);
+
+/*
+ * HTP 性能档位：每次执行前自动投到 active 档位，最后一次执行结束 idleTimeoutMs 毫秒后放松到 idle 档位
+ * （默认 BURST / LOW_POWER / 1000ms）。pin 之后固定为指定档位直到 unpin，适合批量任务。
+ * 档位属于共享 backend，对同一 backend 的所有实例生效。
+ * 仅 HTP 后端可用，否则返回 QNN_STATUS_FEATURE_UNSUPPORTED；get_power_profile 此时返回 -1。
+ */
+QnnStatus qnn_sample_app_set_power_policy(QnnSampleApp* app, QnnPowerProfile active, QnnPowerProfile idle, unsigned int idleTimeoutMs);
+QnnStatus qnn_sample_app_pin_power_profile(QnnSampleApp* app, QnnPowerProfile profile);
+QnnStatus qnn_sample_app_unpin_power_profile(QnnSampleApp* app);
+int qnn_sample_app_get_power_profile(QnnSampleApp* app);
+
+/*
+ * 流水线张量组：每张图持有 2~4 组独立的输入/输出张量（默认 2 组），与上面接口使用的默认张量互不影响。
+ * 典型用法：acquire 一组 -> 写入输入（load_float_inputs_to_set 或输入视图）-> submit
+ * -> 读取输出（get_float_outputs_from_set 或输出视图）-> release。
+ * 生产者填充第 k+1 组时第 k 组可以在另一个线程上执行，消费者同时读取第 k-1 组。
+ * setIdx 为组句柄，仅在 acquire 与 release 之间有效。
+ */
+QnnStatus qnn_sample_app_set_tensor_ring_size(QnnSampleApp* app, unsigned int size);
+
+// 没有空闲组时返回 QNN_STATUS_FAILURE
+QnnStatus qnn_sample_app_acquire_tensor_set(QnnSampleApp* app, int graphIdx, unsigned int* setIdx);
+
+QnnStatus qnn_sample_app_load_float_inputs_to_set(QnnSampleApp* app,
+                                                  int graphIdx,
+                                                  unsigned int setIdx,
+                                                  const float** inputs,
+                                                  const size_t* sizes,
+                                                  size_t numInputs);
+
+QnnStatus qnn_sample_app_get_tensor_set_input_view(QnnSampleApp* app,
+                                                   int graphIdx,
+                                                   unsigned int setIdx,
+                                                   size_t inputIdx,
+                                                   QnnTensorView* view);
+
+QnnStatus qnn_sample_app_get_tensor_set_output_view(QnnSampleApp* app,
+                                                    int graphIdx,
+                                                    unsigned int setIdx,
+                                                    size_t outputIdx,
+                                                    QnnTensorView* view);
+
+// 同步执行该组，返回后即可读取输出
+QnnStatus qnn_sample_app_submit_tensor_set(QnnSampleApp* app, int graphIdx, unsigned int setIdx);
+
+QnnStatus qnn_sample_app_get_float_outputs_from_set(QnnSampleApp* app,
+                                                    int graphIdx,
+                                                    unsigned int setIdx,
+                                                    float** outputs,
+                                                    const size_t* capacities,
+                                                    size_t numOutputs);
+
+// 执行中的组不能释放
+QnnStatus qnn_sample_app_release_tensor_set(QnnSampleApp* app, int graphIdx, unsigned int setIdx);
+
+// backend 是否支持原生异步执行（graphExecuteAsync），支持返回 1，否则返回 0
+int qnn_sample_app_supports_async_execution(QnnSampleApp* app);
+
+// 原生异步执行的在途数上限，默认 2
+QnnStatus qnn_sample_app_set_max_in_flight(QnnSampleApp* app, unsigned int maxInFlight);
+
+// 阻塞直到所有原生异步执行完成
+void qnn_sample_app_wait_async_executions(QnnSampleApp* app);
+
 /*
  * 获取HTP架构版本号
  * 参数 backendPath 为后端库路径
@@ -145,20 +631,81 @@ void qnn_sample_app_create_context_async(QnnSampleApp* app, QnnAsyncCallback cal
 void qnn_sample_app_compose_graphs_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_finalize_graphs_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_execute_graphs_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
+void qnn_sample_app_execute_graph_async(QnnSampleApp* app, int graphIdx, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_register_op_packages_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_create_from_binary_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_save_binary_async(QnnSampleApp* app, const char* outputPath, const char* binaryName, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_free_context_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_terminate_backend_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_free_graphs_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
+void qnn_sample_app_swap_model_async(QnnSampleApp* app, const char* modelPath, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_get_backend_build_id_async(QnnSampleApp* app, QnnStringCallback callback, void* userData);
 void qnn_sample_app_is_device_property_supported_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_create_device_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_free_device_async(QnnSampleApp* app, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_load_float_inputs_async(QnnSampleApp* app, const float** inputs, const size_t* sizes, size_t numInputs, int graphIdx, QnnAsyncCallback callback, void* userData);
 void qnn_sample_app_get_float_outputs_async(QnnSampleApp* app, int graphIdx, QnnFloatOutputCallback callback, void* userData);
+// 异步推理：inputs/outputs 指向的缓冲区在回调返回前必须保持有效
+void qnn_sample_app_infer_async(QnnSampleApp* app, const float** inputs, const size_t* sizes, size_t numInputs, float** outputs, const size_t* capacities, size_t numOutputs, int graphIdx, QnnAsyncCallback callback, void* userData);
+void qnn_sample_app_warmup_async(QnnSampleApp* app, unsigned int runs, int graphIdx, QnnWarmupInput input, QnnAsyncCallback callback, void* userData);
+/*
+ * 异步执行该组，调用线程可以继续填充下一组，本函数从不阻塞。
+ * backend 支持 graphExecuteAsync 时直接入队，完成回调在 backend 的通知线程上调用；
+ * 不支持时退回实例工作线程上的同步执行，回调在工作线程上调用。
+ * 在途数达到 qnn_sample_app_set_max_in_flight 设置的上限时返回 QNN_STATUS_BUSY，
+ * 组保持已 acquire 状态且回调不会被调用，可稍后重试；其余情况返回 QNN_STATUS_SUCCESS，
+ * 结果通过回调给出，入队失败的回调投递到实例工作线程，不会在调用线程上执行。
+ */
+QnnStatus qnn_sample_app_submit_tensor_set_async(QnnSampleApp* app, int graphIdx, unsigned int setIdx, QnnAsyncCallback callback, void* userData);
 void qnn_get_htp_arch_version_async(const char* backendPath, QnnArchVersionCallback callback, void* userData);
 
+/*
+ * 请求合批调度器：把单样本请求打包进图输入张量的 batch 维度（第 0 维），
+ * 凑满一个 batch 或最早的请求等待超过 maxDelayUs 微秒时执行一次，再把输出按请求拆分。
+ * 所有输入/输出张量的第 0 维必须相同，否则创建失败返回 NULL。
+ * 整批推理投递到 app 的工作线程执行，与该 app 的其它异步调用按提交顺序串行；
+ * 同步执行接口仍可使用，会与批次推理互斥。销毁 app 之前必须先销毁调度器。
+ */
+typedef struct QnnBatchScheduler QnnBatchScheduler;
+
+QnnBatchScheduler* qnn_batch_scheduler_create(QnnSampleApp* app, int graphIdx, unsigned int maxDelayUs);
+
+// 执行完已排队的请求（并调用其回调）后销毁；会等待 app 工作线程，不能在异步回调中调用
+void qnn_batch_scheduler_destroy(QnnBatchScheduler* scheduler);
+
+unsigned int qnn_batch_scheduler_get_batch_size(QnnBatchScheduler* scheduler);
+
+/*
+ * 提交单样本请求。sizes 为各输入单样本元素个数（张量元素个数 / batch），输入在提交时即被拷贝；
+ * outputs 为单样本输出缓冲区，capacities 以 float 计，在回调被调用前必须保持有效。
+ * 回调在 app 的工作线程中执行，请勿在回调中销毁调度器或 app。
+ */
+QnnStatus qnn_batch_scheduler_submit(QnnBatchScheduler* scheduler,
+                                     const float** inputs,
+                                     const size_t* sizes,
+                                     size_t numInputs,
+                                     float** outputs,
+                                     const size_t* capacities,
+                                     size_t numOutputs,
+                                     QnnAsyncCallback callback,
+                                     void* userData);
+
+// 不等待凑满，立即执行当前已排队的请求
+void qnn_batch_scheduler_flush(QnnBatchScheduler* scheduler);
+
+/*
+ * 进程级时间线，导出为 Trace Event Format JSON，可直接用 chrome://tracing 或 Perfetto 打开。
+ * 包含 FFI 入口、实例工作线程排队等待、量化/反量化、graphExecute，
+ * 以及开启了 qnn_sample_app_set_profiling 的实例的 backend 事件（按层级放在对应的执行区间内）。
+ * 事件缓冲最多 capacity 个（0 使用默认 65536），满了丢弃最旧的；start 会清空之前的事件。
+ * stop 后事件保留，可继续导出；get_json 返回的字符串需要使用 free() 释放。
+ */
+void qnn_trace_start(size_t capacity);
+void qnn_trace_stop(void);
+QnnStatus qnn_trace_write(const char* path);
+const char* qnn_trace_get_json(void);
+void qnn_trace_clear(void);
+
 #ifdef __cplusplus
 }
 #endif